@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+
+#include <improc/corecv/image.hpp>
+#include <improc/corecv/kernels/channel_swizzle.hpp>
+#include <improc/corecv/kernels/color_lookup_table.hpp>
+#include <bench_resolutions.hpp>
+
+namespace
+{
+    void BM_ConvertToColorSpace( benchmark::State& state, improc::ColorSpace from_color_space, improc::ColorSpace to_color_space
+                               , bool with_channel_swizzle )
+    {
+        const cv::Mat image_data = improc::bench::CreateImage(state,CV_8UC(from_color_space.GetNumberChannels()));
+        if (with_channel_swizzle == true)
+        {
+            improc::ChannelSwizzle::Enable();
+        }
+        else
+        {
+            improc::ChannelSwizzle::Disable();
+        }
+        for (auto _ : state)
+        {
+            improc::ColorSpaceImage image {image_data,from_color_space};
+            image.ConvertToColorSpace(to_color_space);
+            benchmark::DoNotOptimize(image);
+        }
+        improc::ChannelSwizzle::Enable();
+        improc::bench::SetImageCounters(state,image_data);
+    }
+
+    void BM_ConvertToColorSpaceLookupTable( benchmark::State& state, improc::ColorSpace from_color_space, improc::ColorSpace to_color_space
+                                          , improc::ColorLookupTable::Mode mode )
+    {
+        const cv::Mat image_data = improc::bench::CreateImage(state,CV_8UC3);
+        if (mode != improc::ColorLookupTable::Mode::kDisabled)
+        {
+            // Table is built once per process and not measured
+            improc::ColorLookupTable::Get(from_color_space,to_color_space,mode);
+        }
+        improc::ColorLookupTable::SetMode(mode);
+        for (auto _ : state)
+        {
+            improc::ColorSpaceImage image {image_data,from_color_space};
+            image.ConvertToColorSpace(to_color_space);
+            benchmark::DoNotOptimize(image);
+        }
+        improc::ColorLookupTable::SetMode(improc::ColorLookupTable::Mode::kDisabled);
+        improc::bench::SetImageCounters(state,image_data);
+    }
+
+    /**
+     * @brief Register conversion benchmarks for every pair of color spaces. Conversions performed
+     * with channel swizzle are also registered with OpenCV for comparison.
+     */
+    const bool kRegistered = []
+    {
+        const std::vector<improc::ColorSpace> kColorSpaces { improc::ColorSpace(improc::ColorSpace::kRGBA)
+                                                           , improc::ColorSpace(improc::ColorSpace::kBGRA)
+                                                           , improc::ColorSpace(improc::ColorSpace::kRGB)
+                                                           , improc::ColorSpace(improc::ColorSpace::kBGR)
+                                                           , improc::ColorSpace(improc::ColorSpace::kGray) };
+        for (const improc::ColorSpace& from_color_space : kColorSpaces)
+        {
+            for (const improc::ColorSpace& to_color_space : kColorSpaces)
+            {
+                if (from_color_space == to_color_space)
+                {
+                    continue;
+                }
+                const std::string kName = fmt::format("BM_ConvertToColorSpace/{}2{}",from_color_space.ToString(),to_color_space.ToString());
+                benchmark::RegisterBenchmark(kName.c_str(),BM_ConvertToColorSpace,from_color_space,to_color_space,true)
+                    ->Apply(improc::bench::AddResolutions);
+                if (improc::ChannelSwizzle::IsSwizzle(from_color_space,to_color_space) == true)
+                {
+                    benchmark::RegisterBenchmark((kName + "/opencv").c_str(),BM_ConvertToColorSpace,from_color_space,to_color_space,false)
+                        ->Apply(improc::bench::AddResolutions);
+                }
+            }
+        }
+
+        for (const improc::ColorSpace& to_color_space : {improc::ColorSpace(improc::ColorSpace::kHSV),improc::ColorSpace(improc::ColorSpace::kLab)})
+        {
+            const improc::ColorSpace kFromColorSpace {improc::ColorSpace::kBGR};
+            const std::string kName = fmt::format("BM_ConvertToColorSpace/{}2{}",kFromColorSpace.ToString(),to_color_space.ToString());
+            benchmark::RegisterBenchmark((kName + "/opencv").c_str(),BM_ConvertToColorSpaceLookupTable,kFromColorSpace,to_color_space,improc::ColorLookupTable::Mode::kDisabled)
+                ->Apply(improc::bench::AddResolutions);
+            benchmark::RegisterBenchmark((kName + "/trilinear").c_str(),BM_ConvertToColorSpaceLookupTable,kFromColorSpace,to_color_space,improc::ColorLookupTable::Mode::kTrilinear)
+                ->Apply(improc::bench::AddResolutions);
+            benchmark::RegisterBenchmark((kName + "/full").c_str(),BM_ConvertToColorSpaceLookupTable,kFromColorSpace,to_color_space,improc::ColorLookupTable::Mode::kFull)
+                ->Apply(improc::bench::AddResolutions);
+        }
+        return true;
+    }();
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+#include <benchmark/benchmark.h>
+
+#include <improc/services/convert_color_space.hpp>
+#include <bench_resolutions.hpp>
+
+namespace
+{
+    void BM_ConvertColorSpaceRun(benchmark::State& state, std::string from_color_space, std::vector<std::string> to_color_space)
+    {
+        Json::Value service_json {};
+        service_json["inputs"].append("image");
+        service_json["outputs"] = "image";
+        service_json["from_color_space"] = from_color_space;
+        for (const std::string& color_space : to_color_space)
+        {
+            service_json["to_color_space"].append(color_space);
+        }
+        improc::StringKeyHeterogeneousConvertColorSpace convert {};
+        convert.Load(service_json);
+
+        const cv::Mat image_data = improc::bench::CreateImage(state,CV_8UC(improc::ColorSpace(from_color_space).GetNumberChannels()));
+        for (auto _ : state)
+        {
+            improc::StringKeyHeterogeneousContext context {};
+            context.Add("image",image_data);
+            convert.Run(context);
+            benchmark::DoNotOptimize(context);
+        }
+        improc::bench::SetImageCounters(state,image_data);
+    }
+}
+
+BENCHMARK_CAPTURE(BM_ConvertColorSpaceRun,rgb-bgr       ,std::string("rgb"),std::vector<std::string>{"bgr"})
+    ->Apply(improc::bench::AddResolutions);
+BENCHMARK_CAPTURE(BM_ConvertColorSpaceRun,rgb-gray      ,std::string("rgb"),std::vector<std::string>{"gray"})
+    ->Apply(improc::bench::AddResolutions);
+BENCHMARK_CAPTURE(BM_ConvertColorSpaceRun,rgb-bgra-gray ,std::string("rgb"),std::vector<std::string>{"bgra","gray"})
+    ->Apply(improc::bench::AddResolutions);
+BENCHMARK_CAPTURE(BM_ConvertColorSpaceRun,rgb-bgr-rgb   ,std::string("rgb"),std::vector<std::string>{"bgr","rgb"})
+    ->Apply(improc::bench::AddResolutions);
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+
+#include <improc/services/decode_image.hpp>
+#include <improc/services/resize_image.hpp>
+#include <bench_resolutions.hpp>
+
+namespace
+{
+    /**
+     * @brief Decode JPEG image and downscale it to a quarter of its size, with or without the reduced decode hint
+     */
+    void BM_DecodeThumbnail(benchmark::State& state, bool with_size_hint)
+    {
+        const cv::Mat kImageData = improc::bench::CreateImage(state,CV_8UC3);
+        std::vector<uchar> encoded_data {};
+        cv::imencode(".jpg",kImageData,encoded_data);
+
+        Json::Value to_image_size {};
+        to_image_size["width"]  = kImageData.cols / 4;
+        to_image_size["height"] = kImageData.rows / 4;
+
+        Json::Value decode_json {};
+        decode_json["inputs"]  = "encoded_image";
+        decode_json["outputs"] = "decoded_image";
+        if (with_size_hint == true)
+        {
+            decode_json["to_image_size"] = to_image_size;
+        }
+        improc::StringKeyHeterogeneousDecode decode {};
+        decode.Load(decode_json);
+
+        Json::Value resize_json {};
+        resize_json["inputs"]        = "image";
+        resize_json["outputs"]       = "image";
+        resize_json["interpolation"] = "linear";
+        resize_json["to_image_size"] = to_image_size;
+        improc::StringKeyHeterogeneousResize resize {};
+        resize.Load(resize_json);
+
+        for (auto _ : state)
+        {
+            improc::StringKeyHeterogeneousContext context {};
+            context.Add("encoded_image",encoded_data);
+            decode.Run(context);
+            context.Add("image",std::any_cast<improc::Image>(context["decoded_image"]).get_data());
+            resize.Run(context);
+            benchmark::DoNotOptimize(context);
+        }
+        improc::bench::SetImageCounters(state,kImageData);
+    }
+}
+
+BENCHMARK_CAPTURE(BM_DecodeThumbnail,full-decode    ,false)
+    ->Apply(improc::bench::AddResolutions);
+BENCHMARK_CAPTURE(BM_DecodeThumbnail,reduced-decode ,true)
+    ->Apply(improc::bench::AddResolutions);
\ No newline at end of file
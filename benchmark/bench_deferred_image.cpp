@@ -0,0 +1,47 @@
+#include <benchmark/benchmark.h>
+
+#include <improc/corecv/deferred_image.hpp>
+#include <bench_resolutions.hpp>
+
+namespace
+{
+    // Camera frames are cropped, converted for display, rotated to portrait and downscaled
+    const cv::Size kToImageSize {540,960};
+
+    cv::Rect GetCropRegion(const cv::Mat& image_data)
+    {
+        return cv::Rect(image_data.cols / 8,image_data.rows / 8,image_data.cols * 3 / 4,image_data.rows * 3 / 4);
+    }
+
+    void BM_DeferredImageMaterialize(benchmark::State& state)
+    {
+        const cv::Mat image_data = improc::bench::CreateImage(state,CV_8UC3);
+        for (auto _ : state)
+        {
+            improc::DeferredImage image {improc::ColorSpaceImage(image_data,improc::ColorSpace::kBGR)};
+            image.Crop(GetCropRegion(image_data));
+            image.ConvertToColorSpace(improc::ColorSpace(improc::ColorSpace::kRGB));
+            image.Rotate(improc::RotationType(improc::RotationType::k90Deg));
+            image.Resize(kToImageSize,improc::InterpolationType(improc::InterpolationType::kLinear));
+            benchmark::DoNotOptimize(image.Materialize().get_data().data);
+        }
+        improc::bench::SetImageCounters(state,image_data);
+    }
+
+    void BM_DeferredImageEager(benchmark::State& state)
+    {
+        const cv::Mat image_data = improc::bench::CreateImage(state,CV_8UC3);
+        for (auto _ : state)
+        {
+            improc::ColorSpaceImage image {image_data(GetCropRegion(image_data)),improc::ColorSpace::kBGR};
+            image.ConvertToColorSpace(improc::ColorSpace::kRGB);
+            image.set_data(improc::RotationType(improc::RotationType::k90Deg).Apply(image.get_data()));
+            image.Resize(kToImageSize,improc::InterpolationType(improc::InterpolationType::kLinear));
+            benchmark::DoNotOptimize(image.get_data().data);
+        }
+        improc::bench::SetImageCounters(state,image_data);
+    }
+}
+
+BENCHMARK(BM_DeferredImageMaterialize)  ->Apply(improc::bench::AddResolutions);
+BENCHMARK(BM_DeferredImageEager)        ->Apply(improc::bench::AddResolutions);
\ No newline at end of file
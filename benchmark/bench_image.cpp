@@ -0,0 +1,40 @@
+#include <benchmark/benchmark.h>
+
+#include <improc/corecv/image.hpp>
+#include <bench_resolutions.hpp>
+
+static void BM_ImageSetData(benchmark::State& state) {
+    const cv::Mat image_data = improc::bench::CreateImage(state,CV_8UC3);
+    improc::Image image {};
+    for (auto _ : state)
+    {
+        image.set_data(image_data);
+        benchmark::DoNotOptimize(image);
+    }
+    improc::bench::SetImageCounters(state,image_data);
+}
+BENCHMARK(BM_ImageSetData)->Apply(improc::bench::AddResolutions);
+
+static void BM_ImageClone(benchmark::State& state) {
+    const cv::Mat image_data = improc::bench::CreateImage(state,CV_8UC3);
+    improc::Image image {image_data};
+    for (auto _ : state)
+    {
+        improc::Image cloned_image = image.Clone();
+        benchmark::DoNotOptimize(cloned_image);
+    }
+    improc::bench::SetImageCounters(state,image_data);
+}
+BENCHMARK(BM_ImageClone)->Apply(improc::bench::AddResolutions);
+
+static void BM_ColorSpaceImageClone(benchmark::State& state) {
+    const cv::Mat image_data = improc::bench::CreateImage(state,CV_8UC3);
+    improc::ColorSpaceImage image {image_data,improc::ColorSpace::kRGB};
+    for (auto _ : state)
+    {
+        improc::ColorSpaceImage cloned_image = image.Clone();
+        benchmark::DoNotOptimize(cloned_image);
+    }
+    improc::bench::SetImageCounters(state,image_data);
+}
+BENCHMARK(BM_ColorSpaceImageClone)->Apply(improc::bench::AddResolutions);
\ No newline at end of file
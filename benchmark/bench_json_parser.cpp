@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include <improc/corecv/parsers/json_parser.hpp>
+
+namespace
+{
+    Json::Value CreateJsonSize()
+    {
+        Json::Value json_size {};
+        json_size["width"]  = 1920;
+        json_size["height"] = 1080;
+        return json_size;
+    }
+
+    Json::Value CreateJsonPoint()
+    {
+        Json::Value json_point {};
+        json_point["x"] = 6;
+        json_point["y"] = 10;
+        return json_point;
+    }
+}
+
+static void BM_ReadElementPoint(benchmark::State& state) {
+    const Json::Value kJsonPoint = CreateJsonPoint();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(improc::json::ReadElement<cv::Point>(kJsonPoint));
+    }
+}
+BENCHMARK(BM_ReadElementPoint);
+
+static void BM_ReadElementSize(benchmark::State& state) {
+    const Json::Value kJsonSize = CreateJsonSize();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(improc::json::ReadElement<cv::Size>(kJsonSize));
+    }
+}
+BENCHMARK(BM_ReadElementSize);
+
+static void BM_ReadPositiveSize(benchmark::State& state) {
+    const Json::Value kJsonSize = CreateJsonSize();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(improc::json::ReadPositiveSize<cv::Size>(kJsonSize));
+    }
+}
+BENCHMARK(BM_ReadPositiveSize);
+
+static void BM_ReadPositiveSizeDouble(benchmark::State& state) {
+    const Json::Value kJsonSize = CreateJsonSize();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(improc::json::ReadPositiveSize<cv::Size2d>(kJsonSize));
+    }
+}
+BENCHMARK(BM_ReadPositiveSizeDouble);
\ No newline at end of file
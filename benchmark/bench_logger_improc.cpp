@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+
+#include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/async_ring_buffer_sink.hpp>
+
+#include <spdlog/sinks/basic_file_sink.h>
+
+#include <filesystem>
+
+namespace
+{
+    /**
+     * @brief Set level of image processing logger while benchmark runs
+     */
+    class ScopedLoggerLevel final
+    {
+        private:
+            spdlog::level::level_enum   previous_level_;
+
+        public:
+            explicit ScopedLoggerLevel(spdlog::level::level_enum level) : previous_level_(improc::ImageProcLogger::get()->data()->level())
+            {
+                improc::ImageProcLogger::get()->data()->set_level(level);
+            }
+
+            ~ScopedLoggerLevel()
+            {
+                improc::ImageProcLogger::get()->data()->set_level(this->previous_level_);
+            }
+    };
+
+    spdlog::sink_ptr CreateFileSink()
+    {
+        const std::filesystem::path kLogFilepath = std::filesystem::temp_directory_path() / "improc_corecv_bench.log";
+        return std::make_shared<spdlog::sinks::basic_file_sink_mt>(kLogFilepath.string(),true);
+    }
+
+    void BM_LoggerTraceDisabled(benchmark::State& state)
+    {
+        const ScopedLoggerLevel kLevel {spdlog::level::info};
+        int value = 0;
+        for (auto _ : state)
+        {
+            IMPROC_CORECV_LOGGER_TRACE("Trace record {}",++value);
+            benchmark::ClobberMemory();
+        }
+    }
+
+    void BM_LoggerTraceDisabledSingleton(benchmark::State& state)
+    {
+        const ScopedLoggerLevel kLevel {spdlog::level::info};
+        int value = 0;
+        for (auto _ : state)
+        {
+            IMPROC_LOGGER_TRACE(improc::ImageProcLogger::get(),"Trace record {}",++value);
+            benchmark::ClobberMemory();
+        }
+    }
+
+    void BM_LoggerTraceEnabledRingBuffer(benchmark::State& state)
+    {
+        spdlog::logger logger {"bench_ring_buffer",CreateFileSink()};
+        logger.set_level(spdlog::level::trace);
+        const std::shared_ptr<improc::AsyncRingBufferSink> kRingBufferSink = improc::AsyncRingBufferSink::Install(logger,1 << 16);
+        int value = 0;
+        for (auto _ : state)
+        {
+            logger.trace("Trace record {}",++value);
+        }
+        logger.flush();
+        state.counters["dropped"] = static_cast<double>(kRingBufferSink->get_dropped_records());
+    }
+
+    void BM_LoggerTraceEnabledSynchronous(benchmark::State& state)
+    {
+        spdlog::logger logger {"bench_synchronous",CreateFileSink()};
+        logger.set_level(spdlog::level::trace);
+        int value = 0;
+        for (auto _ : state)
+        {
+            logger.trace("Trace record {}",++value);
+        }
+    }
+}
+
+BENCHMARK(BM_LoggerTraceDisabled);
+BENCHMARK(BM_LoggerTraceDisabledSingleton);
+BENCHMARK(BM_LoggerTraceEnabledRingBuffer)->Threads(1)->Threads(4);
+BENCHMARK(BM_LoggerTraceEnabledSynchronous)->Threads(1)->Threads(4);
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include <improc/corecv/kernels/luminance_threshold.hpp>
+#include <bench_resolutions.hpp>
+
+#include <opencv2/imgproc.hpp>
+
+namespace
+{
+    void BM_LuminanceThresholdOtsu(benchmark::State& state)
+    {
+        const cv::Mat image_data = improc::bench::CreateImage(state,CV_8UC3);
+        const improc::LuminanceThreshold kThreshold {improc::ThresholdType(improc::ThresholdType::kOtsu)};
+        cv::Mat threshold_image_data {};
+        for (auto _ : state)
+        {
+            kThreshold.Apply(image_data,improc::ColorSpace(improc::ColorSpace::kBGR),threshold_image_data);
+            benchmark::DoNotOptimize(threshold_image_data.data);
+        }
+        improc::bench::SetImageCounters(state,image_data);
+    }
+
+    void BM_LuminanceThresholdOtsuOpenCV(benchmark::State& state)
+    {
+        const cv::Mat image_data = improc::bench::CreateImage(state,CV_8UC3);
+        cv::Mat gray_image_data {};
+        cv::Mat threshold_image_data {};
+        for (auto _ : state)
+        {
+            cv::cvtColor(image_data,gray_image_data,cv::COLOR_BGR2GRAY);
+            cv::threshold(gray_image_data,threshold_image_data,0,255,cv::THRESH_BINARY | cv::THRESH_OTSU);
+            benchmark::DoNotOptimize(threshold_image_data.data);
+        }
+        improc::bench::SetImageCounters(state,image_data);
+    }
+
+    void BM_LuminanceThresholdAdaptiveMean(benchmark::State& state)
+    {
+        const cv::Mat image_data = improc::bench::CreateImage(state,CV_8UC3);
+        const improc::LuminanceThreshold kThreshold {improc::ThresholdType(improc::ThresholdType::kAdaptiveMean),5.0,255.0,31};
+        cv::Mat threshold_image_data {};
+        for (auto _ : state)
+        {
+            kThreshold.Apply(image_data,improc::ColorSpace(improc::ColorSpace::kBGR),threshold_image_data);
+            benchmark::DoNotOptimize(threshold_image_data.data);
+        }
+        improc::bench::SetImageCounters(state,image_data);
+    }
+
+    void BM_LuminanceThresholdAdaptiveMeanOpenCV(benchmark::State& state)
+    {
+        const cv::Mat image_data = improc::bench::CreateImage(state,CV_8UC3);
+        cv::Mat gray_image_data {};
+        cv::Mat threshold_image_data {};
+        for (auto _ : state)
+        {
+            cv::cvtColor(image_data,gray_image_data,cv::COLOR_BGR2GRAY);
+            cv::adaptiveThreshold(gray_image_data,threshold_image_data,255,cv::ADAPTIVE_THRESH_MEAN_C,cv::THRESH_BINARY,31,5.0);
+            benchmark::DoNotOptimize(threshold_image_data.data);
+        }
+        improc::bench::SetImageCounters(state,image_data);
+    }
+
+    void BM_LuminanceThresholdSauvola(benchmark::State& state)
+    {
+        const cv::Mat image_data = improc::bench::CreateImage(state,CV_8UC3);
+        const improc::LuminanceThreshold kThreshold {improc::ThresholdType(improc::ThresholdType::kSauvola),0.5,255.0,31};
+        cv::Mat threshold_image_data {};
+        for (auto _ : state)
+        {
+            kThreshold.Apply(image_data,improc::ColorSpace(improc::ColorSpace::kBGR),threshold_image_data);
+            benchmark::DoNotOptimize(threshold_image_data.data);
+        }
+        improc::bench::SetImageCounters(state,image_data);
+    }
+}
+
+BENCHMARK(BM_LuminanceThresholdOtsu)                ->Apply(improc::bench::AddResolutions);
+BENCHMARK(BM_LuminanceThresholdOtsuOpenCV)          ->Apply(improc::bench::AddResolutions);
+BENCHMARK(BM_LuminanceThresholdAdaptiveMean)        ->Apply(improc::bench::AddResolutions);
+BENCHMARK(BM_LuminanceThresholdAdaptiveMeanOpenCV)  ->Apply(improc::bench::AddResolutions);
+BENCHMARK(BM_LuminanceThresholdSauvola)             ->Apply(improc::bench::AddResolutions);
\ No newline at end of file
@@ -0,0 +1,40 @@
+#include <benchmark/benchmark.h>
+
+#include <improc/corecv/kernels/rectangle_morphology.hpp>
+#include <bench_resolutions.hpp>
+
+#include <opencv2/imgproc.hpp>
+
+namespace
+{
+    void BM_RectangleMorphologyApply(benchmark::State& state, int kernel_size)
+    {
+        const cv::Mat image_data = improc::bench::CreateImage(state,CV_8UC1);
+        const improc::RectangleMorphology kMorphology {improc::MorphologicalOper(improc::MorphologicalOper::kClose),cv::Size(kernel_size,kernel_size)};
+        cv::Mat morphology_image_data {};
+        for (auto _ : state)
+        {
+            kMorphology.Apply(image_data,morphology_image_data);
+            benchmark::DoNotOptimize(morphology_image_data.data);
+        }
+        improc::bench::SetImageCounters(state,image_data);
+    }
+
+    void BM_RectangleMorphologyOpenCV(benchmark::State& state, int kernel_size)
+    {
+        const cv::Mat image_data = improc::bench::CreateImage(state,CV_8UC1);
+        const cv::Mat kKernel    = cv::getStructuringElement(cv::MORPH_RECT,cv::Size(kernel_size,kernel_size));
+        cv::Mat morphology_image_data {};
+        for (auto _ : state)
+        {
+            cv::morphologyEx(image_data,morphology_image_data,cv::MORPH_CLOSE,kKernel);
+            benchmark::DoNotOptimize(morphology_image_data.data);
+        }
+        improc::bench::SetImageCounters(state,image_data);
+    }
+}
+
+BENCHMARK_CAPTURE(BM_RectangleMorphologyApply ,close-3x3  ,3 )->Apply(improc::bench::AddResolutions);
+BENCHMARK_CAPTURE(BM_RectangleMorphologyApply ,close-31x31,31)->Apply(improc::bench::AddResolutions);
+BENCHMARK_CAPTURE(BM_RectangleMorphologyOpenCV,close-3x3  ,3 )->Apply(improc::bench::AddResolutions);
+BENCHMARK_CAPTURE(BM_RectangleMorphologyOpenCV,close-31x31,31)->Apply(improc::bench::AddResolutions);
\ No newline at end of file
@@ -0,0 +1,43 @@
+#ifndef IMPROC_CORECV_BENCH_RESOLUTIONS_HPP
+#define IMPROC_CORECV_BENCH_RESOLUTIONS_HPP
+
+#include <benchmark/benchmark.h>
+#include <opencv2/core.hpp>
+
+namespace improc::bench
+{
+    /**
+     * @brief Add image resolutions from VGA to 8K as width and height arguments
+     */
+    inline void AddResolutions(benchmark::internal::Benchmark* bench)
+    {
+        bench->ArgNames({"width","height"});
+        bench->Args({ 640, 480});       // VGA
+        bench->Args({1280, 720});       // HD
+        bench->Args({1920,1080});       // Full HD
+        bench->Args({3840,2160});       // 4K
+        bench->Args({7680,4320});       // 8K
+        bench->Unit(benchmark::kMicrosecond);
+    }
+
+    /**
+     * @brief Create random image with resolution given by benchmark arguments
+     */
+    inline cv::Mat CreateImage(const benchmark::State& state, int type)
+    {
+        cv::Mat image_data {static_cast<int>(state.range(1)),static_cast<int>(state.range(0)),type};
+        cv::randu(image_data,cv::Scalar::all(0),cv::Scalar::all(255));
+        return image_data;
+    }
+
+    /**
+     * @brief Report processed pixels and bytes
+     */
+    inline void SetImageCounters(benchmark::State& state, const cv::Mat& image_data)
+    {
+        state.SetItemsProcessed(state.iterations() * image_data.total());
+        state.SetBytesProcessed(state.iterations() * image_data.total() * image_data.elemSize());
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include <benchmark/benchmark.h>
+
+#include <improc/corecv/structures/rotation_type.hpp>
+#include <bench_resolutions.hpp>
+
+namespace
+{
+    void BM_RotationTypeApply(benchmark::State& state, improc::RotationType rotation)
+    {
+        const cv::Mat image_data = improc::bench::CreateImage(state,CV_8UC3);
+        for (auto _ : state)
+        {
+            cv::Mat rotated_image_data = rotation.Apply(image_data);
+            benchmark::DoNotOptimize(rotated_image_data.data);
+        }
+        improc::bench::SetImageCounters(state,image_data);
+    }
+
+    void BM_RotationTypeApplyToDestination(benchmark::State& state, improc::RotationType rotation)
+    {
+        const cv::Mat image_data = improc::bench::CreateImage(state,CV_8UC3);
+        cv::Mat rotated_image_data {};
+        for (auto _ : state)
+        {
+            rotation.Apply(image_data,rotated_image_data);
+            benchmark::DoNotOptimize(rotated_image_data.data);
+        }
+        improc::bench::SetImageCounters(state,image_data);
+    }
+}
+
+BENCHMARK_CAPTURE(BM_RotationTypeApply,0-deg  ,improc::RotationType(improc::RotationType::k0Deg  ))->Apply(improc::bench::AddResolutions);
+BENCHMARK_CAPTURE(BM_RotationTypeApply,90-deg ,improc::RotationType(improc::RotationType::k90Deg ))->Apply(improc::bench::AddResolutions);
+BENCHMARK_CAPTURE(BM_RotationTypeApply,180-deg,improc::RotationType(improc::RotationType::k180Deg))->Apply(improc::bench::AddResolutions);
+BENCHMARK_CAPTURE(BM_RotationTypeApply,270-deg,improc::RotationType(improc::RotationType::k270Deg))->Apply(improc::bench::AddResolutions);
+
+BENCHMARK_CAPTURE(BM_RotationTypeApplyToDestination,90-deg ,improc::RotationType(improc::RotationType::k90Deg ))->Apply(improc::bench::AddResolutions);
+BENCHMARK_CAPTURE(BM_RotationTypeApplyToDestination,180-deg,improc::RotationType(improc::RotationType::k180Deg))->Apply(improc::bench::AddResolutions);
+BENCHMARK_CAPTURE(BM_RotationTypeApplyToDestination,270-deg,improc::RotationType(improc::RotationType::k270Deg))->Apply(improc::bench::AddResolutions);
\ No newline at end of file
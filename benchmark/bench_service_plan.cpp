@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include <improc/services/convert_color_space.hpp>
+#include <improc/services/resize_image.hpp>
+#include <improc/services/morphology.hpp>
+#include <improc/services/threshold.hpp>
+
+#include <json/json.h>
+
+#include <memory>
+#include <sstream>
+
+namespace
+{
+    const std::string kPipelineJson = R"([
+        {"inputs": "image", "outputs": "image", "from_color_space": "bgr", "to_color_space": ["rgb","gray"]},
+        {"inputs": "image", "outputs": "image", "interpolation": "linear", "to_image_size": {"width": 640, "height": 480}},
+        {"inputs": "image", "outputs": "image", "type": "dilate", "kernel": {"shape": "ellipse", "size": {"width": 7, "height": 5}}, "number_iterations": 2},
+        {"inputs": "image", "outputs": "image", "type": "binary", "threshold": 100, "max_value": 255, "from_color_space": "gray"}
+    ])";
+
+    /**
+     * @brief Services of the benchmark pipeline
+     */
+    struct Pipeline
+    {
+        improc::StringKeyHeterogeneousConvertColorSpace convert {};
+        improc::StringKeyHeterogeneousResize            resize {};
+        improc::StringKeyHeterogeneousMorphology        morphology {};
+        improc::StringKeyHeterogeneousThreshold         threshold {};
+    };
+
+    Json::Value ParsePipelineJson()
+    {
+        Json::Value pipeline_json {};
+        std::istringstream pipeline_stream {kPipelineJson};
+        Json::CharReaderBuilder reader_builder {};
+        std::string errors {};
+        Json::parseFromStream(reader_builder,pipeline_stream,&pipeline_json,&errors);
+        return pipeline_json;
+    }
+}
+
+static void BM_LoadPipelineFromJson(benchmark::State& state) {
+    for (auto _ : state)
+    {
+        const Json::Value kPipelineJsonValue = ParsePipelineJson();
+        std::unique_ptr<Pipeline> pipeline = std::make_unique<Pipeline>();
+        pipeline->convert.Load(kPipelineJsonValue[0]);
+        pipeline->resize.Load(kPipelineJsonValue[1]);
+        pipeline->morphology.Load(kPipelineJsonValue[2]);
+        pipeline->threshold.Load(kPipelineJsonValue[3]);
+        benchmark::DoNotOptimize(pipeline);
+    }
+}
+BENCHMARK(BM_LoadPipelineFromJson);
+
+static void BM_LoadPipelineFromPlan(benchmark::State& state) {
+    const Json::Value kPipelineJsonValue = ParsePipelineJson();
+    Pipeline json_pipeline {};
+    json_pipeline.convert.Load(kPipelineJsonValue[0]);
+    json_pipeline.resize.Load(kPipelineJsonValue[1]);
+    json_pipeline.morphology.Load(kPipelineJsonValue[2]);
+    json_pipeline.threshold.Load(kPipelineJsonValue[3]);
+
+    improc::PlanWriter plan_writer {};
+    json_pipeline.convert.Save(plan_writer);
+    json_pipeline.resize.Save(plan_writer);
+    json_pipeline.morphology.Save(plan_writer);
+    json_pipeline.threshold.Save(plan_writer);
+
+    for (auto _ : state)
+    {
+        improc::PlanReader plan_reader {plan_writer.get_data()};
+        std::unique_ptr<Pipeline> pipeline = std::make_unique<Pipeline>();
+        pipeline->convert.Load(plan_reader);
+        pipeline->resize.Load(plan_reader);
+        pipeline->morphology.Load(plan_reader);
+        pipeline->threshold.Load(plan_reader);
+        benchmark::DoNotOptimize(pipeline);
+    }
+}
+BENCHMARK(BM_LoadPipelineFromPlan);
\ No newline at end of file
@@ -0,0 +1,34 @@
+#include <benchmark/benchmark.h>
+
+#include <improc/corecv/structures/color_space.hpp>
+#include <improc/corecv/structures/image_format.hpp>
+#include <improc/corecv/structures/interpolation_type.hpp>
+#include <improc/corecv/structures/kernel_shape.hpp>
+#include <improc/corecv/structures/morphological_oper.hpp>
+#include <improc/corecv/structures/rotation_type.hpp>
+#include <improc/corecv/structures/threshold_type.hpp>
+
+namespace
+{
+    template <typename EnumType>
+    void BM_EnumFromString(benchmark::State& state, std::string enum_str)
+    {
+        for (auto _ : state)
+        {
+            EnumType enum_value {enum_str};
+            benchmark::DoNotOptimize(enum_value);
+        }
+    }
+
+    const bool kRegistered = []
+    {
+        benchmark::RegisterBenchmark("BM_EnumFromString/ColorSpace"         ,BM_EnumFromString<improc::ColorSpace>          ,"BGRA");
+        benchmark::RegisterBenchmark("BM_EnumFromString/ImageFormat"        ,BM_EnumFromString<improc::ImageFormat>         ,"JPEG2000");
+        benchmark::RegisterBenchmark("BM_EnumFromString/InterpolationType"  ,BM_EnumFromString<improc::InterpolationType>   ,"Nearest");
+        benchmark::RegisterBenchmark("BM_EnumFromString/KernelShape"        ,BM_EnumFromString<improc::KernelShape>         ,"Rectangle");
+        benchmark::RegisterBenchmark("BM_EnumFromString/MorphologicalOper"  ,BM_EnumFromString<improc::MorphologicalOper>   ,"Close");
+        benchmark::RegisterBenchmark("BM_EnumFromString/RotationType"       ,BM_EnumFromString<improc::RotationType>        ,"270-Deg");
+        benchmark::RegisterBenchmark("BM_EnumFromString/ThresholdType"      ,BM_EnumFromString<improc::ThresholdType>       ,"Otsu");
+        return true;
+    }();
+}
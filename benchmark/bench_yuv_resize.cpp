@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+
+#include <improc/corecv/kernels/yuv_resize.hpp>
+#include <bench_resolutions.hpp>
+
+#include <opencv2/imgproc.hpp>
+
+namespace
+{
+    // Camera frames are resized to Full HD, the typical input of detection models
+    const cv::Size kToImageSize {1920,1080};
+
+    cv::Mat CreateNV12ImageData(const benchmark::State& state)
+    {
+        const cv::Size kImageSize {static_cast<int>(state.range(0)),static_cast<int>(state.range(1))};
+        cv::Mat image_data {improc::ColorSpace(improc::ColorSpace::kNV12).GetDataSize(kImageSize),CV_8UC1};
+        cv::randu(image_data,cv::Scalar::all(0),cv::Scalar::all(255));
+        return image_data;
+    }
+
+    void BM_YUVResizeNV12ToBGR(benchmark::State& state)
+    {
+        const cv::Mat image_data = CreateNV12ImageData(state);
+        const improc::YUVResize kYUVResize { improc::ColorSpace(improc::ColorSpace::kNV12),improc::ColorSpace(improc::ColorSpace::kBGR)
+                                           , improc::ColorSpace(improc::ColorSpace::kNV12).GetImageSize(image_data.size()),kToImageSize
+                                           , improc::InterpolationType(improc::InterpolationType::kLinear) };
+        cv::Mat resized_image_data {};
+        for (auto _ : state)
+        {
+            kYUVResize.Apply(image_data,resized_image_data);
+            benchmark::DoNotOptimize(resized_image_data.data);
+        }
+        improc::bench::SetImageCounters(state,image_data);
+    }
+
+    void BM_YUVResizeNV12ToBGROpenCV(benchmark::State& state)
+    {
+        const cv::Mat image_data = CreateNV12ImageData(state);
+        cv::Mat converted_image_data {};
+        cv::Mat resized_image_data {};
+        for (auto _ : state)
+        {
+            cv::cvtColor(image_data,converted_image_data,cv::COLOR_YUV2BGR_NV12);
+            cv::resize(converted_image_data,resized_image_data,kToImageSize,0,0,cv::INTER_LINEAR);
+            benchmark::DoNotOptimize(resized_image_data.data);
+        }
+        improc::bench::SetImageCounters(state,image_data);
+    }
+}
+
+BENCHMARK(BM_YUVResizeNV12ToBGR)        ->Apply(improc::bench::AddResolutions);
+BENCHMARK(BM_YUVResizeNV12ToBGROpenCV)  ->Apply(improc::bench::AddResolutions);
\ No newline at end of file
@@ -0,0 +1,87 @@
+#ifndef IMPROC_CORECV_ASYNC_RING_BUFFER_SINK_HPP
+#define IMPROC_CORECV_ASYNC_RING_BUFFER_SINK_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/corecv/logger_improc.hpp>
+
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/sink.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace improc
+{
+    /**
+     * @brief Logging sink that hands records to a background thread through a lock-free ring buffer
+     *
+     * Logging threads copy each formatted record into a fixed-size slot of a bounded multi-producer
+     * ring buffer and return without locking or writing. A background thread drains the ring buffer
+     * into the wrapped sinks, which are only locked against changes of their pattern or formatter. Records are dropped when the ring buffer is full and records longer than
+     * the slot size are truncated, so that logging never blocks the calling thread.
+     */
+    class IMPROC_API AsyncRingBufferSink final : public spdlog::sinks::sink
+    {
+        public:
+            static constexpr size_t             kDefaultCapacity    = 4096;
+            static constexpr size_t             kMaxRecordSize      = 472;
+
+        private:
+            struct Record
+            {
+                spdlog::level::level_enum       level;
+                spdlog::log_clock::time_point   time;
+                size_t                          thread_id;
+                spdlog::source_loc              source;
+                size_t                          logger_name_size;
+                size_t                          payload_size;
+                char                            text[kMaxRecordSize];
+            };
+
+            struct alignas(64) Slot
+            {
+                std::atomic<size_t>             sequence;
+                Record                          record;
+            };
+
+            std::vector<spdlog::sink_ptr>       sinks_;
+            std::mutex                          sinks_mutex_;
+            std::unique_ptr<Slot[]>             slots_;
+            size_t                              mask_;
+            alignas(64) std::atomic<size_t>     enqueue_pos_;
+            alignas(64) std::atomic<size_t>     dequeue_pos_;
+            std::atomic<size_t>                 dropped_records_;
+            std::atomic<size_t>                 flush_pos_;
+            std::atomic<size_t>                 flushed_pos_;
+            std::atomic<bool>                   is_running_;
+            std::thread                         worker_;
+
+            bool                                Dequeue();
+            void                                Drain();
+
+        public:
+            explicit AsyncRingBufferSink(std::vector<spdlog::sink_ptr> sinks, size_t capacity = kDefaultCapacity);
+            ~AsyncRingBufferSink() override;
+
+            AsyncRingBufferSink(const AsyncRingBufferSink&  that)   = delete;
+            AsyncRingBufferSink(AsyncRingBufferSink&&       that)   = delete;
+            void operator=(const AsyncRingBufferSink&  that)        = delete;
+            void operator=(const AsyncRingBufferSink&& that)        = delete;
+
+            static std::shared_ptr<AsyncRingBufferSink> Install(spdlog::logger& logger, size_t capacity = kDefaultCapacity);
+
+            size_t                              get_capacity()          const;
+            size_t                              get_dropped_records()   const;
+
+            void                                log(const spdlog::details::log_msg& msg)                override;
+            void                                flush()                                                 override;
+            void                                set_pattern(const std::string& pattern)                 override;
+            void                                set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) override;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,314 @@
+#ifndef IMPROC_CORECV_BOUNDED_QUEUE_HPP
+#define IMPROC_CORECV_BOUNDED_QUEUE_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/corecv/logger_improc.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <thread>
+
+namespace improc
+{
+    /**
+     * @brief Behavior of a bounded queue when an item is pushed while the queue is full
+     */
+    enum class BackpressurePolicy
+    {
+            kBlock      = 0
+        ,   kDropOldest = 1
+    };
+
+    /**
+     * @brief Bounded lock-free multi-producer multi-consumer queue
+     *
+     * Items are moved into fixed slots of a ring buffer, each guarded by a sequence number, so that
+     * pushing and popping do not lock. Blocking calls poll the ring buffer, yielding first and then
+     * sleeping for a short time, until they succeed or the queue is closed. A closed queue rejects new
+     * items and hands out the remaining ones.
+     *
+     * @tparam ItemType - item data type. Should be default constructible and movable.
+     */
+    template <typename ItemType>
+    class BoundedQueue final
+    {
+        public:
+            static constexpr size_t                     kNumberYields   = 64;
+            static constexpr std::chrono::microseconds  kWaitTime       {50};
+
+            /**
+             * @brief Queue counters. Occupancy is the number of items in the queue after each push.
+             */
+            struct Statistics
+            {
+                size_t                                  pushed;
+                size_t                                  popped;
+                size_t                                  dropped;
+                size_t                                  max_occupancy;
+                double                                  mean_occupancy;
+            };
+
+        private:
+            struct alignas(64) Slot
+            {
+                std::atomic<size_t>                     sequence;
+                ItemType                                item;
+            };
+
+            std::unique_ptr<Slot[]>                     slots_;
+            size_t                                      mask_;
+            BackpressurePolicy                          backpressure_policy_;
+            alignas(64) std::atomic<size_t>             enqueue_pos_;
+            alignas(64) std::atomic<size_t>             dequeue_pos_;
+            std::atomic<bool>                           is_closed_;
+            std::atomic<size_t>                         pushed_;
+            std::atomic<size_t>                         popped_;
+            std::atomic<size_t>                         dropped_;
+            std::atomic<size_t>                         occupancy_sum_;
+            std::atomic<size_t>                         max_occupancy_;
+
+            /**
+             * @brief Wait before polling the ring buffer again
+             */
+            static void                                 Wait(size_t& number_tries)
+            {
+                if (++number_tries < kNumberYields)
+                {
+                    std::this_thread::yield();
+                }
+                else
+                {
+                    std::this_thread::sleep_for(kWaitTime);
+                }
+            }
+
+            void                                        RecordOccupancy()
+            {
+                const size_t kDequeuePosition = this->dequeue_pos_.load(std::memory_order_relaxed);
+                const size_t kEnqueuePosition = this->enqueue_pos_.load(std::memory_order_relaxed);
+                const size_t kOccupancy       = kEnqueuePosition > kDequeuePosition ? kEnqueuePosition - kDequeuePosition : 0;
+                this->occupancy_sum_.fetch_add(kOccupancy,std::memory_order_relaxed);
+                size_t max_occupancy = this->max_occupancy_.load(std::memory_order_relaxed);
+                while (kOccupancy > max_occupancy && this->max_occupancy_.compare_exchange_weak(max_occupancy,kOccupancy,std::memory_order_relaxed) == false);
+            }
+
+            /**
+             * @brief Move oldest item out of the ring buffer without updating the counters
+             */
+            std::optional<ItemType>                     Dequeue()
+            {
+                size_t position = this->dequeue_pos_.load(std::memory_order_relaxed);
+                Slot* slot = nullptr;
+                while (true)
+                {
+                    slot = &this->slots_[position & this->mask_];
+                    const size_t   kSequence   = slot->sequence.load(std::memory_order_acquire);
+                    const intptr_t kDifference = static_cast<intptr_t>(kSequence) - static_cast<intptr_t>(position + 1);
+                    if (kDifference == 0)
+                    {
+                        if (this->dequeue_pos_.compare_exchange_weak(position,position + 1,std::memory_order_relaxed) == true)
+                        {
+                            break;
+                        }
+                    }
+                    else if (kDifference < 0)
+                    {
+                        return std::nullopt;
+                    }
+                    else
+                    {
+                        position = this->dequeue_pos_.load(std::memory_order_relaxed);
+                    }
+                }
+
+                // Slot is reset, so that resources of the item are not kept by the ring buffer
+                std::optional<ItemType> item {std::move(slot->item)};
+                slot->item = ItemType();
+                slot->sequence.store(position + this->mask_ + 1,std::memory_order_release);
+                return item;
+            }
+
+        public:
+            /**
+             * @brief Construct a new improc::BoundedQueue object
+             *
+             * @param capacity - maximum number of items in the queue. Should be a power of two.
+             * @param backpressure_policy - behavior of Push when the queue is full
+             */
+            explicit BoundedQueue(size_t capacity, BackpressurePolicy backpressure_policy = BackpressurePolicy::kBlock)
+                : slots_(nullptr)
+                , mask_(0)
+                , backpressure_policy_(backpressure_policy)
+                , enqueue_pos_(0)
+                , dequeue_pos_(0)
+                , is_closed_(false)
+                , pushed_(0)
+                , popped_(0)
+                , dropped_(0)
+                , occupancy_sum_(0)
+                , max_occupancy_(0)
+            {
+                IMPROC_CORECV_LOGGER_TRACE("Creating bounded queue with capacity {}...",capacity);
+                if (capacity < 2 || (capacity & (capacity - 1)) != 0)
+                {
+                    std::string error_message = fmt::format("Invalid queue capacity {}. Capacity should be a power of two.",capacity);
+                    IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+                    throw improc::value_error(std::move(error_message));
+                }
+
+                this->slots_ = std::make_unique<Slot[]>(capacity);
+                this->mask_  = capacity - 1;
+                for (size_t slot_idx = 0; slot_idx < capacity; ++slot_idx)
+                {
+                    this->slots_[slot_idx].sequence.store(slot_idx,std::memory_order_relaxed);
+                }
+            }
+
+            BoundedQueue(const BoundedQueue&  that)     = delete;
+            BoundedQueue(BoundedQueue&&       that)     = delete;
+            void operator=(const BoundedQueue&  that)   = delete;
+            void operator=(const BoundedQueue&& that)   = delete;
+
+            /**
+             * @brief Move item into the queue without waiting
+             *
+             * @return bool - false if the queue is full. Item is not moved in that case.
+             */
+            bool                                        TryPush(ItemType& item)
+            {
+                size_t position = this->enqueue_pos_.load(std::memory_order_relaxed);
+                Slot* slot = nullptr;
+                while (true)
+                {
+                    slot = &this->slots_[position & this->mask_];
+                    const size_t   kSequence   = slot->sequence.load(std::memory_order_acquire);
+                    const intptr_t kDifference = static_cast<intptr_t>(kSequence) - static_cast<intptr_t>(position);
+                    if (kDifference == 0)
+                    {
+                        if (this->enqueue_pos_.compare_exchange_weak(position,position + 1,std::memory_order_relaxed) == true)
+                        {
+                            break;
+                        }
+                    }
+                    else if (kDifference < 0)
+                    {
+                        return false;
+                    }
+                    else
+                    {
+                        position = this->enqueue_pos_.load(std::memory_order_relaxed);
+                    }
+                }
+
+                slot->item = std::move(item);
+                slot->sequence.store(position + 1,std::memory_order_release);
+                this->pushed_.fetch_add(1,std::memory_order_relaxed);
+                this->RecordOccupancy();
+                return true;
+            }
+
+            /**
+             * @brief Move oldest item out of the queue without waiting
+             *
+             * @return std::optional<ItemType> - empty if the queue is empty
+             */
+            std::optional<ItemType>                     TryPop()
+            {
+                std::optional<ItemType> item = this->Dequeue();
+                if (item.has_value() == true)
+                {
+                    this->popped_.fetch_add(1,std::memory_order_relaxed);
+                }
+                return item;
+            }
+
+            /**
+             * @brief Move item into the queue. When the queue is full, waits for a free slot or drops the oldest item according to the backpressure policy.
+             *
+             * @return bool - false if the queue is closed. Item is not moved in that case.
+             */
+            bool                                        Push(ItemType& item)
+            {
+                size_t number_tries = 0;
+                while (this->is_closed_.load(std::memory_order_acquire) == false)
+                {
+                    if (this->TryPush(item) == true)
+                    {
+                        return true;
+                    }
+                    if (this->backpressure_policy_ == BackpressurePolicy::kDropOldest)
+                    {
+                        if (this->Dequeue().has_value() == true)
+                        {
+                            this->dropped_.fetch_add(1,std::memory_order_relaxed);
+                        }
+                    }
+                    else
+                    {
+                        Wait(number_tries);
+                    }
+                }
+                return false;
+            }
+
+            /**
+             * @brief Move oldest item out of the queue, waiting until an item is available
+             *
+             * @return std::optional<ItemType> - empty if the queue is closed and empty
+             */
+            std::optional<ItemType>                     Pop()
+            {
+                size_t number_tries = 0;
+                while (true)
+                {
+                    std::optional<ItemType> item = this->TryPop();
+                    if (item.has_value() == true)
+                    {
+                        return item;
+                    }
+                    if (this->is_closed_.load(std::memory_order_acquire) == true)
+                    {
+                        // Items pushed before the queue was closed are still handed out
+                        return this->TryPop();
+                    }
+                    Wait(number_tries);
+                }
+            }
+
+            /**
+             * @brief Reject new items. Remaining items can still be popped.
+             */
+            void                                        Close()
+            {
+                this->is_closed_.store(true,std::memory_order_release);
+            }
+
+            bool                                        IsClosed()      const
+            {
+                return this->is_closed_.load(std::memory_order_acquire);
+            }
+
+            size_t                                      get_capacity()  const
+            {
+                return this->mask_ + 1;
+            }
+
+            /**
+             * @brief Obtain queue counters
+             */
+            Statistics                                  GetStatistics() const
+            {
+                const size_t kPushed = this->pushed_.load(std::memory_order_relaxed);
+                return { kPushed
+                       , this->popped_.load(std::memory_order_relaxed)
+                       , this->dropped_.load(std::memory_order_relaxed)
+                       , this->max_occupancy_.load(std::memory_order_relaxed)
+                       , kPushed == 0 ? 0.0 : static_cast<double>(this->occupancy_sum_.load(std::memory_order_relaxed)) / static_cast<double>(kPushed) };
+            }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,56 @@
+#ifndef IMPROC_CORECV_CONTEXT_IMAGE_HPP
+#define IMPROC_CORECV_CONTEXT_IMAGE_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/image.hpp>
+#include <improc/corecv/structures/color_space.hpp>
+
+#include <opencv2/core.hpp>
+
+#include <any>
+#include <optional>
+
+namespace improc
+{
+    /**
+     * @brief Image handoff between services through context values
+     *
+     * Context values may hold image data, an image or a color space image. Inputs are read by reference,
+     * so that consecutive services do not wrap and validate the same image data again. Outputs are moved
+     * into the context value, reusing the stored object when it already has the same type.
+     */
+    class IMPROC_API ContextImage final
+    {
+        public:
+            static const cv::Mat&               GetData(const std::any& context_value);
+            static std::optional<ColorSpace>    GetColorSpace(const std::any& context_value);
+
+            static void                         SetData(std::any& context_value, cv::Mat&& image_data, const std::optional<ColorSpace>& color_space = std::nullopt);
+
+            /**
+             * @brief Move image into context value. Stored image is reused if it has the same type.
+             *
+             * @param context_value - context value receiving the image
+             * @param image - image moved into the context value
+             */
+            template <typename ImageType>
+            static void                         Set(std::any& context_value, ImageType&& image)
+            {
+                using StoredType = std::decay_t<ImageType>;
+                static_assert(std::is_base_of_v<Image,StoredType>,"Set not defined for image type");
+                StoredType* stored_image = std::any_cast<StoredType>(&context_value);
+                if (stored_image != nullptr)
+                {
+                    *stored_image = std::forward<ImageType>(image);
+                }
+                else
+                {
+                    context_value.emplace<StoredType>(std::forward<ImageType>(image));
+                }
+            }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,81 @@
+#ifndef IMPROC_CORECV_DEFERRED_IMAGE_HPP
+#define IMPROC_CORECV_DEFERRED_IMAGE_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/image.hpp>
+#include <improc/corecv/structures/color_space.hpp>
+#include <improc/corecv/structures/interpolation_type.hpp>
+#include <improc/corecv/structures/rotation_type.hpp>
+
+#include <opencv2/core.hpp>
+
+#include <vector>
+
+namespace improc
+{
+    /**
+     * @brief Color space image with operations recorded and executed on materialization
+     *
+     * Crops, rotations, resizes and color conversions are recorded without touching the image data. On
+     * materialization, crops and rotations are composed and the operations are executed for each output
+     * tile, from the source region read by the tile to the output, so the image is read and written once
+     * instead of once for each operation. Color conversions commute with crops and rotations and are moved
+     * across resizes when the result does not change, so downscaled images are converted after the resize
+     * and upscaled images before it unless the conversion adds channels. Linear and nearest resizes use
+     * precomputed coefficients, so that each tile gives the same image as resizing the whole image. Cubic
+     * resizes and consecutive resizes split the operations into stages that are materialized in turn. YUV
+     * images are not supported.
+     */
+    class IMPROC_API DeferredImage final
+    {
+        public:
+            static constexpr int                kTileSize = 64;
+
+            enum class OperationType : unsigned int
+            {
+                    kCrop               = 0
+                ,   kRotation           = 1
+                ,   kResize             = 2
+                ,   kColorConversion    = 3
+            };
+
+            /**
+             * @brief Recorded operation. Only the fields of the operation type are used.
+             */
+            struct Operation
+            {
+                OperationType                   type;
+                cv::Rect                        region;
+                RotationType                    rotation;
+                cv::Size                        image_size;
+                InterpolationType               interpolation;
+                ColorSpace                      color_space;
+            };
+
+        private:
+            ColorSpaceImage                     image_;
+            cv::Size                            image_size_;
+            ColorSpace                          color_space_;
+            std::vector<Operation>              operations_;
+
+        public:
+            DeferredImage();
+            explicit DeferredImage(const ColorSpaceImage& image);
+
+            cv::Size                            get_image_size()    const;
+            ColorSpace                          get_color_space()   const;
+            const std::vector<Operation>&       get_operations()    const;
+
+            void                                Crop(const cv::Rect& region);
+            void                                Rotate(const RotationType& rotation);
+            void                                Resize(const cv::Size&   to_image_size, const InterpolationType& interpolation);
+            void                                Resize(const cv::Size2d& scaling,       const InterpolationType& interpolation);
+            void                                ConvertToColorSpace(const ColorSpace& to_color_space);
+
+            ColorSpaceImage                     Materialize();
+    };
+}
+
+#endif
\ No newline at end of file
@@ -4,6 +4,9 @@
 #include <improc/improc_defs.hpp>
 #include <improc/exception.hpp>
 #include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/image_allocator.hpp>
+#include <improc/corecv/kernels/channel_swizzle.hpp>
+#include <improc/corecv/kernels/color_lookup_table.hpp>
 #include <improc/corecv/structures/color_space.hpp>
 #include <improc/corecv/structures/interpolation_type.hpp>
 
@@ -20,14 +23,16 @@ namespace improc {
         public:
             Image();
             explicit Image(const cv::Mat& image_data);
+            explicit Image(cv::Mat&& image_data);
 
             void                        set_data(const cv::Mat& image_data);
-            cv::Mat                     get_data()  const;
+            void                        set_data(cv::Mat&& image_data);
+            const cv::Mat&              get_data()  const;
 
             Image                       Clone()     const;
 
-            // void                        Resize(const cv::Size&   to_image_size, const InterpolationType& interpolation);
-            // void                        Resize(const cv::Size2d& scaling,       const InterpolationType& interpolation);
+            void                        Resize(const cv::Size&   to_image_size, const InterpolationType& interpolation);
+            void                        Resize(const cv::Size2d& scaling,       const InterpolationType& interpolation);
     };
 
 
@@ -41,7 +46,14 @@ namespace improc {
             ColorSpaceImage();
 
             template <typename ColorSpaceType = improc::ColorSpace::Value>
-            ColorSpaceImage(const cv::Mat& image_data, const ColorSpaceType& color_space) : Image(std::move(image_data))
+            ColorSpaceImage(const cv::Mat& image_data, const ColorSpaceType& color_space) : Image(image_data)
+            {
+                IMPROC_CORECV_LOGGER_TRACE("Creating color space image object...");    
+                this->set_color_space(color_space);
+            }
+
+            template <typename ColorSpaceType = improc::ColorSpace::Value>
+            ColorSpaceImage(cv::Mat&& image_data, const ColorSpaceType& color_space) : Image(std::move(image_data))
             {
                 IMPROC_CORECV_LOGGER_TRACE("Creating color space image object...");    
                 this->set_color_space(color_space);
@@ -72,13 +84,26 @@ namespace improc {
                     IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
                     throw improc::value_error(std::move(error_message));
                 }
+                if (color_space_object.IsValidDataSize(this->data_.size()) == false)
+                {
+                    std::string error_message = fmt::format ( "Invalid image size {}x{} for {} color space. Chroma planes do not match the luma plane."
+                                                            , this->data_.cols, this->data_.rows, color_space_object.ToString() );
+                    IMPROC_CORECV_LOGGER_ERROR("ERROR_02: " + error_message);
+                    throw improc::value_error(std::move(error_message));
+                }
                 this->color_space_ = color_space_object;
             }
 
+            void                        set_data(const cv::Mat& image_data);
+            void                        set_data(cv::Mat&& image_data);
+
             ColorSpace                  get_color_space()   const;
 
             ColorSpaceImage             Clone()             const;
 
+            void                        Resize(const cv::Size&   to_image_size, const InterpolationType& interpolation);
+            void                        Resize(const cv::Size2d& scaling,       const InterpolationType& interpolation);
+
             template <typename ColorSpaceType = improc::ColorSpace::Value>
             void                        ConvertToColorSpace(const ColorSpaceType& to_color_space)
             {
@@ -90,11 +115,175 @@ namespace improc {
                 }
                 else
                 {
-                    cv::cvtColor(this->data_,this->data_,this->color_space_.GetColorConversionCode(to_color_space));
+                    cv::Mat converted_data = improc::ImageAllocator::get().CreateMat();
+                    const improc::ColorSpace kToColorSpace {to_color_space};
+                    if (improc::ChannelSwizzle::IsEnabled() == true && improc::ChannelSwizzle::IsSwizzle(this->color_space_,kToColorSpace) == true)
+                    {
+                        improc::ChannelSwizzle(this->color_space_,kToColorSpace).Apply(this->data_,converted_data);
+                    }
+                    else if ( improc::ColorLookupTable::GetMode() != improc::ColorLookupTable::Mode::kDisabled && this->data_.depth() == CV_8U
+                           && improc::ColorLookupTable::IsSupported(this->color_space_,kToColorSpace) == true )
+                    {
+                        improc::ColorLookupTable::Get(this->color_space_,kToColorSpace,improc::ColorLookupTable::GetMode()).Apply(this->data_,converted_data);
+                    }
+                    else
+                    {
+                        cv::cvtColor(this->data_,converted_data,this->color_space_.GetColorConversionCode(to_color_space));
+                    }
+                    this->data_ = std::move(converted_data);
                     this->set_color_space(to_color_space);
                 }
             }
     };
+
+    /**
+     * @brief Color space image with color space fixed at compile time
+     *
+     * The number of channels is checked once when image data is set. Conversion codes are resolved
+     * at compile time, so conversions to the same color space or between undefined color spaces do
+     * not compile and no color space dispatch is performed for each image. Image is inherited privately,
+     * so that image data cannot be set without the check through a reference to Image.
+     *
+     * @tparam kColorSpace - image color space
+     */
+    template <ColorSpace::Value kColorSpace>
+    class TypedColorSpaceImage : private Image
+    {
+        template <ColorSpace::Value kOtherColorSpace>
+        friend class TypedColorSpaceImage;
+
+        private:
+            struct UncheckedTag {};
+
+            /**
+             * @brief Construct a new improc::TypedColorSpaceImage object from image data produced by a conversion
+             */
+            TypedColorSpaceImage(cv::Mat&& image_data, UncheckedTag) : Image()
+            {
+                this->data_ = std::move(image_data);
+            }
+
+        public:
+            static constexpr unsigned int kNumberChannels = ColorSpace(kColorSpace).GetNumberChannels();
+
+            using Image::get_data;
+
+            TypedColorSpaceImage() : Image() {}
+
+            /**
+             * @brief Construct a new improc::TypedColorSpaceImage object
+             * 
+             * @param image_data - 8-bit image data with the number of channels of the color space
+             */
+            explicit TypedColorSpaceImage(const cv::Mat& image_data) : Image()
+            {
+                IMPROC_CORECV_LOGGER_TRACE("Creating {} typed color space image object...",ColorSpace(kColorSpace).ToString());
+                this->set_data(image_data);
+            }
+
+            /**
+             * @brief Construct a new improc::TypedColorSpaceImage object from a color space image
+             * 
+             * @param image - color space image with the same color space
+             */
+            explicit TypedColorSpaceImage(const ColorSpaceImage& image) : Image()
+            {
+                IMPROC_CORECV_LOGGER_TRACE("Creating {} typed color space image object from color space image...",ColorSpace(kColorSpace).ToString());
+                if (image.get_color_space() != kColorSpace)
+                {
+                    std::string error_message = fmt::format ( "Invalid color space for typed image. Expected {} received {}."
+                                                            , ColorSpace(kColorSpace).ToString(), image.get_color_space().ToString() );
+                    IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+                    throw improc::value_error(std::move(error_message));
+                }
+                this->data_ = image.get_data();
+            }
+
+            /**
+             * @brief Set image data. Image data should have the number of channels of the color space
+             * and, for YUV color spaces, chroma planes that match the luma plane.
+             * 
+             * @param image_data - 8-bit image data
+             */
+            void                        set_data(const cv::Mat& image_data)
+            {
+                if (static_cast<unsigned int>(image_data.channels()) != kNumberChannels)
+                {
+                    std::string error_message = fmt::format ( "Invalid image for typed color space image. Color space {} expects {} channels but image has {}."
+                                                            , ColorSpace(kColorSpace).ToString(), kNumberChannels, image_data.channels() );
+                    IMPROC_CORECV_LOGGER_ERROR("ERROR_02: " + error_message);
+                    throw improc::value_error(std::move(error_message));
+                }
+                if constexpr (ColorSpace(kColorSpace).IsYUV() == true)
+                {
+                    if (ColorSpace(kColorSpace).IsValidDataSize(image_data.size()) == false)
+                    {
+                        std::string error_message = fmt::format ( "Invalid image size {}x{} for {} typed color space image. Chroma planes do not match the luma plane."
+                                                                , image_data.cols, image_data.rows, ColorSpace(kColorSpace).ToString() );
+                        IMPROC_CORECV_LOGGER_ERROR("ERROR_03: " + error_message);
+                        throw improc::value_error(std::move(error_message));
+                    }
+                }
+                this->Image::set_data(image_data);
+            }
+
+            /**
+             * @brief Obtain color space
+             */
+            static constexpr ColorSpace get_color_space()
+            {
+                return ColorSpace(kColorSpace);
+            }
+
+            /**
+             * @brief Obtain runtime color space image sharing the image data
+             */
+            ColorSpaceImage             ToColorSpaceImage() const
+            {
+                IMPROC_CORECV_LOGGER_TRACE("Obtaining color space image from typed color space image...");
+                return ColorSpaceImage(this->data_,kColorSpace);
+            }
+
+            TypedColorSpaceImage        Clone()             const
+            {
+                IMPROC_CORECV_LOGGER_TRACE("Cloning typed color space image object...");
+                cv::Mat cloned_data = this->Image::Clone().get_data();
+                return TypedColorSpaceImage(std::move(cloned_data),UncheckedTag {});
+            }
+
+            /**
+             * @brief Convert image to color space
+             * 
+             * @tparam kToColorSpace - target color space. Should be different from the image color space.
+             */
+            template <ColorSpace::Value kToColorSpace>
+            TypedColorSpaceImage<kToColorSpace> ConvertToColorSpace() const
+            {
+                static_assert(kColorSpace != kToColorSpace,"Source and target color space are the same");
+                static constexpr cv::ColorConversionCodes kConversionCode = ColorSpace(kColorSpace).GetColorConversionCode(kToColorSpace);
+
+                IMPROC_CORECV_LOGGER_TRACE  ( "Converting typed color space image from {} to {}..."
+                                            , ColorSpace(kColorSpace).ToString(), ColorSpace(kToColorSpace).ToString() );
+                static const bool kIsSwizzle     = ChannelSwizzle::IsSwizzle(ColorSpace(kColorSpace),ColorSpace(kToColorSpace));
+                static const bool kIsLookupTable = ColorLookupTable::IsSupported(ColorSpace(kColorSpace),ColorSpace(kToColorSpace));
+                cv::Mat converted_data = improc::ImageAllocator::get().CreateMat();
+                if (kIsSwizzle == true && improc::ChannelSwizzle::IsEnabled() == true)
+                {
+                    static const ChannelSwizzle kChannelSwizzle {ColorSpace(kColorSpace),ColorSpace(kToColorSpace)};
+                    kChannelSwizzle.Apply(this->data_,converted_data);
+                }
+                else if ( kIsLookupTable == true && improc::ColorLookupTable::GetMode() != improc::ColorLookupTable::Mode::kDisabled
+                       && this->data_.depth() == CV_8U )
+                {
+                    ColorLookupTable::Get(ColorSpace(kColorSpace),ColorSpace(kToColorSpace),improc::ColorLookupTable::GetMode()).Apply(this->data_,converted_data);
+                }
+                else
+                {
+                    cv::cvtColor(this->data_,converted_data,kConversionCode);
+                }
+                return TypedColorSpaceImage<kToColorSpace>(std::move(converted_data),typename TypedColorSpaceImage<kToColorSpace>::UncheckedTag {});
+            }
+    };
 }
 
 #endif
\ No newline at end of file
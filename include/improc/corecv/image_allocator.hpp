@@ -0,0 +1,83 @@
+#ifndef IMPROC_CORECV_IMAGE_ALLOCATOR_HPP
+#define IMPROC_CORECV_IMAGE_ALLOCATOR_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/corecv/logger_improc.hpp>
+
+#include <opencv2/core.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace improc
+{
+    /**
+     * @brief Pooled allocator for image buffers
+     *
+     * Opt-in OpenCV allocator that recycles image buffers. Rows are aligned to kRowAlignment bytes and
+     * buffers are returned to the pool when the last cv::Mat referencing them is released. Buffers are
+     * keyed by their size in bytes, which is given by the image size and type.
+     */
+    class IMPROC_API ImageAllocator final : public cv::MatAllocator
+    {
+        public:
+            static constexpr size_t             kRowAlignment           = 64;
+            static constexpr size_t             kDefaultMaxCachedBytes  = 512 * 1024 * 1024;
+
+            /**
+             * @brief Pool usage counters
+             */
+            struct Statistics
+            {
+                size_t                          hits;
+                size_t                          misses;
+                size_t                          cached_buffers;
+                size_t                          cached_bytes;
+            };
+
+        private:
+            struct Buffer
+            {
+                uchar*                          origdata;
+                uchar*                          data;
+            };
+
+            mutable std::mutex                  mutex_;
+            mutable std::unordered_map<size_t,std::vector<Buffer>> buffers_;
+            mutable size_t                      cached_bytes_;
+            mutable std::atomic<size_t>         hits_;
+            mutable std::atomic<size_t>         misses_;
+            std::atomic<bool>                   enabled_;
+            std::atomic<size_t>                 max_cached_bytes_;
+
+            ImageAllocator();
+
+        public:
+            ImageAllocator(const ImageAllocator&  that)     = delete;
+            ImageAllocator(ImageAllocator&&       that)     = delete;
+            void operator=(const ImageAllocator&  that)     = delete;
+            void operator=(const ImageAllocator&& that)     = delete;
+
+            static ImageAllocator&              get();
+
+            void                                Enable(size_t max_cached_bytes = kDefaultMaxCachedBytes);
+            void                                Disable();
+            bool                                IsEnabled()         const;
+
+            cv::Mat                             CreateMat()         const;
+            cv::Mat                             CreateMat(const cv::Size& size, int type) const;
+
+            Statistics                          GetStatistics()     const;
+            void                                ResetStatistics();
+            void                                Clear();
+
+            cv::UMatData*                       allocate( int dims, const int* sizes, int type, void* data, size_t* step
+                                                        , cv::AccessFlag flags, cv::UMatUsageFlags usage_flags )                const override;
+            bool                                allocate(cv::UMatData* data, cv::AccessFlag access_flags, cv::UMatUsageFlags usage_flags) const override;
+            void                                deallocate(cv::UMatData* data)  const override;
+    };
+}
+
+#endif
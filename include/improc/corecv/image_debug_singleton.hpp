@@ -1,48 +1,99 @@
-#ifndef IMPROC_CORECV_IMAGE_DEBUG_SINGLETON_H
-#define IMPROC_CORECV_IMAGE_DEBUG_SINGLETON_H
+#ifndef IMPROC_CORECV_IMAGE_DEBUG_SINGLETON_HPP
+#define IMPROC_CORECV_IMAGE_DEBUG_SINGLETON_HPP
 
-#include <improc/improc_defs.h>
-#include <improc/corecv/image.h>
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/image.hpp>
+#include <improc/corecv/structures/image_format.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 
 namespace improc {
-    // TODO: Review implementation and add tests
     /**
-     * @brief Singleton template for image debugging
-     * 
-     * @tparam type 
+     * @brief Singleton for image debugging
+     *
+     * Capturing an image only hands a reference to its data to a bounded queue. A background thread
+     * encodes the queued images with their image format and writes them to their filepath. When the
+     * queue is full, images are dropped according to the overflow policy, so that capturing never
+     * blocks the calling thread. Image data is shared with the caller, so captured images should not
+     * be modified in-place after being captured.
      */
-    template <typename type>
-    class IMPROC_API ImageDebugSingleton
+    class IMPROC_API ImageDebugSingleton final
     {
         public:
+            static constexpr size_t             kDefaultCapacity    = 16;
+
+            /**
+             * @brief Images dropped when the queue is full
+             */
+            enum class OverflowPolicy
+            {
+                    kDropOldest = 0
+                ,   kDropNewest = 1
+            };
+
             struct DebugImage
             {
                 Image                           image;
                 std::string                     filepath;
+                ImageFormat                     image_format;
+            };
+
+            /**
+             * @brief Debug image counters
+             */
+            struct Statistics
+            {
+                size_t                          captured;
+                size_t                          written;
+                size_t                          dropped;
+                size_t                          failed;
             };
-            
+
         private:
-            DebugImage                          data_;
-            std::vector<DebugImage>             history_;
+            mutable std::mutex                  mutex_;
+            std::condition_variable             queue_condition_;
+            std::condition_variable             idle_condition_;
+            std::deque<DebugImage>              queue_;
+            size_t                              capacity_;
+            OverflowPolicy                      overflow_policy_;
+            std::atomic<bool>                   enabled_;
+            bool                                is_running_;
+            bool                                is_writing_;
+            Statistics                          statistics_;
+            std::thread                         worker_;
 
-        protected:
             ImageDebugSingleton();
-            
+
+            void                                Write();
+
         public:
+            ~ImageDebugSingleton();
+
             ImageDebugSingleton(ImageDebugSingleton&   that) = delete;
             ImageDebugSingleton(ImageDebugSingleton&&  that) = delete;
             void operator=(const ImageDebugSingleton&  that) = delete;
             void operator=(const ImageDebugSingleton&& that) = delete;
 
-            static ImageDebugSingleton          get();
+            static ImageDebugSingleton&         get();
 
-            DebugImage                          data()     const;
-            void                                set_data(const DebugImage& image);
-            void                                Revert();
-            void                                Clear();
+            void                                Enable( size_t capacity = kDefaultCapacity
+                                                      , OverflowPolicy overflow_policy = OverflowPolicy::kDropOldest );
+            void                                Disable();
+            bool                                IsEnabled()         const;
+
+            bool                                Capture( const Image& image, const std::string& filepath
+                                                       , const ImageFormat& image_format = ImageFormat() );
+            void                                Flush();
+
+            Statistics                          GetStatistics()     const;
+            void                                ResetStatistics();
     };
 }
 
-#include <improc/corecv/image_debug_singleton.tpp>
-
 #endif
\ No newline at end of file
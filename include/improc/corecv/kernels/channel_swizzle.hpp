@@ -0,0 +1,60 @@
+#ifndef IMPROC_CORECV_CHANNEL_SWIZZLE_HPP
+#define IMPROC_CORECV_CHANNEL_SWIZZLE_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/structures/color_space.hpp>
+
+#include <opencv2/core.hpp>
+
+#include <array>
+#include <atomic>
+
+namespace improc
+{
+    /**
+     * @brief Channel swizzle kernel for color conversions that only reorder, add or drop channels
+     *
+     * Conversions between RGB, BGR, RGBA and BGRA and from Gray to color are byte shuffles.
+     * The kernel selects at runtime the widest instruction set supported by the CPU and
+     * produces the same image as cv::cvtColor. It can be disabled to force the OpenCV path.
+     */
+    class IMPROC_API ChannelSwizzle final
+    {
+        public:
+            enum class InstructionSet : unsigned int
+            {
+                    kScalar     = 0
+                ,   kSSE41      = 1
+                ,   kAVX2       = 2
+                ,   kAVX512BW   = 3
+            };
+
+            static constexpr int                kAlphaChannel = -1;
+
+        private:
+            ColorSpace                          from_color_space_;
+            ColorSpace                          to_color_space_;
+            std::array<int,4>                   channel_map_;
+
+            static std::atomic<bool>            enabled_;
+
+        public:
+            ChannelSwizzle(const ColorSpace& from_color_space, const ColorSpace& to_color_space);
+
+            static bool                         IsSwizzle(const ColorSpace& from_color_space, const ColorSpace& to_color_space);
+
+            static void                         Enable();
+            static void                         Disable();
+            static bool                         IsEnabled();
+
+            static InstructionSet               GetInstructionSet();
+            static bool                         IsInstructionSetSupported(InstructionSet instruction_set);
+
+            void                                Apply(const cv::Mat& image, cv::Mat& swizzled_image) const;
+            void                                Apply(const cv::Mat& image, cv::Mat& swizzled_image, InstructionSet instruction_set) const;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,62 @@
+#ifndef IMPROC_CORECV_COLOR_LOOKUP_TABLE_HPP
+#define IMPROC_CORECV_COLOR_LOOKUP_TABLE_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/structures/color_space.hpp>
+
+#include <opencv2/core.hpp>
+
+#include <atomic>
+
+namespace improc
+{
+    /**
+     * @brief 3D lookup table for color conversions from RGB and BGR to HSV and Lab
+     *
+     * The table stores the cv::cvtColor result for 8-bit colors. The full table has one entry for each of
+     * the 16M colors and gives the same image as cv::cvtColor. The trilinear table has one entry every
+     * kGridStep values of each channel and interpolates the entries around each color, with hue
+     * interpolated along the shortest arc. Tables are built once per process on first use and shared
+     * between threads. Color space images use the tables when a mode is set, which is disabled by default.
+     */
+    class IMPROC_API ColorLookupTable final
+    {
+        public:
+            enum class Mode : unsigned int
+            {
+                    kDisabled   = 0
+                ,   kTrilinear  = 1
+                ,   kFull       = 2
+            };
+
+            static constexpr int                kGridStep       = 8;
+            static constexpr int                kGridNodes      = 256 / kGridStep + 1;
+
+        private:
+            ColorSpace                          from_color_space_;
+            ColorSpace                          to_color_space_;
+            Mode                                mode_;
+            cv::Mat                             table_;
+
+            static std::atomic<Mode>            default_mode_;
+
+            ColorLookupTable(const ColorSpace& from_color_space, const ColorSpace& to_color_space, Mode mode);
+
+        public:
+            static bool                         IsSupported(const ColorSpace& from_color_space, const ColorSpace& to_color_space);
+            static const ColorLookupTable&      Get(const ColorSpace& from_color_space, const ColorSpace& to_color_space, Mode mode);
+
+            static void                         SetMode(Mode mode);
+            static Mode                         GetMode();
+
+            ColorSpace                          get_from_color_space()  const;
+            ColorSpace                          get_to_color_space()    const;
+            Mode                                get_mode()              const;
+
+            void                                Apply(const cv::Mat& image, cv::Mat& converted_image) const;
+    };
+}
+
+#endif
\ No newline at end of file
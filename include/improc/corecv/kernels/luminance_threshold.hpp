@@ -0,0 +1,65 @@
+#ifndef IMPROC_CORECV_LUMINANCE_THRESHOLD_HPP
+#define IMPROC_CORECV_LUMINANCE_THRESHOLD_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/structures/color_space.hpp>
+#include <improc/corecv/structures/threshold_type.hpp>
+#include <improc/corecv/structures/integral_image.hpp>
+
+#include <opencv2/core.hpp>
+
+#include <array>
+
+namespace improc
+{
+    /**
+     * @brief Threshold of image luminance fused with gray conversion
+     *
+     * Luminance is computed for each pixel with the OpenCV fixed-point gray coefficients and is never
+     * stored as a gray image. Otsu threshold reads the image twice: a pass that accumulates a histogram
+     * for each image stripe and a pass that writes the binary image. Binary threshold only needs the
+     * second pass. Results are the same as cv::cvtColor followed by cv::threshold.
+     *
+     * Adaptive thresholds compare each pixel with a threshold computed from the square window centered at
+     * the pixel. Luminance is written to the destination image, its integral image gives the window sums in
+     * constant time and the destination is then thresholded in-place. Adaptive mean threshold uses the window
+     * mean minus an offset and Sauvola threshold uses mean * (1 + k * (standard deviation / 128 - 1)). Windows
+     * are clipped to the image.
+     */
+    class IMPROC_API LuminanceThreshold final
+    {
+        public:
+            static constexpr int                kHistogramSize          = 256;
+            static constexpr double             kSauvolaDynamicRange    = 128.0;
+
+            typedef std::array<size_t,kHistogramSize>   Histogram;
+
+        private:
+            ThresholdType                       threshold_type_;
+            double                              threshold_;
+            double                              max_value_;
+            int                                 window_size_;
+
+            void                                ApplyAdaptive(const cv::Mat& image, const ColorSpace& color_space, cv::Mat& threshold_image, IntegralImage* integral_image) const;
+
+        public:
+            LuminanceThreshold();
+            LuminanceThreshold(const ThresholdType& threshold_type, double threshold = 0.0, double max_value = 255.0, int window_size = 0);
+
+            static bool                         IsSupported(int image_type);
+            static Histogram                    ComputeHistogram(const cv::Mat& image, const ColorSpace& color_space);
+            static double                       ComputeOtsuThreshold(const Histogram& histogram);
+
+            ThresholdType                       get_threshold_type()    const;
+            double                              get_threshold()         const;
+            double                              get_max_value()         const;
+            int                                 get_window_size()       const;
+
+            double                              Apply( const cv::Mat& image, const ColorSpace& color_space, cv::Mat& threshold_image
+                                                     , IntegralImage* integral_image = nullptr ) const;
+    };
+}
+
+#endif
\ No newline at end of file
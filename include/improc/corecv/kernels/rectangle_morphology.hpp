@@ -0,0 +1,43 @@
+#ifndef IMPROC_CORECV_RECTANGLE_MORPHOLOGY_HPP
+#define IMPROC_CORECV_RECTANGLE_MORPHOLOGY_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/structures/morphological_oper.hpp>
+
+#include <opencv2/core.hpp>
+
+namespace improc
+{
+    /**
+     * @brief Morphological operations with rectangular kernels
+     *
+     * Rectangular kernels are separated in a row and a column pass. Each pass uses the van Herk/Gil-Werman
+     * running minimum or maximum, so the cost per pixel does not depend on the kernel size. Repeated
+     * iterations are folded into a single pass with an enlarged kernel, as done by OpenCV for rectangular
+     * kernels. Pixels outside the image are ignored, as with the OpenCV default border value, and the anchor
+     * is the kernel center.
+     */
+    class IMPROC_API RectangleMorphology final
+    {
+        private:
+            MorphologicalOper           oper_;
+            cv::Size                    kernel_size_;
+            cv::Point                   anchor_;
+
+        public:
+            RectangleMorphology();
+            RectangleMorphology(const MorphologicalOper& oper, const cv::Size& kernel_size, unsigned int number_iterations = 1);
+
+            static bool                 IsSupported(int image_type);
+
+            MorphologicalOper           get_oper()          const;
+            cv::Size                    get_kernel_size()   const;
+            cv::Point                   get_anchor()        const;
+
+            void                        Apply(const cv::Mat& image, cv::Mat& morphology_image) const;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,50 @@
+#ifndef IMPROC_CORECV_YUV_RESIZE_HPP
+#define IMPROC_CORECV_YUV_RESIZE_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/structures/color_space.hpp>
+#include <improc/corecv/structures/interpolation_type.hpp>
+#include <improc/corecv/structures/resize_coefficients.hpp>
+
+#include <opencv2/core.hpp>
+
+namespace improc
+{
+    /**
+     * @brief Conversion of YUV images to RGB fused with resize
+     *
+     * Luma and chroma are sampled at the target resolution and each target pixel is converted with the
+     * OpenCV fixed-point BT.601 coefficients, so that the full resolution RGB image is never stored.
+     * Nearest interpolation gives the same result as cv::cvtColor followed by cv::resize. Linear
+     * interpolation interpolates luma and chroma in their own planes, with chroma samples centered on
+     * their luma samples, before converting.
+     */
+    class IMPROC_API YUVResize final
+    {
+        private:
+            ColorSpace                          from_color_space_;
+            ColorSpace                          to_color_space_;
+            ResizeCoefficients                  luma_coefficients_;
+            ResizeCoefficients                  chroma_coefficients_;
+
+        public:
+            YUVResize();
+            YUVResize( const ColorSpace& from_color_space, const ColorSpace& to_color_space
+                     , const cv::Size& from_image_size, const cv::Size& to_image_size, const InterpolationType& interpolation );
+
+            static bool                         IsSupported( const ColorSpace& from_color_space, const ColorSpace& to_color_space
+                                                           , const InterpolationType& interpolation );
+
+            ColorSpace                          get_from_color_space()  const;
+            ColorSpace                          get_to_color_space()    const;
+            cv::Size                            get_from_image_size()   const;
+            cv::Size                            get_to_image_size()     const;
+            InterpolationType                   get_interpolation()     const;
+
+            void                                Apply(const cv::Mat& image, cv::Mat& resized_image) const;
+    };
+}
+
+#endif
\ No newline at end of file
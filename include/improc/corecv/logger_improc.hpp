@@ -21,41 +21,58 @@ namespace improc
             ImageProcLogger(ImageProcLogger&& that)       = delete;
             void operator=(const ImageProcLogger&  that)  = delete;
             void operator=(const ImageProcLogger&& that)  = delete;
+
+            static spdlog::logger*  GetThreadLogger();
+            static void             ReloadThreadLoggers();
     };
 }
 
+/**
+ * @brief Log record with image processing logger. The logger is cached for each thread until the thread loggers
+ * are reloaded and the level is checked before the arguments are evaluated and formatted.
+ */
+#define IMPROC_CORECV_LOGGER_CALL(level,...)                                                                            \
+    do                                                                                                                  \
+    {                                                                                                                   \
+        spdlog::logger* improc_corecv_logger = improc::ImageProcLogger::GetThreadLogger();                              \
+        if (improc_corecv_logger->should_log(level) == true)                                                            \
+        {                                                                                                               \
+            improc_corecv_logger->log(spdlog::source_loc{__FILE__,__LINE__,SPDLOG_FUNCTION},level,__VA_ARGS__);         \
+        }                                                                                                               \
+    } while (false)
+
 #if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_TRACE
-#    define IMPROC_CORECV_LOGGER_TRACE(...) IMPROC_LOGGER_TRACE(improc::ImageProcLogger::get(), __VA_ARGS__)
+#    define IMPROC_CORECV_LOGGER_TRACE(...) IMPROC_CORECV_LOGGER_CALL(spdlog::level::trace, __VA_ARGS__)
 #else
 #    define IMPROC_CORECV_LOGGER_TRACE(...) (void)0
 #endif
 
 #if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_DEBUG
-#    define IMPROC_CORECV_LOGGER_DEBUG(...) IMPROC_LOGGER_DEBUG(improc::ImageProcLogger::get(), __VA_ARGS__)
+#    define IMPROC_CORECV_LOGGER_DEBUG(...) IMPROC_CORECV_LOGGER_CALL(spdlog::level::debug, __VA_ARGS__)
 #else
 #    define IMPROC_CORECV_LOGGER_DEBUG(...) (void)0
 #endif
 
 #if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_INFO
-#    define IMPROC_CORECV_LOGGER_INFO(...) IMPROC_LOGGER_INFO(improc::ImageProcLogger::get(), __VA_ARGS__)
+#    define IMPROC_CORECV_LOGGER_INFO(...) IMPROC_CORECV_LOGGER_CALL(spdlog::level::info, __VA_ARGS__)
 #else
 #    define IMPROC_CORECV_LOGGER_INFO(...) (void)0
 #endif
 
 #if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_WARN
-#    define IMPROC_CORECV_LOGGER_WARN(...) IMPROC_LOGGER_WARN(improc::ImageProcLogger::get(), __VA_ARGS__)
+#    define IMPROC_CORECV_LOGGER_WARN(...) IMPROC_CORECV_LOGGER_CALL(spdlog::level::warn, __VA_ARGS__)
 #else
 #    define IMPROC_CORECV_LOGGER_WARN(...) (void)0
 #endif
 
 #if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_ERROR
-#    define IMPROC_CORECV_LOGGER_ERROR(...) IMPROC_LOGGER_ERROR(improc::ImageProcLogger::get(), __VA_ARGS__)
+#    define IMPROC_CORECV_LOGGER_ERROR(...) IMPROC_CORECV_LOGGER_CALL(spdlog::level::err, __VA_ARGS__)
 #else
 #    define IMPROC_CORECV_LOGGER_ERROR(...) (void)0
 #endif
 
 #if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_CRITICAL
-#    define IMPROC_CORECV_LOGGER_CRITICAL(...) IMPROC_LOGGER_CRITICAL(improc::ImageProcLogger::get(), __VA_ARGS__)
+#    define IMPROC_CORECV_LOGGER_CRITICAL(...) IMPROC_CORECV_LOGGER_CALL(spdlog::level::critical, __VA_ARGS__)
 #else
 #    define IMPROC_CORECV_LOGGER_CRITICAL(...) (void)0
 #endif
@@ -0,0 +1,121 @@
+#ifndef IMPROC_CORECV_METRICS_HPP
+#define IMPROC_CORECV_METRICS_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/corecv/logger_improc.hpp>
+
+#include <opencv2/core.hpp>
+#include <json/json.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace improc
+{
+    /**
+     * @brief Latency and throughput counters of image processing operations
+     *
+     * Each thread accumulates its records in its own shard of counters, so that recording does not lock
+     * or share cache lines between threads. Shards are merged when a snapshot is requested and when their
+     * thread exits. Operations are only instrumented when the library is compiled with IMPROC_CORECV_WITH_METRICS.
+     */
+    class IMPROC_API Metrics final
+    {
+        public:
+            static constexpr size_t                 kMaxOperations          = 256;
+            static constexpr size_t                 kNumberExactBuckets     = 16;
+            static constexpr size_t                 kNumberSubBuckets       = 8;
+            static constexpr size_t                 kNumberLatencyBuckets   = kNumberExactBuckets + (64 - 4) * kNumberSubBuckets;
+
+            struct OperationSnapshot
+            {
+                std::string                         name;
+                uint64_t                            calls;
+                uint64_t                            bytes_in;
+                uint64_t                            bytes_out;
+                uint64_t                            pixels;
+                std::chrono::nanoseconds            total_latency;
+                std::chrono::nanoseconds            p50_latency;
+                std::chrono::nanoseconds            p99_latency;
+                std::chrono::nanoseconds            max_latency;
+            };
+
+            /**
+             * @brief Record latency of the enclosing scope and the images processed in it
+             */
+            class IMPROC_API ScopedRecord final
+            {
+                private:
+                    size_t                                  operation_id_;
+                    std::chrono::steady_clock::time_point   start_;
+                    uint64_t                                bytes_in_;
+                    uint64_t                                bytes_out_;
+                    uint64_t                                pixels_;
+
+                public:
+                    explicit ScopedRecord(size_t operation_id);
+                    ~ScopedRecord() noexcept;
+
+                    ScopedRecord(const ScopedRecord&  that)     = delete;
+                    ScopedRecord(ScopedRecord&&       that)     = delete;
+                    void operator=(const ScopedRecord&  that)   = delete;
+                    void operator=(const ScopedRecord&& that)   = delete;
+
+                    void                                    SetImages(const cv::Mat& input, const cv::Mat& output);
+            };
+
+        private:
+            struct OperationCounters;
+            struct Shard;
+            struct ShardHandle;
+
+            mutable std::mutex                      mutex_;
+            std::vector<std::string>                operation_names_;
+            std::vector<Shard*>                     shards_;
+            Shard*                                  retired_shard_;
+
+            Metrics();
+
+            Shard&                                  GetThreadShard();
+            void                                    RetireShard(Shard* shard);
+
+        public:
+            Metrics(const Metrics&  that)           = delete;
+            Metrics(Metrics&&       that)           = delete;
+            void operator=(const Metrics&  that)    = delete;
+            void operator=(const Metrics&& that)    = delete;
+
+            static Metrics&                         get();
+
+            size_t                                  RegisterOperation(const std::string& operation_name);
+            void                                    Record( size_t operation_id, std::chrono::nanoseconds latency
+                                                          , uint64_t bytes_in, uint64_t bytes_out, uint64_t pixels );
+
+            std::vector<OperationSnapshot>          GetSnapshot()   const;
+            Json::Value                             ToJson()        const;
+            void                                    Reset();
+
+            static size_t                           GetLatencyBucket(uint64_t latency_ns);
+            static uint64_t                         GetLatencyBucketUpperBound(size_t bucket);
+    };
+}
+
+#ifdef IMPROC_CORECV_WITH_METRICS
+/**
+ * @brief Record latency of the enclosing scope for the operation. Operation is registered once for each call site.
+ */
+#define IMPROC_CORECV_METRICS_SCOPE(record,operation_name)                                                                      \
+    static const size_t improc_corecv_metrics_##record##_id = improc::Metrics::get().RegisterOperation(operation_name);         \
+    improc::Metrics::ScopedRecord record {improc_corecv_metrics_##record##_id}
+#define IMPROC_CORECV_METRICS_SET_IMAGES(record,input,output) record.SetImages(input,output)
+#else
+#define IMPROC_CORECV_METRICS_SCOPE(record,operation_name) (void)0
+#define IMPROC_CORECV_METRICS_SET_IMAGES(record,input,output) (void)0
+#endif
+
+#endif
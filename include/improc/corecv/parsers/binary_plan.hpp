@@ -0,0 +1,153 @@
+#ifndef IMPROC_CORECV_BINARY_PLAN_HPP
+#define IMPROC_CORECV_BINARY_PLAN_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/corecv/logger_improc.hpp>
+
+#include <opencv2/core.hpp>
+
+#include <string_view>
+#include <vector>
+
+namespace improc
+{
+    /**
+     * @brief Writer of service configurations into a versioned binary plan
+     *
+     * Plans start with a magic and a version, followed by one record for each service. Records start
+     * with the service name and contain the loaded service configuration, so that services are restored
+     * without parsing and validating their json again. Values are written in little-endian byte order.
+     */
+    class IMPROC_API PlanWriter final
+    {
+        public:
+            static constexpr char               kMagic[8]   = {'I','M','P','R','O','C','P','L'};
+            static constexpr uint32_t           kVersion    = 3;
+
+        private:
+            std::vector<uchar>                  data_;
+
+        public:
+            PlanWriter();
+
+            void                                WriteService(std::string_view service_name);
+            void                                WriteBool(bool value);
+            void                                WriteUInt32(uint32_t value);
+            void                                WriteInt32(int32_t value);
+            void                                WriteDouble(double value);
+            void                                WriteString(std::string_view value);
+            void                                WriteSize(const cv::Size& value);
+            void                                WriteSize(const cv::Size2d& value);
+
+            /**
+             * @brief Write value of enum structure, such as ColorSpace or InterpolationType
+             */
+            template <typename StructureType>
+            void                                WriteEnum(const StructureType& value)
+            {
+                this->WriteInt32(static_cast<int32_t>(static_cast<typename StructureType::Value>(value)));
+            }
+
+            /**
+             * @brief Write service input or output keys
+             */
+            template <typename KeyType>
+            void                                WriteKeys(const std::vector<KeyType>& keys)
+            {
+                static_assert(std::is_same_v<KeyType,std::string> || std::is_integral_v<KeyType>,"WriteKeys not defined for key type");
+                this->WriteUInt32(static_cast<uint32_t>(keys.size()));
+                for (const KeyType& key : keys)
+                {
+                    if constexpr (std::is_same_v<KeyType,std::string>)
+                    {
+                        this->WriteString(key);
+                    }
+                    else
+                    {
+                        this->WriteInt32(static_cast<int32_t>(key));
+                    }
+                }
+            }
+
+            const std::vector<uchar>&           get_data() const;
+
+            void                                Save(const std::string& filepath) const;
+    };
+
+    /**
+     * @brief Reader of service configurations from a binary plan written by PlanWriter
+     */
+    class IMPROC_API PlanReader final
+    {
+        private:
+            std::vector<uchar>                  data_;
+            size_t                              position_;
+
+            const uchar*                        Consume(size_t size);
+            void                                ReadHeader();
+            [[noreturn]] void                   ThrowInvalidEnum(int32_t value) const;
+
+        public:
+            explicit PlanReader(const std::string& filepath);
+            explicit PlanReader(std::vector<uchar> data);
+
+            bool                                IsEnd() const;
+            std::string_view                    PeekService();
+
+            void                                ReadService(std::string_view service_name);
+            bool                                ReadBool();
+            uint32_t                            ReadUInt32();
+            int32_t                             ReadInt32();
+            double                              ReadDouble();
+            std::string_view                    ReadString();
+            cv::Size                            ReadSize();
+            cv::Size2d                          ReadSize2d();
+
+            /**
+             * @brief Read value of enum structure. Values not defined for the structure are rejected.
+             */
+            template <typename StructureType>
+            StructureType                       ReadEnum()
+            {
+                const int32_t kValue = this->ReadInt32();
+                const StructureType kStructure {static_cast<typename StructureType::Value>(kValue)};
+                try
+                {
+                    // Description is only defined for valid values
+                    kStructure.ToString();
+                }
+                catch (const improc::key_error&)
+                {
+                    this->ThrowInvalidEnum(kValue);
+                }
+                return kStructure;
+            }
+
+            /**
+             * @brief Read service input or output keys
+             */
+            template <typename KeyType>
+            std::vector<KeyType>                ReadKeys()
+            {
+                static_assert(std::is_same_v<KeyType,std::string> || std::is_integral_v<KeyType>,"ReadKeys not defined for key type");
+                // Keys are appended one at a time, so that an invalid number of keys fails when the plan data ends
+                const uint32_t kNumberKeys = this->ReadUInt32();
+                std::vector<KeyType> keys {};
+                for (uint32_t key_idx = 0; key_idx < kNumberKeys; ++key_idx)
+                {
+                    if constexpr (std::is_same_v<KeyType,std::string>)
+                    {
+                        keys.push_back(std::string(this->ReadString()));
+                    }
+                    else
+                    {
+                        keys.push_back(static_cast<KeyType>(this->ReadInt32()));
+                    }
+                }
+                return keys;
+            }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,30 @@
+#ifndef IMPROC_CORECV_IMAGE_HEADER_HPP
+#define IMPROC_CORECV_IMAGE_HEADER_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/structures/image_format.hpp>
+
+#include <opencv2/core.hpp>
+
+#include <optional>
+
+namespace improc
+{
+    /**
+     * @brief Encoded image header parsing utility
+     *
+     * Reads the image format and size of an encoded image without decoding it. The size is read from
+     * the JPEG frame header, the PNG IHDR chunk, the JPEG2000 image header and the raw image header.
+     */
+    struct IMPROC_API ImageHeader final
+    {
+        ImageFormat                         image_format;
+        cv::Size                            image_size;
+
+        static std::optional<ImageHeader>   Read(const uchar* encoded_data, size_t encoded_size);
+        static std::optional<ImageHeader>   Read(const cv::Mat& encoded_data);
+    };
+}
+
+#endif
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define IMPROC_CORECV_JSON_PARSER_HPP
 
 #include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/metrics.hpp>
 #include <improc/improc_defs.hpp>
 #include <improc/infrastructure/parsers/json_parser.hpp>
 
@@ -16,6 +16,7 @@ template <typename DataType>
 improc::Point<DataType>::Point(const Json::Value& json_point): improc::Point<DataType>()
 {
     IMPROC_CORECV_LOGGER_TRACE("Parsing point json...");
+    IMPROC_CORECV_METRICS_SCOPE(metrics_record,"json::Point");
     static const std::string kXPositionKey = "x";
     static const std::string kYPositionKey = "y";
     if (json_point.isMember(kXPositionKey) == false)
@@ -52,6 +53,7 @@ template <typename DataType>
 improc::Size<DataType>::Size(const Json::Value& json_size): improc::Size<DataType>()
 {
     IMPROC_CORECV_LOGGER_TRACE("Parsing size json...");
+    IMPROC_CORECV_METRICS_SCOPE(metrics_record,"json::Size");
     static const std::string kWidthKey  = "width";
     static const std::string kHeightKey = "height";
     if (json_size.isMember(kWidthKey) == false)
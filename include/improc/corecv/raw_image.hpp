@@ -0,0 +1,60 @@
+#ifndef IMPROC_CORECV_RAW_IMAGE_HPP
+#define IMPROC_CORECV_RAW_IMAGE_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/image.hpp>
+#include <improc/corecv/structures/color_space.hpp>
+
+#include <opencv2/core.hpp>
+
+#include <optional>
+
+namespace improc
+{
+    /**
+     * @brief Uncompressed image container
+     *
+     * Files start with a fixed-size header with the image size, type and color space, followed by the
+     * image rows. Rows start at a page-aligned offset and each row is padded to kRowAlignment bytes.
+     * Reading memory-maps the file and wraps the rows without copying them. The mapping is released
+     * when the last cv::Mat referencing it is released. Mapped pages are private, so that modifying
+     * the image does not change the file.
+     */
+    class IMPROC_API RawImage final
+    {
+        public:
+            static constexpr char               kMagic[8]       = {'I','M','P','R','O','C','R','W'};
+            static constexpr uint32_t           kVersion        = 1;
+            static constexpr size_t             kHeaderSize     = 64;
+            static constexpr size_t             kDataAlignment  = 4096;
+            static constexpr size_t             kRowAlignment   = 64;
+
+            /**
+             * @brief Image properties stored in the file header
+             */
+            struct Header
+            {
+                cv::Size                        image_size;
+                int                             type;
+                std::optional<ColorSpace>       color_space;
+                size_t                          row_step;
+                size_t                          data_offset;
+            };
+
+            static bool                         IsRawImage(const uchar* data, size_t size);
+            static Header                       ReadHeader(const uchar* data, size_t size);
+            static Header                       ReadHeader(const std::string& filepath);
+
+            static cv::Mat                      ReadData(const std::string& filepath);
+            static cv::Mat                      ReadData(const std::string& filepath, Header& header);
+            static Image                        Read(const std::string& filepath);
+            static ColorSpaceImage              ReadColorSpaceImage(const std::string& filepath);
+
+            static void                         Write(const std::string& filepath, const cv::Mat& image_data);
+            static void                         Write(const std::string& filepath, const ColorSpaceImage& image);
+    };
+}
+
+#endif
\ No newline at end of file
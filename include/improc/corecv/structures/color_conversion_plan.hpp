@@ -0,0 +1,39 @@
+#ifndef IMPROC_CORECV_COLOR_CONVERSION_PLAN_HPP
+#define IMPROC_CORECV_COLOR_CONVERSION_PLAN_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/structures/color_space.hpp>
+
+#include <vector>
+
+namespace improc
+{
+    /**
+     * @brief Color conversion plan methods and utilities
+     *
+     * Reduces a chain of color space conversions to the shortest sequence of conversions
+     * that produces the same image. Conversions to the current color space are dropped and
+     * consecutive conversions are collapsed into a direct conversion whenever the intermediate
+     * color space keeps all the information required by the target color space and the direct
+     * conversion exists.
+     */
+    class IMPROC_API ColorConversionPlan final
+    {
+        private:
+            ColorSpace                      from_color_space_;
+            std::vector<ColorSpace>         to_color_space_;
+
+        public:
+            ColorConversionPlan();
+            ColorConversionPlan(const ColorSpace& from_color_space, const std::vector<ColorSpace>& to_color_space);
+
+            ColorSpace                      get_from_color_space()  const;
+            ColorSpace                      get_to_color_space()    const;
+            const std::vector<ColorSpace>&  get_conversions()       const;
+
+            bool                            IsIdentity()            const;
+    };
+}
+
+#endif
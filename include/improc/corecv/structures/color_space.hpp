@@ -4,7 +4,7 @@
 #include <improc/improc_defs.hpp>
 #include <improc/exception.hpp>
 #include <improc/corecv/logger_improc.hpp>
-#include <improc/infrastructure/string.hpp>
+#include <improc/corecv/structures/enum_table.hpp>
 
 #include <opencv2/imgproc.hpp>
 
@@ -12,6 +12,14 @@ namespace improc
 {
     /**
      * @brief Color space methods and utilities
+     *
+     * YUV color spaces follow the OpenCV image data layout. NV12 and I420 are single channel images with
+     * the full resolution luma plane followed by the chroma planes subsampled by 2 in both directions, so
+     * that the image data has 3/2 of the image rows. YUYV is a two channel image with chroma subsampled by 2
+     * horizontally.
+     *
+     * HSV and Lab follow the OpenCV 8-bit ranges. Hue is stored as half of its angle in degrees and Lab
+     * stores L * 255 / 100 with a and b offset by 128.
      */
     class IMPROC_API ColorSpace final
     {
@@ -23,14 +31,30 @@ namespace improc
                 ,   kRGB  = 2
                 ,   kBGR  = 3
                 ,   kGray = 4
+                ,   kNV12 = 5
+                ,   kI420 = 6
+                ,   kYUYV = 7
+                ,   kHSV  = 8
+                ,   kLab  = 9
             };
 
         private:
             Value                       value_;
+            static constexpr EnumTable<Value,10>  kEnumTable {{ {"rgb" ,Value::kRGB }
+                                                              , {"bgr" ,Value::kBGR }
+                                                              , {"rgba",Value::kRGBA}
+                                                              , {"bgra",Value::kBGRA}
+                                                              , {"gray",Value::kGray}
+                                                              , {"nv12",Value::kNV12}
+                                                              , {"i420",Value::kI420}
+                                                              , {"yuyv",Value::kYUYV}
+                                                              , {"hsv" ,Value::kHSV }
+                                                              , {"lab" ,Value::kLab }
+                                                              }};
 
         public:
             ColorSpace();                              
-            explicit ColorSpace(const std::string& color_space_str);
+            explicit ColorSpace(std::string_view color_space_str);
 
             /**
              * @brief Construct a new improc::ColorSpace object
@@ -39,6 +63,38 @@ namespace improc
              */
             constexpr explicit          ColorSpace(Value color_space_value): value_(std::move(color_space_value)) {}
 
+            /**
+             * @brief Obtain color space from string description without allocating
+             * 
+             * @param color_space_str - color space description as string in any case
+             * @return std::optional<ColorSpace> - empty if the description is not valid
+             */
+            static constexpr std::optional<ColorSpace> TryParse(std::string_view color_space_str)
+            {
+                const std::optional<Value> kValue = kEnumTable.TryParse(color_space_str);
+                if (kValue.has_value() == false)
+                {
+                    return std::nullopt;
+                }
+                return ColorSpace(kValue.value());
+            }
+
+            /**
+             * @brief Obtain color space from stored value without throwing
+             * 
+             * @param color_space_value - color space value, possibly read from untrusted data
+             * @return std::optional<ColorSpace> - empty if the value is not a color space
+             */
+            static constexpr std::optional<ColorSpace> TryFromValue(std::underlying_type_t<Value> color_space_value)
+            {
+                const Value kValue = static_cast<Value>(color_space_value);
+                if (kEnumTable.Contains(kValue) == false)
+                {
+                    return std::nullopt;
+                }
+                return ColorSpace(kValue);
+            }
+
             /**
              * @brief Obtain color space value
              */
@@ -56,6 +112,11 @@ namespace improc
                     case ColorSpace::Value::kBGRA: return "BGRA"; break;
                     case ColorSpace::Value::kRGBA: return "RGBA"; break;
                     case ColorSpace::Value::kGray: return "Gray"; break;
+                    case ColorSpace::Value::kNV12: return "NV12"; break;
+                    case ColorSpace::Value::kI420: return "I420"; break;
+                    case ColorSpace::Value::kYUYV: return "YUYV"; break;
+                    case ColorSpace::Value::kHSV : return "HSV";  break;
+                    case ColorSpace::Value::kLab : return "Lab";  break;
                     default:
                         throw improc::key_error("ToString method not defined for color space enum");
                 }
@@ -73,11 +134,28 @@ namespace improc
                     case ColorSpace::Value::kBGRA: return 4;    break;
                     case ColorSpace::Value::kRGBA: return 4;    break;
                     case ColorSpace::Value::kGray: return 1;    break;
+                    case ColorSpace::Value::kNV12: return 1;    break;
+                    case ColorSpace::Value::kI420: return 1;    break;
+                    case ColorSpace::Value::kYUYV: return 2;    break;
+                    case ColorSpace::Value::kHSV : return 3;    break;
+                    case ColorSpace::Value::kLab : return 3;    break;
                     default:
                         throw improc::key_error("GetNumberChannels method not defined for color space enum");                
                 }
             }
 
+            /**
+             * @brief Check if color space stores luma and subsampled chroma
+             */
+            constexpr bool              IsYUV()     const
+            {
+                return this->value_ == ColorSpace::Value::kNV12 || this->value_ == ColorSpace::Value::kI420 || this->value_ == ColorSpace::Value::kYUYV;
+            }
+
+            cv::Size                    GetDataSize(const cv::Size& image_size)     const;
+            cv::Size                    GetImageSize(const cv::Size& data_size)     const;
+            bool                        IsValidDataSize(const cv::Size& data_size)  const;
+
             /**
              * @brief Obtain OpenCV color conversion code from source to target color space.
              * 
@@ -87,99 +165,185 @@ namespace improc
             template<typename ColorSpaceType = improc::ColorSpace::Value>
             constexpr cv::ColorConversionCodes GetColorConversionCode(const ColorSpaceType& to_color_space) const
             {
-                improc::ColorSpace::Value to_color_space_value {};
+                const improc::ColorSpace::Value kToColorSpace = ToValue(to_color_space);
+                if (this->value_ == kToColorSpace)
+                {
+                    throw improc::value_error(fmt::format("Source and target color space {} are the same",this->ToString()));
+                }
+                const std::optional<cv::ColorConversionCodes> kConversionCode = FindColorConversionCode(this->value_,kToColorSpace);
+                if (kConversionCode.has_value() == false)
+                {
+                    throw improc::key_error("GetColorConversionCode method not defined for color space enum");
+                }
+                return kConversionCode.value();
+            }
+
+            /**
+             * @brief Check if there is an OpenCV color conversion code from source to target color space, without throwing.
+             * 
+             * @tparam ColorSpaceType - color space data type: improc::ColorSpace or improc::ColorSpace::Value
+             * @param to_color_space - target color space
+             */
+            template<typename ColorSpaceType = improc::ColorSpace::Value>
+            constexpr bool              HasColorConversionCode(const ColorSpaceType& to_color_space) const
+            {
+                return FindColorConversionCode(this->value_,ToValue(to_color_space)).has_value();
+            }
+
+        private:
+            template<typename ColorSpaceType>
+            static constexpr Value      ToValue(const ColorSpaceType& color_space)
+            {
                 if constexpr (std::is_same_v<ColorSpaceType,improc::ColorSpace::Value>)
                 {
-                    to_color_space_value = std::move(to_color_space);
+                    return color_space;
                 }
                 else if constexpr (std::is_same_v<ColorSpaceType,improc::ColorSpace>)
                 {
-                    to_color_space_value = std::move(to_color_space).operator improc::ColorSpace::Value();
+                    return color_space.operator improc::ColorSpace::Value();
                 }
                 else
                 {
-                    static_assert(improc::dependent_false_v<ColorSpaceType>,"GetColorConversionCode not defined for color space type");
+                    static_assert(improc::dependent_false_v<ColorSpaceType>,"Color space conversion not defined for color space type");
                 }
+            }
 
-                switch (this->value_)
+            /**
+             * @brief Obtain OpenCV color conversion code between different color spaces. Empty if there is no conversion.
+             */
+            static constexpr std::optional<cv::ColorConversionCodes> FindColorConversionCode(Value from_color_space, Value to_color_space)
+            {
+                switch (from_color_space)
                 {
                     case ColorSpace::Value::kBGR : 
-                        switch (std::move(to_color_space_value))
+                        switch (to_color_space)
                         {
-                            case ColorSpace::Value::kBGR : 
-                                throw improc::value_error(fmt::format("Source and target color space {} are the same",this->ToString()));
-                                break;
                             case ColorSpace::Value::kRGB : return cv::COLOR_BGR2RGB;                        break;
                             case ColorSpace::Value::kBGRA: return cv::COLOR_BGR2BGRA;                       break;
                             case ColorSpace::Value::kRGBA: return cv::COLOR_BGR2RGBA;                       break;
                             case ColorSpace::Value::kGray: return cv::COLOR_BGR2GRAY;                       break;
+                            case ColorSpace::Value::kI420: return cv::COLOR_BGR2YUV_I420;                   break;
+                            case ColorSpace::Value::kHSV : return cv::COLOR_BGR2HSV;                        break;
+                            case ColorSpace::Value::kLab : return cv::COLOR_BGR2Lab;                        break;
                             default:
-                                throw improc::key_error("GetColorConversionCode method not defined for color space enum from BGR");
+                                return std::nullopt;
                         }
                         break;
 
                     case ColorSpace::Value::kRGB :
-                        switch (std::move(to_color_space_value))
+                        switch (to_color_space)
                         {
                             case ColorSpace::Value::kBGR : return cv::COLOR_RGB2BGR;                        break;
-                            case ColorSpace::Value::kRGB : 
-                                throw improc::value_error(fmt::format("Source and target color space {} are the same",this->ToString()));
-                                break;
                             case ColorSpace::Value::kBGRA: return cv::COLOR_RGB2BGRA;                       break;
                             case ColorSpace::Value::kRGBA: return cv::COLOR_RGB2RGBA;                       break;
                             case ColorSpace::Value::kGray: return cv::COLOR_RGB2GRAY;                       break;
+                            case ColorSpace::Value::kI420: return cv::COLOR_RGB2YUV_I420;                   break;
+                            case ColorSpace::Value::kHSV : return cv::COLOR_RGB2HSV;                        break;
+                            case ColorSpace::Value::kLab : return cv::COLOR_RGB2Lab;                        break;
                             default:
-                                throw improc::key_error("GetColorConversionCode method not defined for color space enum from RGB");
+                                return std::nullopt;
                         }
                         break;
 
                     case ColorSpace::Value::kBGRA:
-                        switch (std::move(to_color_space_value))
+                        switch (to_color_space)
                         {
                             case ColorSpace::Value::kBGR : return cv::COLOR_BGRA2BGR;                       break;
                             case ColorSpace::Value::kRGB : return cv::COLOR_BGRA2RGB;                       break;
-                            case ColorSpace::Value::kBGRA: 
-                                throw improc::value_error(fmt::format("Source and target color space {} are the same",this->ToString()));
-                                break;
                             case ColorSpace::Value::kRGBA: return cv::COLOR_BGRA2RGBA;                      break;
                             case ColorSpace::Value::kGray: return cv::COLOR_BGRA2GRAY;                      break;
+                            case ColorSpace::Value::kI420: return cv::COLOR_BGRA2YUV_I420;                  break;
                             default:
-                                throw improc::key_error("GetColorConversionCode method not defined for color space enum from BGRA");
+                                return std::nullopt;
                         }
                         break;
 
                     case ColorSpace::Value::kRGBA:
-                        switch (std::move(to_color_space_value))
+                        switch (to_color_space)
                         {
                             case ColorSpace::Value::kBGR : return cv::COLOR_RGBA2BGR;                       break;
                             case ColorSpace::Value::kRGB : return cv::COLOR_RGBA2RGB;                       break;
                             case ColorSpace::Value::kBGRA: return cv::COLOR_RGBA2BGRA;                      break;
-                            case ColorSpace::Value::kRGBA: 
-                                throw improc::value_error(fmt::format("Source and target color space {} are the same",this->ToString()));
-                                break;
                             case ColorSpace::Value::kGray: return cv::COLOR_RGBA2GRAY;                      break;
+                            case ColorSpace::Value::kI420: return cv::COLOR_RGBA2YUV_I420;                  break;
                             default:
-                                throw improc::key_error("GetColorConversionCode method not defined for color space enum from RGBA");
+                                return std::nullopt;
                         }
                         break;
 
                     case ColorSpace::Value::kGray:
-                        switch (std::move(to_color_space_value))
+                        switch (to_color_space)
                         {
                             case ColorSpace::Value::kBGR : return cv::COLOR_GRAY2BGR;                       break;
                             case ColorSpace::Value::kRGB : return cv::COLOR_GRAY2RGB;                       break;
                             case ColorSpace::Value::kBGRA: return cv::COLOR_GRAY2BGRA;                      break;
                             case ColorSpace::Value::kRGBA: return cv::COLOR_GRAY2RGBA;                      break;
-                            case ColorSpace::Value::kGray: 
-                                throw improc::value_error(fmt::format("Source and target color space {} are the same",this->ToString()));
-                                break;
                             default:
-                                throw improc::key_error("GetColorConversionCode method not defined for color space enum from Gray");
+                                return std::nullopt;
+                        }
+                        break;
+
+                    case ColorSpace::Value::kNV12:
+                        switch (to_color_space)
+                        {
+                            case ColorSpace::Value::kBGR : return cv::COLOR_YUV2BGR_NV12;                   break;
+                            case ColorSpace::Value::kRGB : return cv::COLOR_YUV2RGB_NV12;                   break;
+                            case ColorSpace::Value::kBGRA: return cv::COLOR_YUV2BGRA_NV12;                  break;
+                            case ColorSpace::Value::kRGBA: return cv::COLOR_YUV2RGBA_NV12;                  break;
+                            case ColorSpace::Value::kGray: return cv::COLOR_YUV2GRAY_NV12;                  break;
+                            default:
+                                return std::nullopt;
+                        }
+                        break;
+
+                    case ColorSpace::Value::kI420:
+                        switch (to_color_space)
+                        {
+                            case ColorSpace::Value::kBGR : return cv::COLOR_YUV2BGR_I420;                   break;
+                            case ColorSpace::Value::kRGB : return cv::COLOR_YUV2RGB_I420;                   break;
+                            case ColorSpace::Value::kBGRA: return cv::COLOR_YUV2BGRA_I420;                  break;
+                            case ColorSpace::Value::kRGBA: return cv::COLOR_YUV2RGBA_I420;                  break;
+                            case ColorSpace::Value::kGray: return cv::COLOR_YUV2GRAY_I420;                  break;
+                            default:
+                                return std::nullopt;
+                        }
+                        break;
+
+                    case ColorSpace::Value::kYUYV:
+                        switch (to_color_space)
+                        {
+                            case ColorSpace::Value::kBGR : return cv::COLOR_YUV2BGR_YUYV;                   break;
+                            case ColorSpace::Value::kRGB : return cv::COLOR_YUV2RGB_YUYV;                   break;
+                            case ColorSpace::Value::kBGRA: return cv::COLOR_YUV2BGRA_YUYV;                  break;
+                            case ColorSpace::Value::kRGBA: return cv::COLOR_YUV2RGBA_YUYV;                  break;
+                            case ColorSpace::Value::kGray: return cv::COLOR_YUV2GRAY_YUYV;                  break;
+                            default:
+                                return std::nullopt;
+                        }
+                        break;
+
+                    case ColorSpace::Value::kHSV:
+                        switch (to_color_space)
+                        {
+                            case ColorSpace::Value::kBGR : return cv::COLOR_HSV2BGR;                        break;
+                            case ColorSpace::Value::kRGB : return cv::COLOR_HSV2RGB;                        break;
+                            default:
+                                return std::nullopt;
+                        }
+                        break;
+
+                    case ColorSpace::Value::kLab:
+                        switch (to_color_space)
+                        {
+                            case ColorSpace::Value::kBGR : return cv::COLOR_Lab2BGR;                        break;
+                            case ColorSpace::Value::kRGB : return cv::COLOR_Lab2RGB;                        break;
+                            default:
+                                return std::nullopt;
                         }
                         break;
 
                     default:
-                        throw improc::key_error("GetColorConversionCode method not defined for color space enum");
+                        return std::nullopt;
                 }
             }
     };
@@ -0,0 +1,127 @@
+#ifndef IMPROC_CORECV_ENUM_TABLE_HPP
+#define IMPROC_CORECV_ENUM_TABLE_HPP
+
+#include <improc/improc_defs.hpp>
+
+#include <fmt/format.h>
+
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+
+namespace improc
+{
+    /**
+     * @brief Compile-time table of enum values and their string descriptions
+     *
+     * Descriptions are matched without case sensitivity directly on the string view, so that parsing
+     * does not allocate.
+     *
+     * @tparam EnumType - enum type
+     * @tparam kNumberEntries - number of enum values in the table
+     */
+    template <typename EnumType, size_t kNumberEntries>
+    class EnumTable final
+    {
+        public:
+            /**
+             * @brief Enum value and its lower case description
+             */
+            struct Entry
+            {
+                std::string_view            description {};
+                EnumType                    value {};
+            };
+
+        private:
+            Entry                           entries_[kNumberEntries];
+
+            /**
+             * @brief Compare description with lower case description ignoring case of ASCII letters
+             */
+            static constexpr bool           IsEqual(std::string_view description, std::string_view lower_description)
+            {
+                if (description.size() != lower_description.size())
+                {
+                    return false;
+                }
+                for (size_t char_idx = 0; char_idx < description.size(); ++char_idx)
+                {
+                    const char kChar = description[char_idx] >= 'A' && description[char_idx] <= 'Z'
+                                     ? static_cast<char>(description[char_idx] - 'A' + 'a')
+                                     : description[char_idx];
+                    if (kChar != lower_description[char_idx])
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+        public:
+            /**
+             * @brief Construct a new improc::EnumTable object
+             *
+             * @param entries - enum values with their lower case descriptions
+             */
+            constexpr explicit EnumTable(const Entry (&entries)[kNumberEntries]) : entries_()
+            {
+                for (size_t entry_idx = 0; entry_idx < kNumberEntries; ++entry_idx)
+                {
+                    this->entries_[entry_idx] = entries[entry_idx];
+                }
+            }
+
+            /**
+             * @brief Obtain enum value from description
+             *
+             * @param description - enum value description in any case
+             * @return std::optional<EnumType> - empty if the description is not in the table
+             */
+            constexpr std::optional<EnumType> TryParse(std::string_view description) const
+            {
+                for (size_t entry_idx = 0; entry_idx < kNumberEntries; ++entry_idx)
+                {
+                    if (IsEqual(description,this->entries_[entry_idx].description) == true)
+                    {
+                        return this->entries_[entry_idx].value;
+                    }
+                }
+                return std::nullopt;
+            }
+
+            /**
+             * @brief Check if enum value is in the table
+             *
+             * @param value - enum value, possibly read from untrusted data
+             */
+            constexpr bool                  Contains(EnumType value) const
+            {
+                for (size_t entry_idx = 0; entry_idx < kNumberEntries; ++entry_idx)
+                {
+                    if (this->entries_[entry_idx].value == value)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            /**
+             * @brief Obtain enum value from description
+             *
+             * @param description - enum value description in any case. Throws std::out_of_range if it is not in the table.
+             */
+            constexpr EnumType              Parse(std::string_view description) const
+            {
+                const std::optional<EnumType> kValue = this->TryParse(description);
+                if (kValue.has_value() == false)
+                {
+                    throw std::out_of_range(fmt::format("Description {} not found in enum table",description));
+                }
+                return kValue.value();
+            }
+    };
+}
+
+#endif
\ No newline at end of file
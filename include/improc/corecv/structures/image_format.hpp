@@ -3,7 +3,7 @@
 
 #include <improc/improc_defs.hpp>
 #include <improc/corecv/logger_improc.hpp>
-#include <improc/infrastructure/string.hpp>
+#include <improc/corecv/structures/enum_table.hpp>
 
 #include <opencv2/core.hpp>
 
@@ -20,14 +20,20 @@ namespace improc
                     kPNG      = 0
                 ,   kJPEG     = 1
                 ,   kJPEG2000 = 2
+                ,   kRaw      = 3
             };
 
         private:
             Value                       value_;
+            static constexpr EnumTable<Value,4>   kEnumTable {{ {"png"     ,Value::kPNG     }
+                                                              , {"jpeg"    ,Value::kJPEG    }
+                                                              , {"jpeg2000",Value::kJPEG2000}
+                                                              , {"raw"     ,Value::kRaw     }
+                                                              }};
 
         public:
             ImageFormat();                              
-            explicit ImageFormat(const std::string& image_format_str);
+            explicit ImageFormat(std::string_view image_format_str);
 
             /**
              * @brief Construct a new improc::ImageFormat object
@@ -36,6 +42,22 @@ namespace improc
              */
             constexpr explicit          ImageFormat(Value image_format_value): value_(std::move(image_format_value)) {}
 
+            /**
+             * @brief Obtain image format from string description without allocating
+             * 
+             * @param image_format_str - image format description as string in any case
+             * @return std::optional<ImageFormat> - empty if the description is not valid
+             */
+            static constexpr std::optional<ImageFormat> TryParse(std::string_view image_format_str)
+            {
+                const std::optional<Value> kValue = kEnumTable.TryParse(image_format_str);
+                if (kValue.has_value() == false)
+                {
+                    return std::nullopt;
+                }
+                return ImageFormat(kValue.value());
+            }
+
             /**
              * @brief Obtain image format value
              */
@@ -51,13 +73,14 @@ namespace improc
                     case ImageFormat::Value::kPNG     : return "PNG";       break;
                     case ImageFormat::Value::kJPEG    : return "JPEG";      break;
                     case ImageFormat::Value::kJPEG2000: return "JPEG2000";  break;
+                    case ImageFormat::Value::kRaw     : return "RAW";       break;
                     default:
                         throw improc::key_error("ToString method not defined for image format enum");
                 }
             }
 
             /**
-             * @brief Obtain image format OpenCV code
+             * @brief Obtain image format OpenCV code. Raw images are not encoded by OpenCV.
              */
             constexpr std::string_view  ToOpenCV()  const
             {
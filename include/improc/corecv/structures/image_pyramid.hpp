@@ -0,0 +1,77 @@
+#ifndef IMPROC_CORECV_IMAGE_PYRAMID_HPP
+#define IMPROC_CORECV_IMAGE_PYRAMID_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/image.hpp>
+#include <improc/corecv/structures/color_space.hpp>
+
+#include <opencv2/core.hpp>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace improc
+{
+    /**
+     * @brief Pyramid of an image with levels computed on demand
+     *
+     * Level 0 is the image and each level halves the size of the previous one, rounding up as cv::pyrDown.
+     * A level is computed from the previous level, which is computed first if it is not cached, so that
+     * levels built by a stage are reused by the following ones. Level buffers are obtained from the image
+     * allocator pool. Levels are computed once, also with concurrent readers, and never modified afterwards.
+     * Pyramids are moved and not copied, since levels hold their synchronization state.
+     */
+    class IMPROC_API ImagePyramid final
+    {
+        public:
+            enum class Downsampling : unsigned int
+            {
+                    kGaussian   = 0
+                ,   kArea       = 1
+            };
+
+        private:
+            struct Level
+            {
+                std::once_flag                  computed_flag;
+                std::atomic<bool>               is_cached {false};
+                cv::Mat                         data;
+            };
+
+            Downsampling                        downsampling_;
+            std::optional<ColorSpace>           color_space_;
+            std::vector<std::unique_ptr<Level>> levels_;
+
+            void                                Initialize(const cv::Mat& image_data, size_t number_levels);
+            void                                ComputeLevel(size_t level_idx) const;
+
+        public:
+            ImagePyramid();
+            ImagePyramid(const Image& image, size_t number_levels, Downsampling downsampling = Downsampling::kGaussian);
+            ImagePyramid(const ColorSpaceImage& image, size_t number_levels, Downsampling downsampling = Downsampling::kGaussian);
+
+            ImagePyramid(const ImagePyramid&  that)                 = delete;
+            ImagePyramid(ImagePyramid&&       that)                 = default;
+            ImagePyramid& operator=(const ImagePyramid&  that)      = delete;
+            ImagePyramid& operator=(ImagePyramid&&       that)      = default;
+
+            static size_t                       GetMaxNumberLevels(const cv::Size& image_size);
+
+            size_t                              get_number_levels() const;
+            Downsampling                        get_downsampling()  const;
+            std::optional<ColorSpace>           get_color_space()   const;
+
+            cv::Size                            GetLevelSize(size_t level_idx)      const;
+            bool                                IsLevelCached(size_t level_idx)     const;
+            const cv::Mat&                      GetLevelData(size_t level_idx)      const;
+            Image                               GetLevel(size_t level_idx)          const;
+            ColorSpaceImage                     GetColorSpaceLevel(size_t level_idx) const;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,89 @@
+#ifndef IMPROC_CORECV_INTEGRAL_IMAGE_HPP
+#define IMPROC_CORECV_INTEGRAL_IMAGE_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/corecv/logger_improc.hpp>
+
+#include <opencv2/core.hpp>
+
+#include <algorithm>
+
+namespace improc
+{
+    /**
+     * @brief Summed-area table of a single channel 8-bit image
+     *
+     * Entry (y,x) holds the sum of the pixels above and to the left of pixel (y,x), with the same layout
+     * as cv::integral. Sums are accumulated in 32-bit unsigned integers with wrap-around, so that the sum
+     * of any window is exact while it is at most 2^32 - 1: windows up to kMaxSumArea pixels for pixel sums
+     * and up to kMaxSquareSumArea pixels for squared pixel sums. Window sums are obtained in constant time
+     * for any window size.
+     */
+    class IMPROC_API IntegralImage final
+    {
+        public:
+            static constexpr int            kMaxSumArea         = 16843009;
+            static constexpr int            kMaxSquareSumArea   = 66051;
+
+        private:
+            cv::Mat                         sum_;
+            cv::Mat                         square_sum_;
+
+            /**
+             * @brief Sum of window from table. Differences wrap around, so the result is exact even if table entries overflowed.
+             */
+            static uint32_t                 GetWindowSum(const cv::Mat& table, const cv::Rect& window)
+            {
+                const uint32_t* kTopRow    = table.ptr<uint32_t>(window.y);
+                const uint32_t* kBottomRow = table.ptr<uint32_t>(window.y + window.height);
+                return kBottomRow[window.x + window.width] - kBottomRow[window.x] - kTopRow[window.x + window.width] + kTopRow[window.x];
+            }
+
+        public:
+            IntegralImage();
+            explicit IntegralImage(const cv::Mat& image, bool with_square_sum = false);
+
+            static bool                     IsSupported(int image_type);
+
+            void                            Compute(const cv::Mat& image, bool with_square_sum = false);
+
+            cv::Size                        GetImageSize()      const;
+            bool                            HasSquareSum()      const;
+            const cv::Mat&                  get_sum()           const;
+            const cv::Mat&                  get_square_sum()    const;
+
+            /**
+             * @brief Obtain window of size centered at pixel (row,col) and clipped to the image
+             */
+            cv::Rect                        GetCenteredWindow(int row, int col, const cv::Size& window_size) const
+            {
+                const int kLeft   = std::max(0,col - window_size.width  / 2);
+                const int kTop    = std::max(0,row - window_size.height / 2);
+                const int kRight  = std::min(this->sum_.cols - 1,col - window_size.width  / 2 + window_size.width);
+                const int kBottom = std::min(this->sum_.rows - 1,row - window_size.height / 2 + window_size.height);
+                return cv::Rect(kLeft,kTop,kRight - kLeft,kBottom - kTop);
+            }
+
+            /**
+             * @brief Obtain sum of the pixels in window. Window should be inside the image and have at most kMaxSumArea pixels.
+             */
+            uint32_t                        GetSum(const cv::Rect& window) const
+            {
+                return GetWindowSum(this->sum_,window);
+            }
+
+            /**
+             * @brief Obtain sum of the squared pixels in window. Window should be inside the image, have at most
+             * kMaxSquareSumArea pixels and the square sums should have been computed.
+             */
+            uint32_t                        GetSquareSum(const cv::Rect& window) const
+            {
+                return GetWindowSum(this->square_sum_,window);
+            }
+
+            void                            BoxFilter(const cv::Size& window_size, cv::Mat& mean_image) const;
+    };
+}
+
+#endif
\ No newline at end of file
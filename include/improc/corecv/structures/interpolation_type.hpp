@@ -3,7 +3,7 @@
 
 #include <improc/improc_defs.hpp>
 #include <improc/corecv/logger_improc.hpp>
-#include <improc/infrastructure/string.hpp>
+#include <improc/corecv/structures/enum_table.hpp>
 
 #include <opencv2/imgproc.hpp>
 
@@ -24,10 +24,14 @@ namespace improc
 
         private:
             Value                               value_;
+            static constexpr EnumTable<Value,3>   kEnumTable {{ {"linear" ,Value::kLinear }
+                                                              , {"cubic"  ,Value::kCubic  }
+                                                              , {"nearest",Value::kNearest}
+                                                              }};
 
         public:
             InterpolationType();                              
-            explicit InterpolationType(const std::string& interpolation_type_str);
+            explicit InterpolationType(std::string_view interpolation_type_str);
 
             /**
              * @brief Construct a new improc::InterpolationType object
@@ -36,6 +40,22 @@ namespace improc
              */
             constexpr explicit                 InterpolationType(Value interpolation_type_value): value_(std::move(interpolation_type_value)) {}
 
+            /**
+             * @brief Obtain interpolation type from string description without allocating
+             * 
+             * @param interpolation_type_str - interpolation type description as string in any case
+             * @return std::optional<InterpolationType> - empty if the description is not valid
+             */
+            static constexpr std::optional<InterpolationType> TryParse(std::string_view interpolation_type_str)
+            {
+                const std::optional<Value> kValue = kEnumTable.TryParse(interpolation_type_str);
+                if (kValue.has_value() == false)
+                {
+                    return std::nullopt;
+                }
+                return InterpolationType(kValue.value());
+            }
+
             /**
              * @brief Obtain interpolation type value
              */
@@ -3,7 +3,7 @@
 
 #include <improc/improc_defs.hpp>
 #include <improc/corecv/logger_improc.hpp>
-#include <improc/infrastructure/string.hpp>
+#include <improc/corecv/structures/enum_table.hpp>
 
 #include <opencv2/imgproc.hpp>
 
@@ -23,10 +23,13 @@ namespace improc
 
         private:
             Value                       value_;
+            static constexpr EnumTable<Value,2>   kEnumTable {{ {"rectangle",Value::kRectangle}
+                                                              , {"ellipse"  ,Value::kEllipse  }
+                                                              }};
 
         public:
             KernelShape();                              
-            explicit KernelShape(const std::string& kernel_shape_str);
+            explicit KernelShape(std::string_view kernel_shape_str);
 
             /**
              * @brief Construct a new improc::KernelShape object
@@ -35,6 +38,22 @@ namespace improc
              */
             constexpr explicit          KernelShape(Value kernel_shape_value): value_(std::move(kernel_shape_value)) {}
 
+            /**
+             * @brief Obtain kernel shape from string description without allocating
+             * 
+             * @param kernel_shape_str - kernel shape description as string in any case
+             * @return std::optional<KernelShape> - empty if the description is not valid
+             */
+            static constexpr std::optional<KernelShape> TryParse(std::string_view kernel_shape_str)
+            {
+                const std::optional<Value> kValue = kEnumTable.TryParse(kernel_shape_str);
+                if (kValue.has_value() == false)
+                {
+                    return std::nullopt;
+                }
+                return KernelShape(kValue.value());
+            }
+
             /**
              * @brief Obtain kernel shape value
              */
@@ -3,7 +3,7 @@
 
 #include <improc/improc_defs.hpp>
 #include <improc/corecv/logger_improc.hpp>
-#include <improc/infrastructure/string.hpp>
+#include <improc/corecv/structures/enum_table.hpp>
 
 #include <opencv2/imgproc.hpp>
 
@@ -25,10 +25,15 @@ namespace improc
 
         private:
             Value                       value_;
+            static constexpr EnumTable<Value,4>   kEnumTable {{ {"dilate",Value::kDilate}
+                                                              , {"erode" ,Value::kErode }
+                                                              , {"open"  ,Value::kOpen  }
+                                                              , {"close" ,Value::kClose }
+                                                              }};
 
         public:
             MorphologicalOper();                              
-            explicit MorphologicalOper(const std::string& morphological_oper_str);
+            explicit MorphologicalOper(std::string_view morphological_oper_str);
 
             /**
              * @brief Construct a new improc::MorphologicalOper object
@@ -37,6 +42,22 @@ namespace improc
              */
             constexpr explicit          MorphologicalOper(Value morphological_oper_value): value_(std::move(morphological_oper_value)) {}
 
+            /**
+             * @brief Obtain morphological operation from string description without allocating
+             * 
+             * @param morphological_oper_str - morphological operation description as string in any case
+             * @return std::optional<MorphologicalOper> - empty if the description is not valid
+             */
+            static constexpr std::optional<MorphologicalOper> TryParse(std::string_view morphological_oper_str)
+            {
+                const std::optional<Value> kValue = kEnumTable.TryParse(morphological_oper_str);
+                if (kValue.has_value() == false)
+                {
+                    return std::nullopt;
+                }
+                return MorphologicalOper(kValue.value());
+            }
+
             /**
              * @brief Obtain morphological operation value
              */
@@ -0,0 +1,62 @@
+#ifndef IMPROC_CORECV_RESIZE_COEFFICIENTS_HPP
+#define IMPROC_CORECV_RESIZE_COEFFICIENTS_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/structures/interpolation_type.hpp>
+
+#include <opencv2/core.hpp>
+
+#include <vector>
+
+namespace improc
+{
+    /**
+     * @brief Precomputed resize coefficients methods and utilities
+     *
+     * Source indices and fixed-point interpolation weights are computed once for a pair of source and 
+     * target image sizes, following the OpenCV sampling convention, and reused by every image resized
+     * between those sizes. Supports linear and nearest interpolation for 8-bit images with up to 4 channels.
+     * Target regions can be resized from the source region they read, so tiled pipelines give the same
+     * image as resizing the whole image. Nearest interpolation is identical to cv::resize. Linear interpolation
+     * keeps the full precision of the horizontal pass and rounds once, while cv::resize reduces the precision of
+     * the intermediate sums, so pixels may differ by one from cv::resize with INTER_LINEAR.
+     */
+    class IMPROC_API ResizeCoefficients final
+    {
+        public:
+            static constexpr int            kCoefficientBits    = 11;
+            static constexpr int            kCoefficientScale   = 1 << kCoefficientBits;
+
+        private:
+            cv::Size                        from_image_size_;
+            cv::Size                        to_image_size_;
+            InterpolationType               interpolation_;
+            std::vector<int>                x_offsets_;
+            std::vector<short>              x_coefficients_;
+            std::vector<int>                y_offsets_;
+            std::vector<short>              y_coefficients_;
+
+        public:
+            ResizeCoefficients();
+            ResizeCoefficients(const cv::Size& from_image_size, const cv::Size& to_image_size, const InterpolationType& interpolation);
+
+            static bool                     IsSupported(const InterpolationType& interpolation, int image_type);
+
+            cv::Size                        get_from_image_size()   const;
+            cv::Size                        get_to_image_size()     const;
+            InterpolationType               get_interpolation()     const;
+            const std::vector<int>&         get_x_offsets()         const;
+            const std::vector<short>&       get_x_coefficients()    const;
+            const std::vector<int>&         get_y_offsets()         const;
+            const std::vector<short>&       get_y_coefficients()    const;
+
+            cv::Rect                        GetSourceRegion(const cv::Rect& to_region) const;
+
+            void                            Apply(const cv::Mat& image, cv::Mat& resized_image) const;
+            void                            ApplyToRegion(const cv::Mat& image_region, const cv::Rect& to_region, cv::Mat& resized_region) const;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -3,7 +3,7 @@
 
 #include <improc/improc_defs.hpp>
 #include <improc/corecv/logger_improc.hpp>
-#include <improc/infrastructure/string.hpp>
+#include <improc/corecv/structures/enum_table.hpp>
 
 #include <opencv2/core.hpp>
 
@@ -25,10 +25,15 @@ namespace improc
 
         private:
             Value                       value_;
+            static constexpr EnumTable<Value,4>   kEnumTable {{ {"0-deg"  ,Value::k0Deg  }
+                                                              , {"90-deg" ,Value::k90Deg }
+                                                              , {"180-deg",Value::k180Deg}
+                                                              , {"270-deg",Value::k270Deg}
+                                                              }};
 
         public:
             RotationType();                              
-            explicit RotationType(const std::string& rotation_type_str);
+            explicit RotationType(std::string_view rotation_type_str);
 
             /**
              * @brief Construct a new improc::RotationType object
@@ -37,6 +42,22 @@ namespace improc
              */
             constexpr explicit          RotationType(Value rotation_type_value): value_(std::move(rotation_type_value)) {}
 
+            /**
+             * @brief Obtain rotation type from string description without allocating
+             * 
+             * @param rotation_type_str - rotation type description as string in any case
+             * @return std::optional<RotationType> - empty if the description is not valid
+             */
+            static constexpr std::optional<RotationType> TryParse(std::string_view rotation_type_str)
+            {
+                const std::optional<Value> kValue = kEnumTable.TryParse(rotation_type_str);
+                if (kValue.has_value() == false)
+                {
+                    return std::nullopt;
+                }
+                return RotationType(kValue.value());
+            }
+
             /**
              * @brief Obtain rotation type value
              */
@@ -59,8 +80,10 @@ namespace improc
             }
 
             //TODO: Start using image class
-            cv::Mat                     Apply       (const cv::Mat& image)          const;
-            cv::Mat                     ApplyInverse(const cv::Mat& rotated_image)  const;
+            cv::Mat                     Apply       (const cv::Mat& image)                          const;
+            void                        Apply       (const cv::Mat& image, cv::Mat& rotated_image)  const;
+            cv::Mat                     ApplyInverse(const cv::Mat& rotated_image)                  const;
+            void                        ApplyInverse(const cv::Mat& rotated_image, cv::Mat& image)  const;
     };
 }
 
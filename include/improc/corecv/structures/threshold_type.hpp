@@ -3,7 +3,7 @@
 
 #include <improc/improc_defs.hpp>
 #include <improc/corecv/logger_improc.hpp>
-#include <improc/infrastructure/string.hpp>
+#include <improc/corecv/structures/enum_table.hpp>
 
 #include <opencv2/imgproc.hpp>
 
@@ -17,16 +17,23 @@ namespace improc
         public:
             enum Value : IMPROC_ENUM_KEY_TYPE
             {
-                    kOtsu   = 0
-                ,   kBinary = 1
+                    kOtsu           = 0
+                ,   kBinary         = 1
+                ,   kAdaptiveMean   = 2
+                ,   kSauvola        = 3
             };
 
         private:
             Value                           value_;
+            static constexpr EnumTable<Value,4>   kEnumTable {{ {"otsu"          ,Value::kOtsu         }
+                                                              , {"binary"        ,Value::kBinary       }
+                                                              , {"adaptive_mean" ,Value::kAdaptiveMean }
+                                                              , {"sauvola"       ,Value::kSauvola      }
+                                                              }};
 
         public:
             ThresholdType();                              
-            explicit ThresholdType(const std::string& threshold_type_str);
+            explicit ThresholdType(std::string_view threshold_type_str);
 
             /**
              * @brief Construct a new improc::ThresholdType object
@@ -35,6 +42,22 @@ namespace improc
              */
             constexpr explicit              ThresholdType(Value threshold_type_value): value_(std::move(threshold_type_value)) {}
 
+            /**
+             * @brief Obtain threshold type from string description without allocating
+             * 
+             * @param threshold_type_str - threshold type description as string in any case
+             * @return std::optional<ThresholdType> - empty if the description is not valid
+             */
+            static constexpr std::optional<ThresholdType> TryParse(std::string_view threshold_type_str)
+            {
+                const std::optional<Value> kValue = kEnumTable.TryParse(threshold_type_str);
+                if (kValue.has_value() == false)
+                {
+                    return std::nullopt;
+                }
+                return ThresholdType(kValue.value());
+            }
+
             /**
              * @brief Obtain threshold type value
              */
@@ -47,15 +70,25 @@ namespace improc
             {
                 switch (this->value_)
                 {
-                    case ThresholdType::Value::kOtsu  : return "Otsu";    break;
-                    case ThresholdType::Value::kBinary: return "Binary";  break;
+                    case ThresholdType::Value::kOtsu         : return "Otsu";          break;
+                    case ThresholdType::Value::kBinary       : return "Binary";        break;
+                    case ThresholdType::Value::kAdaptiveMean : return "AdaptiveMean";  break;
+                    case ThresholdType::Value::kSauvola      : return "Sauvola";       break;
                     default:
                         throw improc::key_error("ToString method not defined for threshold type enum");
                 }
             }
 
             /**
-             * @brief Obtain threshold type OpenCV code
+             * @brief Check if threshold is computed for each pixel from the pixels in its window
+             */
+            constexpr bool                  IsAdaptive()  const
+            {
+                return this->value_ == ThresholdType::Value::kAdaptiveMean || this->value_ == ThresholdType::Value::kSauvola;
+            }
+
+            /**
+             * @brief Obtain threshold type OpenCV code. Adaptive thresholds do not have a cv::threshold code.
              */
             constexpr cv::ThresholdTypes    ToOpenCV()  const
             {
@@ -0,0 +1,67 @@
+#ifndef IMPROC_CORECV_WORK_STEALING_POOL_HPP
+#define IMPROC_CORECV_WORK_STEALING_POOL_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/corecv/logger_improc.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace improc
+{
+    /**
+     * @brief Thread pool where idle workers steal tasks from busy workers
+     *
+     * Each worker keeps its own task queue. Tasks submitted from a worker are queued on that worker and
+     * run newest first, so that follow-up tasks reuse the data still in its cache. Tasks submitted from
+     * other threads are distributed over the workers. Idle workers take the oldest task of another worker.
+     * Tasks should not throw and should not wait for other tasks of the same pool.
+     */
+    class IMPROC_API WorkStealingPool final
+    {
+        public:
+            typedef std::function<void()>       Task;
+
+        private:
+            struct Worker
+            {
+                std::mutex                      mutex;
+                std::deque<Task>                tasks;
+            };
+
+            std::vector<std::unique_ptr<Worker>> workers_;
+            std::vector<std::thread>            threads_;
+            std::mutex                          sleep_mutex_;
+            std::condition_variable             sleep_condition_;
+            size_t                              number_pending_;
+            bool                                is_running_;
+            std::atomic<size_t>                 next_worker_;
+            std::atomic<size_t>                 number_steals_;
+
+            bool                                TryTake(size_t worker_idx, Task& task);
+            void                                Work(size_t worker_idx);
+
+        public:
+            explicit WorkStealingPool(size_t number_threads = std::thread::hardware_concurrency());
+            ~WorkStealingPool();
+
+            WorkStealingPool(const WorkStealingPool&  that)     = delete;
+            WorkStealingPool(WorkStealingPool&&       that)     = delete;
+            void operator=(const WorkStealingPool&  that)       = delete;
+            void operator=(const WorkStealingPool&& that)       = delete;
+
+            void                                Submit(Task task);
+
+            size_t                              get_number_threads()    const;
+            size_t                              get_number_steals()     const;
+    };
+}
+
+#endif
\ No newline at end of file
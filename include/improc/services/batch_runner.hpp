@@ -0,0 +1,21 @@
+#ifndef IMPROC_SERVICES_BATCH_RUNNER_HPP
+#define IMPROC_SERVICES_BATCH_RUNNER_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/corecv/logger_improc.hpp>
+#include <improc/services/base_service.hpp>
+
+#include <opencv2/core.hpp>
+
+#include <exception>
+#include <mutex>
+#include <vector>
+
+namespace improc {
+    template <typename KeyType,typename ContextType>
+    void RunBatch(const improc::BaseService<KeyType,ContextType>& service, std::vector<improc::Context<KeyType,ContextType>>& contexts);
+}
+
+#include <improc/services/batch_runner.tpp>
+
+#endif
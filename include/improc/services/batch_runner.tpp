@@ -0,0 +1,45 @@
+/**
+ * @brief Run service over a batch of contexts in parallel
+ * 
+ * Each context holds the inputs and receives the outputs of one image, exactly as in the
+ * single image path. Contexts are distributed over the OpenCV parallel backend (TBB or OpenMP).
+ * Parallel calls performed by the service for a single image run sequentially inside the batch.
+ * 
+ * @tparam KeyType - key data type for context
+ * @tparam ContextType - value data type for context
+ * @param service - service to run for each context
+ * @param contexts - contexts with the inputs and outputs for each image
+ */
+template <typename KeyType,typename ContextType>
+void improc::RunBatch(const improc::BaseService<KeyType,ContextType>& service, std::vector<improc::Context<KeyType,ContextType>>& contexts)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Running service for batch of {} contexts...",contexts.size());
+    std::mutex          exception_mutex {};
+    std::exception_ptr  exception       {};
+    cv::parallel_for_( cv::Range(0,static_cast<int>(contexts.size()))
+                     , [&service,&contexts,&exception_mutex,&exception] (const cv::Range& range) -> void
+                       {
+                           for (int context_idx = range.start; context_idx < range.end; ++context_idx)
+                           {
+                               try
+                               {
+                                   service.Run(contexts[context_idx]);
+                               }
+                               catch (...)
+                               {
+                                   // Exceptions cannot leave the parallel backend. First exception is rethrown after the batch.
+                                   std::lock_guard<std::mutex> lock {exception_mutex};
+                                   if (exception == nullptr)
+                                   {
+                                       exception = std::current_exception();
+                                   }
+                               }
+                           }
+                       } );
+
+    if (exception != nullptr)
+    {
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_01: Service failed for at least one context of the batch.");
+        std::rethrow_exception(exception);
+    }
+}
\ No newline at end of file
@@ -3,8 +3,12 @@
 
 #include <improc/improc_defs.hpp>
 #include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/metrics.hpp>
 #include <improc/corecv/structures/color_space.hpp>
+#include <improc/corecv/structures/color_conversion_plan.hpp>
 #include <improc/corecv/image.hpp>
+#include <improc/corecv/context_image.hpp>
+#include <improc/corecv/parsers/binary_plan.hpp>
 #include <improc/services/base_service.hpp>
 
 namespace improc {
@@ -18,11 +22,14 @@ namespace improc {
             
             std::optional<ColorSpace>       from_color_space_;
             std::vector<ColorSpace>         to_color_space_;
+            std::optional<ColorConversionPlan> conversion_plan_;
 
         public:
             ConvertColorSpace();
 
             ConvertColorSpace&              Load(const Json::Value& service_json)                       override;
+            ConvertColorSpace&              Load(PlanReader& plan_reader);
+            void                            Save(PlanWriter& plan_writer)                               const;
             void                            Run (improc::Context<KeyType,ContextType>& context) const   override;
     };
 
@@ -2,14 +2,13 @@ template <typename KeyType,typename ContextType>
 improc::ConvertColorSpace<KeyType,ContextType>::ConvertColorSpace() : improc::BaseService<KeyType,ContextType>()
                                                                     , from_color_space_(std::optional<improc::ColorSpace>())
                                                                     , to_color_space_(std::vector<improc::ColorSpace>())
+                                                                    , conversion_plan_(std::optional<improc::ColorConversionPlan>())
 {}
 
 template <typename KeyType,typename ContextType>
 improc::ConvertColorSpace<KeyType,ContextType>& improc::ConvertColorSpace<KeyType,ContextType>::Load(const Json::Value& service_json)
 {
-    SPDLOG_LOGGER_CALL( improc::ImageProcLogger::get()->data()
-                      , spdlog::level::trace
-                      , "Loading configuration for color space conversion service..." );
+    IMPROC_CORECV_LOGGER_TRACE("Loading configuration for color space conversion service...");
     static const std::string kToColorSpaceKey   = "to_color_space";
     this->improc::BaseService<KeyType,ContextType>::Load(service_json);
 
@@ -17,9 +16,7 @@ improc::ConvertColorSpace<KeyType,ContextType>& improc::ConvertColorSpace<KeyTyp
     {
         const std::string kFromColorSpaceKey = "from_color_space";
 
-        SPDLOG_LOGGER_CALL( improc::ImageProcLogger::get()->data()
-                          , spdlog::level::info
-                          , "Analyzing field {} for color space service...",service_json_iter.name() );
+        IMPROC_CORECV_LOGGER_INFO("Analyzing field {} for color space service...",service_json_iter.name());
         if (service_json_iter.name() == kFromColorSpaceKey)
         {
             this->from_color_space_ = improc::ColorSpace(service_json_iter->asString());
@@ -46,29 +43,107 @@ improc::ConvertColorSpace<KeyType,ContextType>& improc::ConvertColorSpace<KeyTyp
         IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
         throw improc::json_error(std::move(error_message));
     }
+
+    if (this->from_color_space_.has_value() == true)
+    {
+        this->conversion_plan_ = improc::ColorConversionPlan(this->from_color_space_.value(),this->to_color_space_);
+    }
+    return (*this);
+}
+
+/**
+ * @brief Restore color space conversion service from plan record
+ * 
+ * @param plan_reader - plan reader positioned at the service record
+ */
+template <typename KeyType,typename ContextType>
+improc::ConvertColorSpace<KeyType,ContextType>& improc::ConvertColorSpace<KeyType,ContextType>::Load(improc::PlanReader& plan_reader)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Loading plan for color space conversion service...");
+    plan_reader.ReadService("ConvertColorSpace");
+    this->inputs_  = plan_reader.ReadKeys<KeyType>();
+    this->outputs_ = plan_reader.ReadKeys<KeyType>();
+
+    this->from_color_space_ = std::optional<improc::ColorSpace>();
+    if (plan_reader.ReadBool() == true)
+    {
+        this->from_color_space_ = plan_reader.ReadEnum<improc::ColorSpace>();
+    }
+    const uint32_t kNumberColorSpaces = plan_reader.ReadUInt32();
+    this->to_color_space_.clear();
+    for (uint32_t color_space_idx = 0; color_space_idx < kNumberColorSpaces; ++color_space_idx)
+    {
+        this->to_color_space_.push_back(plan_reader.ReadEnum<improc::ColorSpace>());
+    }
+
+    this->conversion_plan_ = std::optional<improc::ColorConversionPlan>();
+    if (this->from_color_space_.has_value() == true)
+    {
+        this->conversion_plan_ = improc::ColorConversionPlan(this->from_color_space_.value(),this->to_color_space_);
+    }
     return (*this);
 }
 
+/**
+ * @brief Write color space conversion service configuration as plan record
+ * 
+ * @param plan_writer - plan writer receiving the service record
+ */
+template <typename KeyType,typename ContextType>
+void improc::ConvertColorSpace<KeyType,ContextType>::Save(improc::PlanWriter& plan_writer) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Saving plan for color space conversion service...");
+    plan_writer.WriteService("ConvertColorSpace");
+    plan_writer.WriteKeys(this->inputs_);
+    plan_writer.WriteKeys(this->outputs_);
+    plan_writer.WriteBool(this->from_color_space_.has_value());
+    if (this->from_color_space_.has_value() == true)
+    {
+        plan_writer.WriteEnum(this->from_color_space_.value());
+    }
+    plan_writer.WriteUInt32(static_cast<uint32_t>(this->to_color_space_.size()));
+    for (const improc::ColorSpace& to_color_space : this->to_color_space_)
+    {
+        plan_writer.WriteEnum(to_color_space);
+    }
+}
+
 template <typename KeyType,typename ContextType>
 void improc::ConvertColorSpace<KeyType,ContextType>::Run(improc::Context<KeyType,ContextType>& context) const
 {
-    SPDLOG_LOGGER_CALL( improc::ImageProcLogger::get()->data()
-                      , spdlog::level::trace
-                      , "Running color space conversion service..." );
+    IMPROC_CORECV_LOGGER_TRACE("Running color space conversion service...");
+    IMPROC_CORECV_METRICS_SCOPE(metrics_record,"ConvertColorSpace");
+    // Color space images from a previous service are reused without validating their color space again
+    const auto& kImageContext = context.Get(this->inputs_[improc::ConvertColorSpace<KeyType,ContextType>::kImageDataKeyIndex]);
+    const std::optional<improc::ColorSpace> kContextColorSpace = improc::ContextImage::GetColorSpace(kImageContext);
     improc::ColorSpaceImage image {};
-    image.set_data(std::any_cast<cv::Mat>(context.Get(this->inputs_[improc::ConvertColorSpace<KeyType,ContextType>::kImageDataKeyIndex])));
-    if (this->from_color_space_.has_value() == true)
+    if (kContextColorSpace.has_value() == true && (this->from_color_space_.has_value() == false || this->from_color_space_.value() == kContextColorSpace.value()))
     {
-        image.set_color_space(this->from_color_space_.value());
+        image = std::any_cast<const improc::ColorSpaceImage&>(kImageContext);
     }
     else
     {
-        image.set_color_space(std::any_cast<improc::ColorSpace>(context.Get(this->inputs_[improc::ConvertColorSpace<KeyType,ContextType>::kColorSpaceKeyIndex])));
+        image.set_data(improc::ContextImage::GetData(kImageContext));
+        if (this->from_color_space_.has_value() == true)
+        {
+            image.set_color_space(this->from_color_space_.value());
+        }
+        else
+        {
+            image.set_color_space(std::any_cast<improc::ColorSpace>(context.Get(this->inputs_[improc::ConvertColorSpace<KeyType,ContextType>::kColorSpaceKeyIndex])));
+        }
     }
 
-    for (size_t to_color_space_idx = 0; to_color_space_idx < this->to_color_space_.size(); ++to_color_space_idx)
+    // Source color space from context is only known at runtime. Plan is built for the image color space.
+    std::optional<improc::ColorConversionPlan> runtime_conversion_plan {};
+    const improc::ColorConversionPlan& conversion_plan = this->conversion_plan_.has_value() == true
+                                                       ? this->conversion_plan_.value()
+                                                       : runtime_conversion_plan.emplace(image.get_color_space(),this->to_color_space_);
+    const std::vector<improc::ColorSpace>& conversions = conversion_plan.get_conversions();
+    for (size_t to_color_space_idx = 0; to_color_space_idx < conversions.size(); ++to_color_space_idx)
     {
-        image.ConvertToColorSpace(this->to_color_space_[to_color_space_idx]);
+        image.ConvertToColorSpace(conversions[to_color_space_idx]);
     }
-    context[this->outputs_[0]] = image;
+    IMPROC_CORECV_METRICS_SET_IMAGES(metrics_record,improc::ContextImage::GetData(kImageContext),image.get_data());
+    improc::ContextImage::Set(context[this->outputs_[0]],std::move(image));
 }
\ No newline at end of file
@@ -0,0 +1,56 @@
+#ifndef IMPROC_SERVICES_DECODE_IMAGE_HPP
+#define IMPROC_SERVICES_DECODE_IMAGE_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/metrics.hpp>
+#include <improc/corecv/image.hpp>
+#include <improc/corecv/context_image.hpp>
+#include <improc/corecv/parsers/binary_plan.hpp>
+#include <improc/corecv/image_allocator.hpp>
+#include <improc/corecv/parsers/image_header.hpp>
+#include <improc/corecv/parsers/json_parser.hpp>
+#include <improc/corecv/structures/color_space.hpp>
+#include <improc/services/base_service.hpp>
+
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+
+namespace improc {
+    /**
+     * @brief Decode image service
+     * 
+     * Decodes encoded image bytes into an image with a pooled buffer. The encoded bytes are given as
+     * a std::vector<uchar> or as continuous 8-bit image data. When a target size or scale is given, the
+     * decoded image has that size. JPEG images are decoded at 1/2, 1/4 or 1/8 of their size in the DCT
+     * domain whenever the reduced image is still larger than the target and only the residual is resized.
+     * EXIF orientation is not applied, so images are decoded as stored.
+     */
+    template <typename KeyType,typename ContextType>
+    class IMPROC_API Decode : public improc::BaseService<KeyType,ContextType>
+    {
+        private:
+            static constexpr unsigned int   kEncodedDataKeyIndex = 0;
+
+            ColorSpace                      to_color_space_;
+            std::optional<cv::Size>         to_image_size_;
+            std::optional<cv::Size2d>       scaling_;
+
+            cv::Size                        GetTargetSize(const cv::Size& image_size)                               const;
+            int                             GetReductionFactor(const std::optional<ImageHeader>& image_header)      const;
+
+        public:
+            Decode();
+
+            Decode&                         Load(const Json::Value& service_json)                       override;
+            Decode&                         Load(PlanReader& plan_reader);
+            void                            Save(PlanWriter& plan_writer)                               const;
+            void                            Run (improc::Context<KeyType,ContextType>& context) const   override;
+    };
+
+    typedef Decode<std::string,std::any>    StringKeyHeterogeneousDecode;
+}
+
+#include <improc/services/decode_image.tpp>
+
+#endif
\ No newline at end of file
@@ -0,0 +1,209 @@
+template <typename KeyType,typename ContextType>
+improc::Decode<KeyType,ContextType>::Decode()   : improc::BaseService<KeyType,ContextType>()
+                                                , to_color_space_(improc::ColorSpace::Value::kBGR)
+                                                , to_image_size_(std::optional<cv::Size>())
+                                                , scaling_(std::optional<cv::Size2d>())
+{}
+
+template <typename KeyType,typename ContextType>
+improc::Decode<KeyType,ContextType>& improc::Decode<KeyType,ContextType>::Load(const Json::Value& service_json)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Loading configuration for image decode service...");
+    static const std::string kToColorSpaceKey  = "to_color_space";
+    static const std::string kToImageSizeKey   = "to_image_size";
+    static const std::string kScaleKey         = "scale";
+    this->improc::BaseService<KeyType,ContextType>::Load(service_json);
+
+    this->to_color_space_ = improc::ColorSpace(improc::ColorSpace::Value::kBGR);
+    this->to_image_size_  = std::optional<cv::Size>();
+    this->scaling_        = std::optional<cv::Size2d>();
+    for (Json::Value::const_iterator service_json_iter = service_json.begin(); service_json_iter != service_json.end(); ++service_json_iter)
+    {
+        IMPROC_CORECV_LOGGER_INFO("Analyzing field {} for image decode service...",service_json_iter.name());
+        if (service_json_iter.name() == kToColorSpaceKey)
+        {
+            this->to_color_space_ = improc::ColorSpace(service_json_iter->asString());
+        }
+        else if (service_json_iter.name() == kToImageSizeKey)
+        {
+            this->to_image_size_ = improc::json::ReadPositiveSize<cv::Size>(*service_json_iter);
+        }
+        else if (service_json_iter.name() == kScaleKey)
+        {
+            this->scaling_ = improc::json::ReadPositiveSize<cv::Size2d>(*service_json_iter);
+        }
+    }
+
+    if (this->to_color_space_ != improc::ColorSpace::Value::kBGR && this->to_color_space_ != improc::ColorSpace::Value::kGray)
+    {
+        std::string error_message = fmt::format("Invalid {} {} for decode json. Only BGR and Gray are supported",kToColorSpaceKey,this->to_color_space_.ToString());
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::json_error(std::move(error_message));
+    }
+
+    if (this->to_image_size_.has_value() == true && this->scaling_.has_value() == true)
+    {
+        std::string error_message = fmt::format("Keys {} and {} provided for decode json. Only one can be provided",kToImageSizeKey,kScaleKey);
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::json_error(std::move(error_message));
+    }
+    return (*this);
+}
+
+/**
+ * @brief Obtain image size given by the target size or scale
+ * 
+ * @param image_size - size of the encoded image
+ */
+template <typename KeyType,typename ContextType>
+cv::Size improc::Decode<KeyType,ContextType>::GetTargetSize(const cv::Size& image_size) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining decode target size...");
+    if (this->to_image_size_.has_value() == true)
+    {
+        return this->to_image_size_.value();
+    }
+    return cv::Size( std::max(1,cv::saturate_cast<int>(image_size.width  * this->scaling_.value().width))
+                   , std::max(1,cv::saturate_cast<int>(image_size.height * this->scaling_.value().height)) );
+}
+
+/**
+ * @brief Obtain largest JPEG reduction that keeps the decoded image at least as large as the target size
+ * 
+ * @param image_header - header of the encoded image
+ */
+template <typename KeyType,typename ContextType>
+int improc::Decode<KeyType,ContextType>::GetReductionFactor(const std::optional<improc::ImageHeader>& image_header) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining decode reduction factor...");
+    // Reduced decoding is only done in the DCT domain for JPEG. Other formats are decoded at full size and resized.
+    if (image_header.has_value() == false || image_header.value().image_format != improc::ImageFormat::Value::kJPEG)
+    {
+        return 1;
+    }
+
+    const cv::Size kImageSize  = image_header.value().image_size;
+    const cv::Size kTargetSize = this->GetTargetSize(kImageSize);
+    for (int reduction_factor : {8,4,2})
+    {
+        if (kTargetSize.width * reduction_factor <= kImageSize.width && kTargetSize.height * reduction_factor <= kImageSize.height)
+        {
+            return reduction_factor;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Restore image decode service from plan record
+ * 
+ * @param plan_reader - plan reader positioned at the service record
+ */
+template <typename KeyType,typename ContextType>
+improc::Decode<KeyType,ContextType>& improc::Decode<KeyType,ContextType>::Load(improc::PlanReader& plan_reader)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Loading plan for image decode service...");
+    plan_reader.ReadService("Decode");
+    this->inputs_  = plan_reader.ReadKeys<KeyType>();
+    this->outputs_ = plan_reader.ReadKeys<KeyType>();
+
+    this->to_color_space_ = plan_reader.ReadEnum<improc::ColorSpace>();
+    this->to_image_size_  = std::optional<cv::Size>();
+    this->scaling_        = std::optional<cv::Size2d>();
+    if (plan_reader.ReadBool() == true)
+    {
+        this->to_image_size_ = plan_reader.ReadSize();
+    }
+    if (plan_reader.ReadBool() == true)
+    {
+        this->scaling_ = plan_reader.ReadSize2d();
+    }
+    return (*this);
+}
+
+/**
+ * @brief Write image decode service configuration as plan record
+ * 
+ * @param plan_writer - plan writer receiving the service record
+ */
+template <typename KeyType,typename ContextType>
+void improc::Decode<KeyType,ContextType>::Save(improc::PlanWriter& plan_writer) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Saving plan for image decode service...");
+    plan_writer.WriteService("Decode");
+    plan_writer.WriteKeys(this->inputs_);
+    plan_writer.WriteKeys(this->outputs_);
+    plan_writer.WriteEnum(this->to_color_space_);
+    plan_writer.WriteBool(this->to_image_size_.has_value());
+    if (this->to_image_size_.has_value() == true)
+    {
+        plan_writer.WriteSize(this->to_image_size_.value());
+    }
+    plan_writer.WriteBool(this->scaling_.has_value());
+    if (this->scaling_.has_value() == true)
+    {
+        plan_writer.WriteSize(this->scaling_.value());
+    }
+}
+
+template <typename KeyType,typename ContextType>
+void improc::Decode<KeyType,ContextType>::Run(improc::Context<KeyType,ContextType>& context) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Running image decode service...");
+    IMPROC_CORECV_METRICS_SCOPE(metrics_record,"Decode");
+    // Encoded bytes are wrapped without copying
+    cv::Mat encoded_data {};
+    const auto& encoded_context = context.Get(this->inputs_[improc::Decode<KeyType,ContextType>::kEncodedDataKeyIndex]);
+    if (encoded_context.type() == typeid(std::vector<uchar>))
+    {
+        const std::vector<uchar>& encoded_bytes = std::any_cast<const std::vector<uchar>&>(encoded_context);
+        if (encoded_bytes.empty() == false)
+        {
+            encoded_data = cv::Mat(1,static_cast<int>(encoded_bytes.size()),CV_8UC1,const_cast<uchar*>(encoded_bytes.data()));
+        }
+    }
+    else
+    {
+        encoded_data = std::any_cast<const cv::Mat&>(encoded_context);
+    }
+
+    const bool kHasTargetSize = this->to_image_size_.has_value() == true || this->scaling_.has_value() == true;
+    const std::optional<improc::ImageHeader> kImageHeader = kHasTargetSize == true && encoded_data.empty() == false
+                                                           ? improc::ImageHeader::Read(encoded_data)
+                                                           : std::optional<improc::ImageHeader>();
+    int decode_flags = this->to_color_space_ == improc::ColorSpace::Value::kGray ? cv::IMREAD_GRAYSCALE : cv::IMREAD_COLOR;
+    switch (kHasTargetSize == true ? this->GetReductionFactor(kImageHeader) : 1)
+    {
+        case 2: decode_flags = this->to_color_space_ == improc::ColorSpace::Value::kGray ? cv::IMREAD_REDUCED_GRAYSCALE_2 : cv::IMREAD_REDUCED_COLOR_2; break;
+        case 4: decode_flags = this->to_color_space_ == improc::ColorSpace::Value::kGray ? cv::IMREAD_REDUCED_GRAYSCALE_4 : cv::IMREAD_REDUCED_COLOR_4; break;
+        case 8: decode_flags = this->to_color_space_ == improc::ColorSpace::Value::kGray ? cv::IMREAD_REDUCED_GRAYSCALE_8 : cv::IMREAD_REDUCED_COLOR_8; break;
+        default: break;
+    }
+
+    cv::Mat image_data = improc::ImageAllocator::get().CreateMat();
+    if (encoded_data.empty() == false)
+    {
+        // EXIF orientation is ignored, so that the decoded image has the size read from the header
+        cv::imdecode(encoded_data,decode_flags | cv::IMREAD_IGNORE_ORIENTATION,&image_data);
+    }
+    if (image_data.empty() == true)
+    {
+        std::string error_message = "Cannot decode image. Encoded data is empty or has an unsupported format.";
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_03: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    if (kHasTargetSize == true)
+    {
+        // Reduced decoding only gets close to the target size. The residual resize gives the size of the target
+        // size or scale, so that the decoded image composes with the following services.
+        const cv::Size kTargetSize = this->GetTargetSize(kImageHeader.has_value() == true ? kImageHeader.value().image_size : image_data.size());
+        if (image_data.size() != kTargetSize)
+        {
+            cv::Mat resized_image_data = improc::ImageAllocator::get().CreateMat();
+            cv::resize(image_data,resized_image_data,kTargetSize,0,0,cv::INTER_LINEAR);
+            image_data = std::move(resized_image_data);
+        }
+    }
+    IMPROC_CORECV_METRICS_SET_IMAGES(metrics_record,encoded_data,image_data);
+    improc::ContextImage::SetData(context[this->outputs_[0]],std::move(image_data));
+}
\ No newline at end of file
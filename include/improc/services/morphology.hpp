@@ -0,0 +1,51 @@
+#ifndef IMPROC_SERVICES_MORPHOLOGY_HPP
+#define IMPROC_SERVICES_MORPHOLOGY_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/metrics.hpp>
+#include <improc/corecv/image.hpp>
+#include <improc/corecv/context_image.hpp>
+#include <improc/corecv/parsers/binary_plan.hpp>
+#include <improc/corecv/parsers/json_parser.hpp>
+#include <improc/corecv/structures/kernel_shape.hpp>
+#include <improc/corecv/structures/morphological_oper.hpp>
+#include <improc/corecv/kernels/rectangle_morphology.hpp>
+#include <improc/services/base_service.hpp>
+
+namespace improc {
+    /**
+     * @brief Morphological operation service
+     * 
+     * Applies a morphological operation with a rectangular or elliptical kernel. Rectangular kernels on 8-bit
+     * images use separable running minimum and maximum passes with iterations folded into a single pass.
+     * Other kernels and image types use cv::morphologyEx.
+     */
+    template <typename KeyType,typename ContextType>
+    class IMPROC_API Morphology : public improc::BaseService<KeyType,ContextType>
+    {
+        private:
+            static constexpr unsigned int   kImageDataKeyIndex  = 0;
+
+            MorphologicalOper               oper_;
+            KernelShape                     kernel_shape_;
+            cv::Size                        kernel_size_;
+            unsigned int                    number_iterations_;
+            cv::Mat                         kernel_;
+            RectangleMorphology             rectangle_morphology_;
+
+        public:
+            Morphology();
+
+            Morphology&                     Load(const Json::Value& service_json)                       override;
+            Morphology&                     Load(PlanReader& plan_reader);
+            void                            Save(PlanWriter& plan_writer)                               const;
+            void                            Run (improc::Context<KeyType,ContextType>& context) const   override;
+    };
+
+    typedef Morphology<std::string,std::any>    StringKeyHeterogeneousMorphology;
+}
+
+#include <improc/services/morphology.tpp>
+
+#endif
\ No newline at end of file
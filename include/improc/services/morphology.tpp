@@ -0,0 +1,143 @@
+template <typename KeyType,typename ContextType>
+improc::Morphology<KeyType,ContextType>::Morphology()   : improc::BaseService<KeyType,ContextType>()
+                                                        , oper_(improc::MorphologicalOper::kDilate)
+                                                        , kernel_shape_(improc::KernelShape::kRectangle)
+                                                        , kernel_size_(cv::Size(1,1))
+                                                        , number_iterations_(1)
+                                                        , kernel_(cv::Mat())
+                                                        , rectangle_morphology_(improc::RectangleMorphology())
+{}
+
+template <typename KeyType,typename ContextType>
+improc::Morphology<KeyType,ContextType>& improc::Morphology<KeyType,ContextType>::Load(const Json::Value& service_json)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Loading configuration for morphology service...");
+    static const std::string kTypeKey               = "type";
+    static const std::string kKernelKey             = "kernel";
+    static const std::string kKernelSizeKey         = "size";
+    static const std::string kNumberIterationsKey   = "number_iterations";
+    this->improc::BaseService<KeyType,ContextType>::Load(service_json);
+
+    bool is_type_loaded        = false;
+    bool is_kernel_size_loaded = false;
+    this->kernel_shape_      = improc::KernelShape(improc::KernelShape::kRectangle);
+    this->number_iterations_ = 1;
+    for (Json::Value::const_iterator service_json_iter = service_json.begin(); service_json_iter != service_json.end(); ++service_json_iter)
+    {
+        IMPROC_CORECV_LOGGER_INFO("Analyzing field {} for morphology service...",service_json_iter.name());
+        if (service_json_iter.name() == kTypeKey)
+        {
+            this->oper_ = improc::MorphologicalOper(service_json_iter->asString());
+            is_type_loaded = true;
+        }
+        else if (service_json_iter.name() == kKernelKey)
+        {
+            for (Json::Value::const_iterator kernel_json_iter = service_json_iter->begin(); kernel_json_iter != service_json_iter->end(); ++kernel_json_iter)
+            {
+                const std::string kKernelShapeKey = "shape";
+
+                IMPROC_CORECV_LOGGER_INFO("Analyzing kernel field {} for morphology service...",kernel_json_iter.name());
+                if (kernel_json_iter.name() == kKernelShapeKey)
+                {
+                    this->kernel_shape_ = improc::KernelShape(kernel_json_iter->asString());
+                }
+                else if (kernel_json_iter.name() == kKernelSizeKey)
+                {
+                    this->kernel_size_ = improc::json::ReadPositiveSize<cv::Size>(*kernel_json_iter);
+                    is_kernel_size_loaded = true;
+                }
+            }
+        }
+        else if (service_json_iter.name() == kNumberIterationsKey)
+        {
+            if (service_json_iter->isInt() == false || service_json_iter->asInt() <= 0)
+            {
+                std::string error_message = fmt::format("Key {} should be a positive integer for morphology json",kNumberIterationsKey);
+                IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+                throw improc::json_error(std::move(error_message));
+            }
+            this->number_iterations_ = service_json_iter->asUInt();
+        }
+    }
+
+    if (is_type_loaded == false)
+    {
+        std::string error_message = fmt::format("Key {} is missing from morphology json",kTypeKey);
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::json_error(std::move(error_message));
+    }
+
+    if (is_kernel_size_loaded == false)
+    {
+        std::string error_message = fmt::format("Key {} with {} is missing from morphology json",kKernelKey,kKernelSizeKey);
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_03: " + error_message);
+        throw improc::json_error(std::move(error_message));
+    }
+
+    this->kernel_               = cv::getStructuringElement(this->kernel_shape_.ToOpenCV(),this->kernel_size_);
+    this->rectangle_morphology_ = improc::RectangleMorphology(this->oper_,this->kernel_size_,this->number_iterations_);
+    return (*this);
+}
+
+/**
+ * @brief Restore morphology service from plan record
+ * 
+ * @param plan_reader - plan reader positioned at the service record
+ */
+template <typename KeyType,typename ContextType>
+improc::Morphology<KeyType,ContextType>& improc::Morphology<KeyType,ContextType>::Load(improc::PlanReader& plan_reader)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Loading plan for morphology service...");
+    plan_reader.ReadService("Morphology");
+    this->inputs_  = plan_reader.ReadKeys<KeyType>();
+    this->outputs_ = plan_reader.ReadKeys<KeyType>();
+
+    this->oper_              = plan_reader.ReadEnum<improc::MorphologicalOper>();
+    this->kernel_shape_      = plan_reader.ReadEnum<improc::KernelShape>();
+    this->kernel_size_       = plan_reader.ReadSize();
+    this->number_iterations_ = plan_reader.ReadUInt32();
+
+    this->kernel_               = cv::getStructuringElement(this->kernel_shape_.ToOpenCV(),this->kernel_size_);
+    this->rectangle_morphology_ = improc::RectangleMorphology(this->oper_,this->kernel_size_,this->number_iterations_);
+    return (*this);
+}
+
+/**
+ * @brief Write morphology service configuration as plan record
+ * 
+ * @param plan_writer - plan writer receiving the service record
+ */
+template <typename KeyType,typename ContextType>
+void improc::Morphology<KeyType,ContextType>::Save(improc::PlanWriter& plan_writer) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Saving plan for morphology service...");
+    plan_writer.WriteService("Morphology");
+    plan_writer.WriteKeys(this->inputs_);
+    plan_writer.WriteKeys(this->outputs_);
+    plan_writer.WriteEnum(this->oper_);
+    plan_writer.WriteEnum(this->kernel_shape_);
+    plan_writer.WriteSize(this->kernel_size_);
+    plan_writer.WriteUInt32(this->number_iterations_);
+}
+
+template <typename KeyType,typename ContextType>
+void improc::Morphology<KeyType,ContextType>::Run(improc::Context<KeyType,ContextType>& context) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Running morphology service...");
+    IMPROC_CORECV_METRICS_SCOPE(metrics_record,"Morphology");
+    // Image data is read by reference and the color space of color space images is kept
+    const auto& kImageContext = context.Get(this->inputs_[improc::Morphology<KeyType,ContextType>::kImageDataKeyIndex]);
+    const cv::Mat& kImageData = improc::ContextImage::GetData(kImageContext);
+    cv::Mat morphology_data = improc::ImageAllocator::get().CreateMat();
+    if (this->kernel_shape_ == improc::KernelShape::Value::kRectangle && improc::RectangleMorphology::IsSupported(kImageData.type()) == true)
+    {
+        this->rectangle_morphology_.Apply(kImageData,morphology_data);
+    }
+    else
+    {
+        cv::morphologyEx( kImageData,morphology_data,this->oper_.ToOpenCV(),this->kernel_
+                        , cv::Point(-1,-1),static_cast<int>(this->number_iterations_) );
+    }
+    IMPROC_CORECV_METRICS_SET_IMAGES(metrics_record,kImageData,morphology_data);
+    improc::ContextImage::SetData(context[this->outputs_[0]],std::move(morphology_data),improc::ContextImage::GetColorSpace(kImageContext));
+}
\ No newline at end of file
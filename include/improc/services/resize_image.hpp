@@ -3,27 +3,74 @@
 
 #include <improc/improc_defs.hpp>
 #include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/metrics.hpp>
 #include <improc/corecv/image.hpp>
-#include <improc/corecv/interpolation_type.hpp>
+#include <improc/corecv/context_image.hpp>
+#include <improc/corecv/parsers/binary_plan.hpp>
+#include <improc/corecv/parsers/json_parser.hpp>
+#include <improc/corecv/structures/color_space.hpp>
+#include <improc/corecv/structures/interpolation_type.hpp>
+#include <improc/corecv/structures/resize_coefficients.hpp>
+#include <improc/corecv/kernels/yuv_resize.hpp>
 #include <improc/services/base_service.hpp>
 
+#include <memory>
+#include <mutex>
+
 namespace improc {
-    // TODO: Review implementation and add tests
+    /**
+     * @brief Resize image service
+     * 
+     * Resizes the input image to a target size or by scaling factors. Scaling factors give the target size
+     * for each input image size, so that both produce the same image for the same target size. Resize
+     * coefficients are computed once for each input image size and reused across images.
+     * Fused YUV resizes are computed once for each input color space and image size.
+     * An optional second input provides a destination buffer that receives the resized image.
+     *
+     * Images are converted to an optional target color space. YUV images, given as color space images or
+     * as image data with the color space in the service json, require a target color space and are converted
+     * while resized, so that the full resolution color image is never stored. Other images are converted after
+     * being resized.
+     */
     template <typename KeyType,typename ContextType>
     class IMPROC_API Resize : public improc::BaseService<KeyType,ContextType>
     {
         private:
-            static constexpr unsigned int   kImageDataKeyIndex   = 0;
-            static constexpr unsigned int   kToImageSizeKeyIndex = 1;
+            static constexpr unsigned int   kImageDataKeyIndex       = 0;
+            static constexpr unsigned int   kDestinationDataKeyIndex = 1;
+            static constexpr size_t         kMaxCachedCoefficients   = 8;
+
+            /**
+             * @brief Resize coefficients and fused YUV resizes computed for each input image
+             */
+            struct CoefficientsCache
+            {
+                std::mutex                                              mutex;
+                std::vector<std::shared_ptr<const ResizeCoefficients>>  coefficients;
+                std::vector<std::shared_ptr<const YUVResize>>           yuv_resizes;
+            };
             
-            std::optional<cv::Size>         to_image_size_;
-            std::optional<cv::Size2d>       scaling_;
-            InterpolationType               interpolation_;
+            std::optional<cv::Size>             to_image_size_;
+            std::optional<cv::Size2d>           scaling_;
+            std::optional<ColorSpace>           from_color_space_;
+            std::optional<ColorSpace>           to_color_space_;
+            InterpolationType                   interpolation_;
+            std::shared_ptr<CoefficientsCache>  coefficients_cache_;
+
+            cv::Size                                    GetTargetSize(const cv::Size& from_image_size)      const;
+            std::shared_ptr<const ResizeCoefficients>   GetCoefficients(const cv::Size& from_image_size)    const;
+            std::shared_ptr<const YUVResize>            GetYUVResize(const ColorSpace& from_color_space, const cv::Size& from_image_size) const;
+
+            template <typename ResizeType, typename MatchFunction, typename CreateFunction>
+            std::shared_ptr<const ResizeType>           GetCached( std::vector<std::shared_ptr<const ResizeType>>& cache
+                                                                 , MatchFunction is_match, CreateFunction create )    const;
 
         public:
             Resize();
 
-            void                            Load(const Json::Value& service_json)                       override;
+            Resize&                         Load(const Json::Value& service_json)                       override;
+            Resize&                         Load(PlanReader& plan_reader);
+            void                            Save(PlanWriter& plan_writer)                               const;
             void                            Run (improc::Context<KeyType,ContextType>& context) const   override;
     };
 
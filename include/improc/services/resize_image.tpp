@@ -1,59 +1,239 @@
 template <typename KeyType,typename ContextType>
 improc::Resize<KeyType,ContextType>::Resize()   : improc::BaseService<KeyType,ContextType>()
                                                 , to_image_size_(std::optional<cv::Size>())
-                                                , scale_(std::optional<cv::Size2d>())
-                                                , interpolation_(improc::Interpolation:Type::kLinear)
+                                                , scaling_(std::optional<cv::Size2d>())
+                                                , from_color_space_(std::optional<improc::ColorSpace>())
+                                                , to_color_space_(std::optional<improc::ColorSpace>())
+                                                , interpolation_(improc::InterpolationType::kLinear)
+                                                , coefficients_cache_(nullptr)
 {}
 
 template <typename KeyType,typename ContextType>
-void improc::Resize<KeyType,ContextType>::Load(const Json::Value& service_json)
+improc::Resize<KeyType,ContextType>& improc::Resize<KeyType,ContextType>::Load(const Json::Value& service_json)
 {
     IMPROC_CORECV_LOGGER_TRACE("Loading configuration for image resize service...");
+    static const std::string kToImageSizeKey   = "to_image_size";
+    static const std::string kScaleKey         = "scale";
+    static const std::string kToColorSpaceKey  = "to_color_space";
     this->improc::BaseService<KeyType,ContextType>::Load(service_json);
 
+    this->to_image_size_    = std::optional<cv::Size>();
+    this->scaling_          = std::optional<cv::Size2d>();
+    this->from_color_space_ = std::optional<improc::ColorSpace>();
+    this->to_color_space_   = std::optional<improc::ColorSpace>();
+    this->interpolation_    = improc::InterpolationType(improc::InterpolationType::kLinear);
     for (Json::Value::const_iterator service_json_iter = service_json.begin(); service_json_iter != service_json.end(); ++service_json_iter)
     {
-        const std::string kInterpolationKey = "interpolation";
-        const std::string kToImageSizeKey   = "to_image_size";
-        const std::string kScaleKey         = "scale";
-        const std::string kWidthKey         = "width";
-        const std::string kHeightKey        = "height";
+        const std::string kInterpolationKey  = "interpolation";
+        const std::string kFromColorSpaceKey = "from_color_space";
 
         IMPROC_CORECV_LOGGER_INFO("Analyzing field {} for image resize service...",service_json_iter.name());
         if (service_json_iter.name() == kInterpolationKey)
         {
-            this->interpolation_ = service_json_iter->asString();
+            this->interpolation_ = improc::InterpolationType(service_json_iter->asString());
         }
         else if (service_json_iter.name() == kToImageSizeKey)
         {
-            for (Json::Value::const_iterator field_iter = service_json_iter->begin(); field_iter != service_json_iter->end(); ++field_iter)
-            {
-                IMPROC_CORECV_LOGGER_INFO("Analyzing field {} for image size...",service_json_iter.name());
-                if      (field_iter.name() == kWidthKey)   this->to_image_size_.width  = field_iter->asUInt();
-                else if (field_iter.name() == kHeightKey)  this->to_image_size_.height = field_iter->asUInt();
-            }
+            this->to_image_size_ = improc::json::ReadPositiveSize<cv::Size>(*service_json_iter);
         }
         else if (service_json_iter.name() == kScaleKey)
         {
-            for (Json::Value::const_iterator field_iter = service_json_iter->begin(); field_iter != service_json_iter->end(); ++field_iter)
-            {
-                IMPROC_CORECV_LOGGER_INFO("Analyzing field {} for image size...",service_json_iter.name());
-                if      (field_iter.name() == kWidthKey)   this->scaling_.width  = field_iter->asDouble();
-                else if (field_iter.name() == kHeightKey)  this->scaling_.height = field_iter->asDouble();
-            }
+            this->scaling_ = improc::json::ReadPositiveSize<cv::Size2d>(*service_json_iter);
+        }
+        else if (service_json_iter.name() == kFromColorSpaceKey)
+        {
+            this->from_color_space_ = improc::ColorSpace(service_json_iter->asString());
+        }
+        else if (service_json_iter.name() == kToColorSpaceKey)
+        {
+            this->to_color_space_ = improc::ColorSpace(service_json_iter->asString());
         }
     }
 
     if (this->to_image_size_.has_value() == false && this->scaling_.has_value() == false)
     {
-        IMPROC_CORECV_LOGGER_ERROR("ERROR_01: Target image size information missing.");
-        throw improc::file_processing_error();
+        std::string error_message = fmt::format("Key {} or {} is missing from resize json",kToImageSizeKey,kScaleKey);
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::json_error(std::move(error_message));
     }
 
     if (this->to_image_size_.has_value() == true && this->scaling_.has_value() == true)
     {
-        IMPROC_CORECV_LOGGER_ERROR("ERROR_02: Scaling and target image size provided. Only one can be provided");
-        throw improc::file_processing_error();
+        std::string error_message = fmt::format("Keys {} and {} provided for resize json. Only one can be provided",kToImageSizeKey,kScaleKey);
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::json_error(std::move(error_message));
+    }
+
+    if (this->to_color_space_.has_value() == true && this->to_color_space_.value().IsYUV() == true)
+    {
+        std::string error_message = fmt::format("Invalid {} for resize json. Images cannot be resized to {} color space",kToColorSpaceKey,this->to_color_space_.value().ToString());
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_03: " + error_message);
+        throw improc::json_error(std::move(error_message));
+    }
+
+    this->coefficients_cache_ = std::make_shared<CoefficientsCache>();
+    return (*this);
+}
+
+/**
+ * @brief Obtain cached resize object that matches or create and cache it. Oldest objects are released when the cache is full.
+ *
+ * @param cache - cached resize objects of the type
+ * @param is_match - check if cached resize object can be used
+ * @param create - create resize object. Called without holding the cache lock.
+ */
+template <typename KeyType,typename ContextType>
+template <typename ResizeType,typename MatchFunction,typename CreateFunction>
+std::shared_ptr<const ResizeType> improc::Resize<KeyType,ContextType>::GetCached( std::vector<std::shared_ptr<const ResizeType>>& cache
+                                                                                , MatchFunction is_match, CreateFunction create ) const
+{
+    {
+        std::lock_guard<std::mutex> lock {this->coefficients_cache_->mutex};
+        for (const std::shared_ptr<const ResizeType>& cached_resize : cache)
+        {
+            if (is_match(*cached_resize) == true)
+            {
+                return cached_resize;
+            }
+        }
+    }
+
+    std::shared_ptr<const ResizeType> resize = create();
+    std::lock_guard<std::mutex> lock {this->coefficients_cache_->mutex};
+    if (cache.size() >= improc::Resize<KeyType,ContextType>::kMaxCachedCoefficients)
+    {
+        IMPROC_CORECV_LOGGER_DEBUG("Resize coefficients cache is full. Releasing oldest coefficients.");
+        cache.erase(cache.begin());
+    }
+    cache.push_back(resize);
+    return resize;
+}
+
+/**
+ * @brief Obtain image size given by the target size or scale
+ *
+ * @param from_image_size - input image size
+ */
+template <typename KeyType,typename ContextType>
+cv::Size improc::Resize<KeyType,ContextType>::GetTargetSize(const cv::Size& from_image_size) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining resize target size...");
+    if (this->to_image_size_.has_value() == true)
+    {
+        return this->to_image_size_.value();
+    }
+    return cv::Size( std::max(1,cv::saturate_cast<int>(from_image_size.width  * this->scaling_.value().width))
+                   , std::max(1,cv::saturate_cast<int>(from_image_size.height * this->scaling_.value().height)) );
+}
+
+template <typename KeyType,typename ContextType>
+std::shared_ptr<const improc::ResizeCoefficients> improc::Resize<KeyType,ContextType>::GetCoefficients(const cv::Size& from_image_size) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining resize coefficients for image size {}x{}...",from_image_size.width,from_image_size.height);
+    return this->GetCached( this->coefficients_cache_->coefficients
+                          , [&from_image_size] (const improc::ResizeCoefficients& coefficients) -> bool
+                            {
+                                return coefficients.get_from_image_size() == from_image_size;
+                            }
+                          , [this,&from_image_size] () -> std::shared_ptr<const improc::ResizeCoefficients>
+                            {
+                                return std::make_shared<const improc::ResizeCoefficients>(from_image_size,this->GetTargetSize(from_image_size),this->interpolation_);
+                            } );
+}
+
+/**
+ * @brief Obtain fused YUV resize for input color space and image size
+ *
+ * @param from_color_space - YUV color space of the input image
+ * @param from_image_size - input image size, which is the luma plane size
+ */
+template <typename KeyType,typename ContextType>
+std::shared_ptr<const improc::YUVResize> improc::Resize<KeyType,ContextType>::GetYUVResize( const improc::ColorSpace& from_color_space
+                                                                                          , const cv::Size& from_image_size ) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining {} resize for image size {}x{}...",from_color_space.ToString(),from_image_size.width,from_image_size.height);
+    return this->GetCached( this->coefficients_cache_->yuv_resizes
+                          , [&from_color_space,&from_image_size] (const improc::YUVResize& yuv_resize) -> bool
+                            {
+                                return yuv_resize.get_from_color_space() == from_color_space && yuv_resize.get_from_image_size() == from_image_size;
+                            }
+                          , [this,&from_color_space,&from_image_size] () -> std::shared_ptr<const improc::YUVResize>
+                            {
+                                return std::make_shared<const improc::YUVResize>( from_color_space,this->to_color_space_.value()
+                                                                                , from_image_size,this->GetTargetSize(from_image_size),this->interpolation_ );
+                            } );
+}
+
+/**
+ * @brief Restore image resize service from plan record
+ * 
+ * @param plan_reader - plan reader positioned at the service record
+ */
+template <typename KeyType,typename ContextType>
+improc::Resize<KeyType,ContextType>& improc::Resize<KeyType,ContextType>::Load(improc::PlanReader& plan_reader)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Loading plan for image resize service...");
+    plan_reader.ReadService("Resize");
+    this->inputs_  = plan_reader.ReadKeys<KeyType>();
+    this->outputs_ = plan_reader.ReadKeys<KeyType>();
+
+    this->interpolation_ = plan_reader.ReadEnum<improc::InterpolationType>();
+    this->to_image_size_ = std::optional<cv::Size>();
+    this->scaling_       = std::optional<cv::Size2d>();
+    if (plan_reader.ReadBool() == true)
+    {
+        this->to_image_size_ = plan_reader.ReadSize();
+    }
+    else
+    {
+        this->scaling_ = plan_reader.ReadSize2d();
+    }
+    this->from_color_space_ = std::optional<improc::ColorSpace>();
+    if (plan_reader.ReadBool() == true)
+    {
+        this->from_color_space_ = plan_reader.ReadEnum<improc::ColorSpace>();
+    }
+    this->to_color_space_ = std::optional<improc::ColorSpace>();
+    if (plan_reader.ReadBool() == true)
+    {
+        this->to_color_space_ = plan_reader.ReadEnum<improc::ColorSpace>();
+    }
+
+    this->coefficients_cache_ = std::make_shared<CoefficientsCache>();
+    return (*this);
+}
+
+/**
+ * @brief Write image resize service configuration as plan record
+ * 
+ * @param plan_writer - plan writer receiving the service record
+ */
+template <typename KeyType,typename ContextType>
+void improc::Resize<KeyType,ContextType>::Save(improc::PlanWriter& plan_writer) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Saving plan for image resize service...");
+    plan_writer.WriteService("Resize");
+    plan_writer.WriteKeys(this->inputs_);
+    plan_writer.WriteKeys(this->outputs_);
+    plan_writer.WriteEnum(this->interpolation_);
+    plan_writer.WriteBool(this->to_image_size_.has_value());
+    if (this->to_image_size_.has_value() == true)
+    {
+        plan_writer.WriteSize(this->to_image_size_.value());
+    }
+    else
+    {
+        plan_writer.WriteSize(this->scaling_.value());
+    }
+    plan_writer.WriteBool(this->from_color_space_.has_value());
+    if (this->from_color_space_.has_value() == true)
+    {
+        plan_writer.WriteEnum(this->from_color_space_.value());
+    }
+    plan_writer.WriteBool(this->to_color_space_.has_value());
+    if (this->to_color_space_.has_value() == true)
+    {
+        plan_writer.WriteEnum(this->to_color_space_.value());
     }
 }
 
@@ -61,15 +241,62 @@ template <typename KeyType,typename ContextType>
 void improc::Resize<KeyType,ContextType>::Run(improc::Context<KeyType,ContextType>& context) const
 {
     IMPROC_CORECV_LOGGER_TRACE("Running image resize service...");
-    improc::Image image {};
-    image.set_data(std::any_cast<cv::Mat>(context.Get(this->inputs_[improc::Resize<KeyType,ContextType>::kImageDataKeyIndex])));
-    if (this->to_image_size_.has_value() == true)
+    IMPROC_CORECV_METRICS_SCOPE(metrics_record,"Resize");
+    if (this->coefficients_cache_ == nullptr)
+    {
+        std::string error_message = "Resize service should be loaded before running it.";
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_04: " + error_message);
+        throw improc::processing_flow_error(std::move(error_message));
+    }
+    // Image data is read by reference and the color space of color space images is kept
+    const auto& kImageContext = context.Get(this->inputs_[improc::Resize<KeyType,ContextType>::kImageDataKeyIndex]);
+    const cv::Mat& kImageData = improc::ContextImage::GetData(kImageContext);
+    std::optional<improc::ColorSpace> color_space = improc::ContextImage::GetColorSpace(kImageContext);
+    if (color_space.has_value() == false)
     {
-        image.Resize(this->to_image_size_.value(),this->interpolation_);
+        color_space = this->from_color_space_;
+    }
+
+    const bool kIsYUV = color_space.has_value() == true && color_space.value().IsYUV() == true;
+    if (kIsYUV == true && this->to_color_space_.has_value() == false)
+    {
+        std::string error_message = fmt::format("Target color space is required to resize {} images.",color_space.value().ToString());
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_05: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    cv::Mat resized_data = improc::ImageAllocator::get().CreateMat();
+    if (this->inputs_.size() > improc::Resize<KeyType,ContextType>::kDestinationDataKeyIndex)
+    {
+        resized_data = std::any_cast<cv::Mat>(context.Get(this->inputs_[improc::Resize<KeyType,ContextType>::kDestinationDataKeyIndex]));
+    }
+    if (kIsYUV == true)
+    {
+        this->GetYUVResize(color_space.value(),color_space.value().GetImageSize(kImageData.size()))->Apply(kImageData,resized_data);
+        color_space = this->to_color_space_;
+    }
+    else if (improc::ResizeCoefficients::IsSupported(this->interpolation_,kImageData.type()) == true)
+    {
+        this->GetCoefficients(kImageData.size())->Apply(kImageData,resized_data);
     }
     else
     {
-        image.Resize(this->scaling_.value(),this->interpolation_);
+        cv::resize(kImageData,resized_data,this->GetTargetSize(kImageData.size()),0,0,this->interpolation_.ToOpenCV());
+    }
+
+    if (this->to_color_space_.has_value() == true && color_space != this->to_color_space_)
+    {
+        if (color_space.has_value() == false)
+        {
+            std::string error_message = fmt::format("Color space of image is required to convert it to {}.",this->to_color_space_.value().ToString());
+            IMPROC_CORECV_LOGGER_ERROR("ERROR_06: " + error_message);
+            throw improc::value_error(std::move(error_message));
+        }
+        improc::ColorSpaceImage image {std::move(resized_data),color_space.value()};
+        image.ConvertToColorSpace(this->to_color_space_.value());
+        resized_data = image.get_data();
+        color_space  = this->to_color_space_;
     }
-    context[this->outputs_[0]] = image;
+    IMPROC_CORECV_METRICS_SET_IMAGES(metrics_record,kImageData,resized_data);
+    improc::ContextImage::SetData(context[this->outputs_[0]],std::move(resized_data),color_space);
 }
\ No newline at end of file
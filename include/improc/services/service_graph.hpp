@@ -0,0 +1,85 @@
+#ifndef IMPROC_SERVICES_SERVICE_GRAPH_HPP
+#define IMPROC_SERVICES_SERVICE_GRAPH_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/work_stealing_pool.hpp>
+#include <improc/services/base_service.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace improc {
+    /**
+     * @brief Concurrent runner of services that share a context
+     *
+     * Services are added in their sequential order. A service depends on every previous service that
+     * writes one of its inputs, writes one of its outputs or reads one of its outputs, so that services
+     * with conflicting keys keep their sequential order. Services without pending dependencies run
+     * concurrently on a work stealing pool. The shared context is not accessed concurrently: each service
+     * runs on its own context, which receives the service inputs and returns the service outputs to the
+     * shared context while a lock is held. Inputs read by a single service are moved and returned after
+     * the run, and inputs read by several services are copied, so context values should be cheap to copy,
+     * as images sharing their data. Outputs of services that fail or are skipped are not added to the
+     * shared context. Services are referenced, not copied, and should outlive the graph.
+     *
+     * @tparam KeyType - key data type for context
+     * @tparam ContextType - value data type for context
+     */
+    template <typename KeyType,typename ContextType>
+    class IMPROC_API ServiceGraph final
+    {
+        private:
+            struct Node
+            {
+                const improc::BaseService<KeyType,ContextType>* service;
+                std::vector<KeyType>                inputs;
+                std::vector<bool>                   is_input_shared;
+                std::vector<KeyType>                outputs;
+                std::vector<size_t>                 dependencies;
+                std::vector<size_t>                 successors;
+            };
+
+            /**
+             * @brief State of one run of the graph
+             */
+            struct Execution
+            {
+                improc::Context<KeyType,ContextType>*   context;
+                std::mutex                          context_mutex;
+                std::unique_ptr<std::atomic<size_t>[]>  pending_dependencies;
+                std::atomic<bool>                   has_failed;
+                std::mutex                          mutex;
+                std::condition_variable             condition;
+                size_t                              number_finished;
+                std::exception_ptr                  exception;
+            };
+
+            std::shared_ptr<WorkStealingPool>       pool_;
+            std::vector<Node>                       nodes_;
+
+            void                                    RunNode(Execution& execution, size_t node_idx) const;
+            void                                    RunService(Execution& execution, const Node& node) const;
+
+        public:
+            explicit ServiceGraph(std::shared_ptr<WorkStealingPool> pool = nullptr);
+
+            ServiceGraph&                           AddService(const improc::BaseService<KeyType,ContextType>& service);
+            const std::vector<size_t>&              GetDependencies(size_t service_idx)     const;
+            size_t                                  Size()                                  const;
+
+            void                                    Run(improc::Context<KeyType,ContextType>& context) const;
+    };
+
+    typedef ServiceGraph<std::string,std::any> StringKeyHeterogeneousServiceGraph;
+}
+
+#include <improc/services/service_graph.tpp>
+
+#endif
\ No newline at end of file
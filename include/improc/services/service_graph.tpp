@@ -0,0 +1,246 @@
+/**
+ * @brief Construct a new improc::ServiceGraph object
+ *
+ * @tparam KeyType - key data type for context
+ * @tparam ContextType - value data type for context
+ * @param pool - pool running the services. A pool with one thread per core is created if not provided.
+ */
+template <typename KeyType,typename ContextType>
+improc::ServiceGraph<KeyType,ContextType>::ServiceGraph(std::shared_ptr<improc::WorkStealingPool> pool)
+    : pool_(pool == nullptr ? std::make_shared<improc::WorkStealingPool>() : std::move(pool))
+    , nodes_(std::vector<Node>()) {}
+
+/**
+ * @brief Append service after the previous services. Service should be loaded, since its keys define its dependencies.
+ *
+ * @param service - service to be run on the context
+ */
+template <typename KeyType,typename ContextType>
+improc::ServiceGraph<KeyType,ContextType>& improc::ServiceGraph<KeyType,ContextType>::AddService(const improc::BaseService<KeyType,ContextType>& service)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Adding service {} to service graph...",this->nodes_.size());
+    const std::vector<KeyType>& kInputs  = service.get_inputs ();
+    const std::vector<KeyType>& kOutputs = service.get_outputs();
+    const auto kHasCommonKey = [] (const std::vector<KeyType>& keys, const std::vector<KeyType>& other_keys) -> bool
+                               {
+                                   return std::find_first_of(keys.begin(),keys.end(),other_keys.begin(),other_keys.end()) != keys.end();
+                               };
+
+    Node node {&service,kInputs,std::vector<bool>(kInputs.size(),false),kOutputs,{},{}};
+    const size_t kNodeIdx = this->nodes_.size();
+    for (size_t previous_idx = 0; previous_idx < kNodeIdx; ++previous_idx)
+    {
+        Node& previous_node = this->nodes_[previous_idx];
+        if ( kHasCommonKey(previous_node.outputs,kInputs)  == true
+          || kHasCommonKey(previous_node.outputs,kOutputs) == true
+          || kHasCommonKey(previous_node.inputs,kOutputs)  == true )
+        {
+            node.dependencies.push_back(previous_idx);
+            previous_node.successors.push_back(kNodeIdx);
+        }
+
+        // Inputs read by several services are copied, since readers of a key may run concurrently
+        for (size_t input_idx = 0; input_idx < kInputs.size(); ++input_idx)
+        {
+            for (size_t previous_input_idx = 0; previous_input_idx < previous_node.inputs.size(); ++previous_input_idx)
+            {
+                if (previous_node.inputs[previous_input_idx] == kInputs[input_idx])
+                {
+                    node.is_input_shared[input_idx]                   = true;
+                    previous_node.is_input_shared[previous_input_idx] = true;
+                }
+            }
+        }
+    }
+    for (size_t input_idx = 0; input_idx < kInputs.size(); ++input_idx)
+    {
+        if (std::count(kInputs.begin(),kInputs.end(),kInputs[input_idx]) > 1)
+        {
+            node.is_input_shared[input_idx] = true;
+        }
+    }
+    this->nodes_.push_back(std::move(node));
+    return (*this);
+}
+
+/**
+ * @brief Obtain indexes of the previous services that should finish before the service runs
+ *
+ * @param service_idx - index of the service in the order it was added
+ */
+template <typename KeyType,typename ContextType>
+const std::vector<size_t>& improc::ServiceGraph<KeyType,ContextType>::GetDependencies(size_t service_idx) const
+{
+    if (service_idx >= this->nodes_.size())
+    {
+        std::string error_message = fmt::format("Invalid service index {}. Graph has {} services.",service_idx,this->nodes_.size());
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    return this->nodes_[service_idx].dependencies;
+}
+
+/**
+ * @brief Obtain number of services in the graph
+ */
+template <typename KeyType,typename ContextType>
+size_t improc::ServiceGraph<KeyType,ContextType>::Size() const
+{
+    return this->nodes_.size();
+}
+
+/**
+ * @brief Run services on context, waiting until all services finish. Should not be called from a task of the graph pool.
+ *
+ * If a service fails, services that did not start yet are skipped and the first error is rethrown.
+ *
+ * @param context - context shared by the services
+ */
+template <typename KeyType,typename ContextType>
+void improc::ServiceGraph<KeyType,ContextType>::Run(improc::Context<KeyType,ContextType>& context) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Running service graph with {} services...",this->nodes_.size());
+    if (this->nodes_.empty() == true)
+    {
+        return;
+    }
+
+    Execution execution {};
+    execution.context              = &context;
+    execution.pending_dependencies = std::make_unique<std::atomic<size_t>[]>(this->nodes_.size());
+    execution.has_failed           = false;
+    execution.number_finished      = 0;
+    execution.exception            = nullptr;
+    for (size_t node_idx = 0; node_idx < this->nodes_.size(); ++node_idx)
+    {
+        execution.pending_dependencies[node_idx].store(this->nodes_[node_idx].dependencies.size(),std::memory_order_relaxed);
+    }
+    for (size_t node_idx = 0; node_idx < this->nodes_.size(); ++node_idx)
+    {
+        if (this->nodes_[node_idx].dependencies.empty() == true)
+        {
+            this->pool_->Submit([this,&execution,node_idx] () -> void {this->RunNode(execution,node_idx);});
+        }
+    }
+
+    {
+        std::unique_lock<std::mutex> lock {execution.mutex};
+        execution.condition.wait(lock,[this,&execution] () -> bool {return execution.number_finished == this->nodes_.size();});
+    }
+    if (execution.exception != nullptr)
+    {
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_02: Service failed while running service graph.");
+        std::rethrow_exception(execution.exception);
+    }
+}
+
+/**
+ * @brief Run service of node and submit the successors without pending dependencies
+ */
+template <typename KeyType,typename ContextType>
+void improc::ServiceGraph<KeyType,ContextType>::RunNode(Execution& execution, size_t node_idx) const
+{
+    const Node& kNode = this->nodes_[node_idx];
+    if (execution.has_failed.load(std::memory_order_acquire) == false)
+    {
+        try
+        {
+            this->RunService(execution,kNode);
+        }
+        catch (...)
+        {
+            execution.has_failed.store(true,std::memory_order_release);
+            std::lock_guard<std::mutex> lock {execution.mutex};
+            if (execution.exception == nullptr)
+            {
+                execution.exception = std::current_exception();
+            }
+        }
+    }
+
+    for (size_t successor_idx : kNode.successors)
+    {
+        if (execution.pending_dependencies[successor_idx].fetch_sub(1,std::memory_order_acq_rel) == 1)
+        {
+            this->pool_->Submit([this,&execution,successor_idx] () -> void {this->RunNode(execution,successor_idx);});
+        }
+    }
+
+    // Notified while locked, since the execution is destroyed as soon as the run sees all services finished
+    std::lock_guard<std::mutex> lock {execution.mutex};
+    if (++execution.number_finished == this->nodes_.size())
+    {
+        execution.condition.notify_all();
+    }
+}
+
+/**
+ * @brief Run service on its own context. Inputs are taken from the shared context and outputs are returned
+ * to it while the context lock is held, so that services never access the shared context concurrently.
+ */
+template <typename KeyType,typename ContextType>
+void improc::ServiceGraph<KeyType,ContextType>::RunService(Execution& execution, const Node& node) const
+{
+    improc::Context<KeyType,ContextType> service_context {};
+    std::vector<bool> is_input_moved (node.inputs.size(),false);
+    {
+        std::lock_guard<std::mutex> lock {execution.context_mutex};
+        for (size_t input_idx = 0; input_idx < node.inputs.size(); ++input_idx)
+        {
+            try
+            {
+                const ContextType& kInput = execution.context->Get(node.inputs[input_idx]);
+                if (node.is_input_shared[input_idx] == true)
+                {
+                    service_context.Add(node.inputs[input_idx],kInput);
+                }
+                else
+                {
+                    service_context.Add(node.inputs[input_idx],std::move((*execution.context)[node.inputs[input_idx]]));
+                    is_input_moved[input_idx] = true;
+                }
+            }
+            catch (const std::exception&)
+            {
+                // Missing inputs are reported by the service when it reads them
+            }
+        }
+    }
+
+    // Moved inputs are returned to the shared context even if the service fails
+    const auto kReturnInputs = [&execution,&node,&is_input_moved,&service_context] () -> void
+                               {
+                                   for (size_t input_idx = 0; input_idx < node.inputs.size(); ++input_idx)
+                                   {
+                                       if (is_input_moved[input_idx] == true)
+                                       {
+                                           (*execution.context)[node.inputs[input_idx]] = std::move(service_context[node.inputs[input_idx]]);
+                                       }
+                                   }
+                               };
+    try
+    {
+        node.service->Run(service_context);
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock {execution.context_mutex};
+        kReturnInputs();
+        throw;
+    }
+
+    std::lock_guard<std::mutex> lock {execution.context_mutex};
+    kReturnInputs();
+    for (const KeyType& output : node.outputs)
+    {
+        try
+        {
+            service_context.Get(output);
+        }
+        catch (const std::exception&)
+        {
+            continue;
+        }
+        (*execution.context)[output] = std::move(service_context[output]);
+    }
+}
\ No newline at end of file
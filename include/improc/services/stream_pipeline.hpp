@@ -0,0 +1,106 @@
+#ifndef IMPROC_SERVICES_STREAM_PIPELINE_HPP
+#define IMPROC_SERVICES_STREAM_PIPELINE_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/bounded_queue.hpp>
+#include <improc/services/base_service.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace improc {
+    /**
+     * @brief Streaming runner of a sequence of services
+     *
+     * Each stage runs one service on its own worker threads. Stages are connected by bounded queues of
+     * contexts, so that consecutive frames are processed by different stages at the same time. Contexts
+     * leave each stage in the order they entered it, even if the stage has several workers. Frames that
+     * fail in a stage are dropped and the first error is rethrown at the end of the stream. Services are
+     * referenced, not copied, and should outlive the pipeline.
+     *
+     * @tparam KeyType - key data type for context
+     * @tparam ContextType - value data type for context
+     */
+    template <typename KeyType,typename ContextType>
+    class IMPROC_API StreamPipeline final
+    {
+        public:
+            static constexpr size_t                 kDefaultQueueCapacity   = 4;
+
+            typedef improc::Context<KeyType,ContextType>    FrameContext;
+            typedef improc::BoundedQueue<FrameContext>      FrameQueue;
+
+            /**
+             * @brief Stage counters. Queue counters refer to the input queue of the stage.
+             */
+            struct StageStatistics
+            {
+                size_t                              number_workers;
+                size_t                              processed;
+                size_t                              failed;
+                std::chrono::nanoseconds            busy_time;
+                typename FrameQueue::Statistics     queue;
+            };
+
+        private:
+            struct Stage
+            {
+                const improc::BaseService<KeyType,ContextType>* service;
+                size_t                              number_workers;
+                std::mutex                          pop_mutex;
+                size_t                              pop_ticket;
+                std::mutex                          push_mutex;
+                std::condition_variable             push_condition;
+                size_t                              push_ticket;
+                size_t                              active_workers;
+                std::atomic<size_t>                 processed;
+                std::atomic<size_t>                 failed;
+                std::atomic<int64_t>                busy_time_ns;
+            };
+
+            size_t                                  queue_capacity_;
+            BackpressurePolicy                      backpressure_policy_;
+            std::vector<std::unique_ptr<Stage>>     stages_;
+            std::vector<std::unique_ptr<FrameQueue>> queues_;
+            std::vector<std::thread>                workers_;
+            std::mutex                              exception_mutex_;
+            std::exception_ptr                      exception_;
+
+            void                                    RunStage(size_t stage_idx);
+
+        public:
+            explicit StreamPipeline( size_t queue_capacity = kDefaultQueueCapacity
+                                   , BackpressurePolicy backpressure_policy = BackpressurePolicy::kBlock );
+            ~StreamPipeline();
+
+            StreamPipeline(const StreamPipeline&  that)     = delete;
+            StreamPipeline(StreamPipeline&&       that)     = delete;
+            void operator=(const StreamPipeline&  that)     = delete;
+            void operator=(const StreamPipeline&& that)     = delete;
+
+            StreamPipeline&                         AddStage(const improc::BaseService<KeyType,ContextType>& service, size_t number_workers = 1);
+            void                                    Start();
+
+            bool                                    Push(FrameContext&& context);
+            std::optional<FrameContext>             Pop();
+            void                                    Close();
+
+            std::vector<StageStatistics>            GetStatistics()         const;
+            typename FrameQueue::Statistics         GetOutputStatistics()   const;
+    };
+
+    typedef StreamPipeline<std::string,std::any> StringKeyHeterogeneousStreamPipeline;
+}
+
+#include <improc/services/stream_pipeline.tpp>
+
+#endif
\ No newline at end of file
@@ -0,0 +1,274 @@
+/**
+ * @brief Construct a new improc::StreamPipeline object
+ *
+ * @tparam KeyType - key data type for context
+ * @tparam ContextType - value data type for context
+ * @param queue_capacity - maximum number of contexts waiting in each queue. Should be a power of two.
+ * @param backpressure_policy - behavior of each queue when it is full
+ */
+template <typename KeyType,typename ContextType>
+improc::StreamPipeline<KeyType,ContextType>::StreamPipeline(size_t queue_capacity, improc::BackpressurePolicy backpressure_policy)
+    : queue_capacity_(queue_capacity)
+    , backpressure_policy_(backpressure_policy)
+    , stages_(std::vector<std::unique_ptr<Stage>>())
+    , queues_(std::vector<std::unique_ptr<FrameQueue>>())
+    , workers_(std::vector<std::thread>())
+    , exception_(nullptr)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Creating stream pipeline with queue capacity {}...",queue_capacity);
+    if (queue_capacity < 2 || (queue_capacity & (queue_capacity - 1)) != 0)
+    {
+        std::string error_message = fmt::format("Invalid queue capacity {}. Capacity should be a power of two.",queue_capacity);
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+}
+
+/**
+ * @brief Destroy the improc::StreamPipeline object. Contexts still in the pipeline are discarded.
+ */
+template <typename KeyType,typename ContextType>
+improc::StreamPipeline<KeyType,ContextType>::~StreamPipeline()
+{
+    for (std::unique_ptr<FrameQueue>& queue : this->queues_)
+    {
+        queue->Close();
+    }
+    for (std::thread& worker : this->workers_)
+    {
+        if (worker.joinable() == true)
+        {
+            worker.join();
+        }
+    }
+}
+
+/**
+ * @brief Append stage running service after the previous stages
+ *
+ * @param service - service run on each context. Service should outlive the pipeline.
+ * @param number_workers - number of threads running the service
+ */
+template <typename KeyType,typename ContextType>
+improc::StreamPipeline<KeyType,ContextType>& improc::StreamPipeline<KeyType,ContextType>::AddStage(const improc::BaseService<KeyType,ContextType>& service, size_t number_workers)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Adding stage {} with {} workers...",this->stages_.size(),number_workers);
+    if (number_workers == 0)
+    {
+        std::string error_message = "Invalid number of workers. Stage should have at least one worker.";
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    if (this->queues_.empty() == false)
+    {
+        std::string error_message = "Cannot add stage to a started pipeline.";
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_03: " + error_message);
+        throw improc::processing_flow_error(std::move(error_message));
+    }
+
+    std::unique_ptr<Stage> stage = std::make_unique<Stage>();
+    stage->service        = &service;
+    stage->number_workers = number_workers;
+    stage->pop_ticket     = 0;
+    stage->push_ticket    = 0;
+    stage->active_workers = number_workers;
+    stage->processed      = 0;
+    stage->failed         = 0;
+    stage->busy_time_ns   = 0;
+    this->stages_.push_back(std::move(stage));
+    return (*this);
+}
+
+/**
+ * @brief Create queues between stages and start workers
+ */
+template <typename KeyType,typename ContextType>
+void improc::StreamPipeline<KeyType,ContextType>::Start()
+{
+    IMPROC_CORECV_LOGGER_TRACE("Starting stream pipeline with {} stages...",this->stages_.size());
+    if (this->stages_.empty() == true)
+    {
+        std::string error_message = "Cannot start pipeline without stages.";
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_04: " + error_message);
+        throw improc::processing_flow_error(std::move(error_message));
+    }
+    if (this->queues_.empty() == false)
+    {
+        std::string error_message = "Pipeline already started.";
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_05: " + error_message);
+        throw improc::processing_flow_error(std::move(error_message));
+    }
+
+    // Stage i reads from queue i and writes to queue i + 1. Last queue holds the pipeline outputs.
+    for (size_t queue_idx = 0; queue_idx <= this->stages_.size(); ++queue_idx)
+    {
+        this->queues_.push_back(std::make_unique<FrameQueue>(this->queue_capacity_,this->backpressure_policy_));
+    }
+    for (size_t stage_idx = 0; stage_idx < this->stages_.size(); ++stage_idx)
+    {
+        for (size_t worker_idx = 0; worker_idx < this->stages_[stage_idx]->number_workers; ++worker_idx)
+        {
+            this->workers_.emplace_back([this,stage_idx] () -> void {this->RunStage(stage_idx);});
+        }
+    }
+}
+
+/**
+ * @brief Hand context to the first stage. When the first queue is full, waits or drops the oldest context according to the backpressure policy.
+ *
+ * @param context - context with the inputs of one frame
+ * @return bool - false if the pipeline is closed
+ */
+template <typename KeyType,typename ContextType>
+bool improc::StreamPipeline<KeyType,ContextType>::Push(FrameContext&& context)
+{
+    if (this->queues_.empty() == true)
+    {
+        std::string error_message = "Cannot push context to a pipeline that was not started.";
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_06: " + error_message);
+        throw improc::processing_flow_error(std::move(error_message));
+    }
+    return this->queues_.front()->Push(context);
+}
+
+/**
+ * @brief Obtain next processed context, in the order contexts were pushed
+ *
+ * @return std::optional<FrameContext> - empty at the end of the stream, after the pipeline is closed and all contexts were obtained
+ */
+template <typename KeyType,typename ContextType>
+std::optional<typename improc::StreamPipeline<KeyType,ContextType>::FrameContext> improc::StreamPipeline<KeyType,ContextType>::Pop()
+{
+    if (this->queues_.empty() == true)
+    {
+        std::string error_message = "Cannot pop context from a pipeline that was not started.";
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_06: " + error_message);
+        throw improc::processing_flow_error(std::move(error_message));
+    }
+
+    std::optional<FrameContext> context = this->queues_.back()->Pop();
+    if (context.has_value() == false)
+    {
+        std::exception_ptr exception {};
+        {
+            std::lock_guard<std::mutex> lock {this->exception_mutex_};
+            std::swap(exception,this->exception_);
+        }
+        if (exception != nullptr)
+        {
+            IMPROC_CORECV_LOGGER_ERROR("ERROR_07: Service failed for at least one context of the stream.");
+            std::rethrow_exception(exception);
+        }
+    }
+    return context;
+}
+
+/**
+ * @brief Signal end of stream. Contexts already pushed are still processed.
+ */
+template <typename KeyType,typename ContextType>
+void improc::StreamPipeline<KeyType,ContextType>::Close()
+{
+    IMPROC_CORECV_LOGGER_TRACE("Closing stream pipeline...");
+    if (this->queues_.empty() == false)
+    {
+        this->queues_.front()->Close();
+    }
+}
+
+/**
+ * @brief Obtain counters of each stage, so that the slowest stage can be identified
+ */
+template <typename KeyType,typename ContextType>
+std::vector<typename improc::StreamPipeline<KeyType,ContextType>::StageStatistics> improc::StreamPipeline<KeyType,ContextType>::GetStatistics() const
+{
+    std::vector<StageStatistics> statistics {};
+    statistics.reserve(this->stages_.size());
+    for (size_t stage_idx = 0; stage_idx < this->stages_.size(); ++stage_idx)
+    {
+        const Stage& kStage = *this->stages_[stage_idx];
+        statistics.push_back({ kStage.number_workers
+                             , kStage.processed.load(std::memory_order_relaxed)
+                             , kStage.failed.load(std::memory_order_relaxed)
+                             , std::chrono::nanoseconds(kStage.busy_time_ns.load(std::memory_order_relaxed))
+                             , this->queues_.empty() == true ? typename FrameQueue::Statistics {0,0,0,0,0.0}
+                                                             : this->queues_[stage_idx]->GetStatistics() });
+    }
+    return statistics;
+}
+
+/**
+ * @brief Obtain counters of the queue with the processed contexts
+ */
+template <typename KeyType,typename ContextType>
+typename improc::StreamPipeline<KeyType,ContextType>::FrameQueue::Statistics improc::StreamPipeline<KeyType,ContextType>::GetOutputStatistics() const
+{
+    if (this->queues_.empty() == true)
+    {
+        return {0,0,0,0,0.0};
+    }
+    return this->queues_.back()->GetStatistics();
+}
+
+/**
+ * @brief Run service of stage on the contexts of its input queue until the queue is closed and empty
+ */
+template <typename KeyType,typename ContextType>
+void improc::StreamPipeline<KeyType,ContextType>::RunStage(size_t stage_idx)
+{
+    Stage&      stage        = *this->stages_[stage_idx];
+    FrameQueue& input_queue  = *this->queues_[stage_idx];
+    FrameQueue& output_queue = *this->queues_[stage_idx + 1];
+    while (true)
+    {
+        // Tickets follow the queue order, so that contexts leave the stage in the order they entered it
+        std::optional<FrameContext> context {};
+        size_t ticket = 0;
+        {
+            std::lock_guard<std::mutex> lock {stage.pop_mutex};
+            context = input_queue.Pop();
+            if (context.has_value() == false)
+            {
+                break;
+            }
+            ticket = stage.pop_ticket++;
+        }
+
+        bool is_processed = true;
+        const std::chrono::steady_clock::time_point kStart = std::chrono::steady_clock::now();
+        try
+        {
+            stage.service->Run(context.value());
+        }
+        catch (...)
+        {
+            is_processed = false;
+            stage.failed.fetch_add(1,std::memory_order_relaxed);
+            std::lock_guard<std::mutex> lock {this->exception_mutex_};
+            if (this->exception_ == nullptr)
+            {
+                this->exception_ = std::current_exception();
+            }
+        }
+        stage.busy_time_ns.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - kStart).count(),std::memory_order_relaxed);
+
+        {
+            std::unique_lock<std::mutex> lock {stage.push_mutex};
+            stage.push_condition.wait(lock,[&stage,ticket] () -> bool {return stage.push_ticket == ticket;});
+            if (is_processed == true)
+            {
+                output_queue.Push(context.value());
+                stage.processed.fetch_add(1,std::memory_order_relaxed);
+            }
+            ++stage.push_ticket;
+        }
+        stage.push_condition.notify_all();
+    }
+
+    // Last worker of the stage signals the end of stream to the next stage
+    std::lock_guard<std::mutex> lock {stage.push_mutex};
+    if (--stage.active_workers == 0)
+    {
+        output_queue.Close();
+    }
+}
\ No newline at end of file
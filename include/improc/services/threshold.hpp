@@ -0,0 +1,52 @@
+#ifndef IMPROC_SERVICES_THRESHOLD_HPP
+#define IMPROC_SERVICES_THRESHOLD_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/metrics.hpp>
+#include <improc/corecv/image.hpp>
+#include <improc/corecv/context_image.hpp>
+#include <improc/corecv/parsers/binary_plan.hpp>
+#include <improc/corecv/structures/color_space.hpp>
+#include <improc/corecv/structures/threshold_type.hpp>
+#include <improc/corecv/kernels/luminance_threshold.hpp>
+#include <improc/services/base_service.hpp>
+
+namespace improc {
+    /**
+     * @brief Threshold service
+     * 
+     * Binarizes the luminance of a color space image with a fixed threshold, with the Otsu threshold or with
+     * an adaptive threshold computed from the window centered at each pixel. Luminance is computed on the fly,
+     * so the gray image is never stored. The input is a color space image or image data whose color space is
+     * given in the service json or as a second input. An optional second output receives the threshold applied
+     * and an optional third output receives the luminance integral image of adaptive thresholds, so that later
+     * box filters do not compute it again.
+     */
+    template <typename KeyType,typename ContextType>
+    class IMPROC_API Threshold : public improc::BaseService<KeyType,ContextType>
+    {
+        private:
+            static constexpr unsigned int   kImageDataKeyIndex  = 0;
+            static constexpr unsigned int   kColorSpaceKeyIndex = 1;
+            static constexpr unsigned int   kThresholdKeyIndex  = 1;
+            static constexpr unsigned int   kIntegralKeyIndex   = 2;
+
+            std::optional<ColorSpace>       from_color_space_;
+            LuminanceThreshold              luminance_threshold_;
+
+        public:
+            Threshold();
+
+            Threshold&                      Load(const Json::Value& service_json)                       override;
+            Threshold&                      Load(PlanReader& plan_reader);
+            void                            Save(PlanWriter& plan_writer)                               const;
+            void                            Run (improc::Context<KeyType,ContextType>& context) const   override;
+    };
+
+    typedef Threshold<std::string,std::any> StringKeyHeterogeneousThreshold;
+}
+
+#include <improc/services/threshold.tpp>
+
+#endif
\ No newline at end of file
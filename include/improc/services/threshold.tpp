@@ -0,0 +1,156 @@
+template <typename KeyType,typename ContextType>
+improc::Threshold<KeyType,ContextType>::Threshold() : improc::BaseService<KeyType,ContextType>()
+                                                    , from_color_space_(std::optional<improc::ColorSpace>())
+                                                    , luminance_threshold_(improc::LuminanceThreshold())
+{}
+
+template <typename KeyType,typename ContextType>
+improc::Threshold<KeyType,ContextType>& improc::Threshold<KeyType,ContextType>::Load(const Json::Value& service_json)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Loading configuration for threshold service...");
+    static const std::string kTypeKey       = "type";
+    static const std::string kThresholdKey  = "threshold";
+    static const std::string kWindowSizeKey = "window_size";
+    this->improc::BaseService<KeyType,ContextType>::Load(service_json);
+
+    std::optional<improc::ThresholdType> threshold_type {};
+    std::optional<double>                threshold      {};
+    double                               max_value      = 255.0;
+    int                                  window_size    = 0;
+    this->from_color_space_ = std::optional<improc::ColorSpace>();
+    for (Json::Value::const_iterator service_json_iter = service_json.begin(); service_json_iter != service_json.end(); ++service_json_iter)
+    {
+        const std::string kMaxValueKey       = "max_value";
+        const std::string kFromColorSpaceKey = "from_color_space";
+
+        IMPROC_CORECV_LOGGER_INFO("Analyzing field {} for threshold service...",service_json_iter.name());
+        if (service_json_iter.name() == kTypeKey)
+        {
+            threshold_type = improc::ThresholdType(service_json_iter->asString());
+        }
+        else if (service_json_iter.name() == kThresholdKey)
+        {
+            threshold = service_json_iter->asDouble();
+        }
+        else if (service_json_iter.name() == kMaxValueKey)
+        {
+            max_value = service_json_iter->asDouble();
+        }
+        else if (service_json_iter.name() == kWindowSizeKey)
+        {
+            window_size = service_json_iter->asInt();
+        }
+        else if (service_json_iter.name() == kFromColorSpaceKey)
+        {
+            this->from_color_space_ = improc::ColorSpace(service_json_iter->asString());
+        }
+    }
+
+    if (threshold_type.has_value() == false)
+    {
+        std::string error_message = fmt::format("Key {} is missing from threshold json",kTypeKey);
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::json_error(std::move(error_message));
+    }
+
+    if (threshold_type.value() == improc::ThresholdType::Value::kBinary && threshold.has_value() == false)
+    {
+        std::string error_message = fmt::format("Key {} is missing from binary threshold json",kThresholdKey);
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::json_error(std::move(error_message));
+    }
+
+    if (threshold_type.value().IsAdaptive() == true && service_json.isMember(kWindowSizeKey) == false)
+    {
+        std::string error_message = fmt::format("Key {} is missing from adaptive threshold json",kWindowSizeKey);
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_03: " + error_message);
+        throw improc::json_error(std::move(error_message));
+    }
+
+    // Sauvola k parameter defaults to the value recommended by Sauvola and Pietikainen
+    const double kDefaultThreshold = threshold_type.value() == improc::ThresholdType::Value::kSauvola ? 0.5 : 0.0;
+    this->luminance_threshold_ = improc::LuminanceThreshold(threshold_type.value(),threshold.value_or(kDefaultThreshold),max_value,window_size);
+    return (*this);
+}
+
+/**
+ * @brief Restore threshold service from plan record
+ * 
+ * @param plan_reader - plan reader positioned at the service record
+ */
+template <typename KeyType,typename ContextType>
+improc::Threshold<KeyType,ContextType>& improc::Threshold<KeyType,ContextType>::Load(improc::PlanReader& plan_reader)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Loading plan for threshold service...");
+    plan_reader.ReadService("Threshold");
+    this->inputs_  = plan_reader.ReadKeys<KeyType>();
+    this->outputs_ = plan_reader.ReadKeys<KeyType>();
+
+    this->from_color_space_ = std::optional<improc::ColorSpace>();
+    if (plan_reader.ReadBool() == true)
+    {
+        this->from_color_space_ = plan_reader.ReadEnum<improc::ColorSpace>();
+    }
+    const improc::ThresholdType kThresholdType = plan_reader.ReadEnum<improc::ThresholdType>();
+    const double                kThreshold     = plan_reader.ReadDouble();
+    const double                kMaxValue      = plan_reader.ReadDouble();
+    const int                   kWindowSize    = plan_reader.ReadInt32();
+    this->luminance_threshold_ = improc::LuminanceThreshold(kThresholdType,kThreshold,kMaxValue,kWindowSize);
+    return (*this);
+}
+
+/**
+ * @brief Write threshold service configuration as plan record
+ * 
+ * @param plan_writer - plan writer receiving the service record
+ */
+template <typename KeyType,typename ContextType>
+void improc::Threshold<KeyType,ContextType>::Save(improc::PlanWriter& plan_writer) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Saving plan for threshold service...");
+    plan_writer.WriteService("Threshold");
+    plan_writer.WriteKeys(this->inputs_);
+    plan_writer.WriteKeys(this->outputs_);
+    plan_writer.WriteBool(this->from_color_space_.has_value());
+    if (this->from_color_space_.has_value() == true)
+    {
+        plan_writer.WriteEnum(this->from_color_space_.value());
+    }
+    plan_writer.WriteEnum(this->luminance_threshold_.get_threshold_type());
+    plan_writer.WriteDouble(this->luminance_threshold_.get_threshold());
+    plan_writer.WriteDouble(this->luminance_threshold_.get_max_value());
+    plan_writer.WriteInt32(this->luminance_threshold_.get_window_size());
+}
+
+template <typename KeyType,typename ContextType>
+void improc::Threshold<KeyType,ContextType>::Run(improc::Context<KeyType,ContextType>& context) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Running threshold service...");
+    IMPROC_CORECV_METRICS_SCOPE(metrics_record,"Threshold");
+    // Image is either a color space image or image data with its color space in the service json or in a second input
+    const auto& kImageContext = context.Get(this->inputs_[improc::Threshold<KeyType,ContextType>::kImageDataKeyIndex]);
+    const cv::Mat& kImageData = improc::ContextImage::GetData(kImageContext);
+    std::optional<improc::ColorSpace> color_space = improc::ContextImage::GetColorSpace(kImageContext);
+    if (color_space.has_value() == false)
+    {
+        color_space = this->from_color_space_.has_value() == true
+                    ? this->from_color_space_.value()
+                    : std::any_cast<improc::ColorSpace>(context.Get(this->inputs_[improc::Threshold<KeyType,ContextType>::kColorSpaceKeyIndex]));
+    }
+
+    const bool kHasIntegralOutput = this->outputs_.size() > improc::Threshold<KeyType,ContextType>::kIntegralKeyIndex;
+    improc::IntegralImage integral_image {};
+    cv::Mat threshold_data = improc::ImageAllocator::get().CreateMat();
+    const double kThreshold = this->luminance_threshold_.Apply( kImageData,color_space.value(),threshold_data
+                                                              , kHasIntegralOutput == true ? &integral_image : nullptr );
+    IMPROC_CORECV_METRICS_SET_IMAGES(metrics_record,kImageData,threshold_data);
+    improc::ContextImage::Set(context[this->outputs_[0]],improc::ColorSpaceImage(std::move(threshold_data),improc::ColorSpace::Value::kGray));
+    if (this->outputs_.size() > improc::Threshold<KeyType,ContextType>::kThresholdKeyIndex)
+    {
+        context[this->outputs_[improc::Threshold<KeyType,ContextType>::kThresholdKeyIndex]] = kThreshold;
+    }
+    if (kHasIntegralOutput == true)
+    {
+        context[this->outputs_[improc::Threshold<KeyType,ContextType>::kIntegralKeyIndex]] = std::move(integral_image);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,252 @@
+#include <improc/corecv/async_ring_buffer_sink.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace
+{
+    static constexpr std::chrono::microseconds kIdleWaitTime {200};
+}
+
+/**
+ * @brief Construct a new improc::AsyncRingBufferSink object and start the background thread
+ *
+ * @param sinks - sinks that receive the records
+ * @param capacity - number of records kept in the ring buffer. Should be a power of two.
+ */
+improc::AsyncRingBufferSink::AsyncRingBufferSink(std::vector<spdlog::sink_ptr> sinks, size_t capacity) : spdlog::sinks::sink()
+                                                                                                     , sinks_(std::move(sinks))
+                                                                                                     , slots_(nullptr)
+                                                                                                     , mask_(0)
+                                                                                                     , enqueue_pos_(0)
+                                                                                                     , dequeue_pos_(0)
+                                                                                                     , dropped_records_(0)
+                                                                                                     , flush_pos_(0)
+                                                                                                     , flushed_pos_(0)
+                                                                                                     , is_running_(true)
+{
+    if (capacity < 2 || (capacity & (capacity - 1)) != 0)
+    {
+        std::string error_message = fmt::format("Invalid ring buffer capacity {}. Capacity should be a power of two.",capacity);
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    this->slots_ = std::make_unique<improc::AsyncRingBufferSink::Slot[]>(capacity);
+    this->mask_  = capacity - 1;
+    for (size_t slot_idx = 0; slot_idx < capacity; ++slot_idx)
+    {
+        this->slots_[slot_idx].sequence.store(slot_idx,std::memory_order_relaxed);
+    }
+    this->worker_ = std::thread([this] () -> void {this->Drain();});
+}
+
+/**
+ * @brief Destroy the improc::AsyncRingBufferSink object. Records in the ring buffer are written before the background thread stops.
+ */
+improc::AsyncRingBufferSink::~AsyncRingBufferSink()
+{
+    this->is_running_.store(false,std::memory_order_release);
+    if (this->worker_.joinable() == true)
+    {
+        this->worker_.join();
+    }
+}
+
+/**
+ * @brief Replace the sinks of logger by a ring buffer sink that writes to them.
+ * Sinks of a logger are not thread-safe, so the sink should be installed before logging starts.
+ *
+ * @param logger - logger to be made asynchronous
+ * @param capacity - number of records kept in the ring buffer. Should be a power of two.
+ */
+std::shared_ptr<improc::AsyncRingBufferSink> improc::AsyncRingBufferSink::Install(spdlog::logger& logger, size_t capacity)
+{
+    std::shared_ptr<improc::AsyncRingBufferSink> ring_buffer_sink = std::make_shared<improc::AsyncRingBufferSink>(logger.sinks(),capacity);
+    logger.sinks() = {ring_buffer_sink};
+    return ring_buffer_sink;
+}
+
+/**
+ * @brief Obtain number of records kept in the ring buffer
+ */
+size_t improc::AsyncRingBufferSink::get_capacity() const
+{
+    return this->mask_ + 1;
+}
+
+/**
+ * @brief Obtain number of records dropped because the ring buffer was full
+ */
+size_t improc::AsyncRingBufferSink::get_dropped_records() const
+{
+    return this->dropped_records_.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Copy record into the ring buffer. Record is dropped if the ring buffer is full.
+ */
+void improc::AsyncRingBufferSink::log(const spdlog::details::log_msg& msg)
+{
+    size_t position = this->enqueue_pos_.load(std::memory_order_relaxed);
+    improc::AsyncRingBufferSink::Slot* slot = nullptr;
+    while (true)
+    {
+        slot = &this->slots_[position & this->mask_];
+        const size_t   kSequence   = slot->sequence.load(std::memory_order_acquire);
+        const intptr_t kDifference = static_cast<intptr_t>(kSequence) - static_cast<intptr_t>(position);
+        if (kDifference == 0)
+        {
+            if (this->enqueue_pos_.compare_exchange_weak(position,position + 1,std::memory_order_relaxed) == true)
+            {
+                break;
+            }
+        }
+        else if (kDifference < 0)
+        {
+            this->dropped_records_.fetch_add(1,std::memory_order_relaxed);
+            return;
+        }
+        else
+        {
+            position = this->enqueue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+
+    improc::AsyncRingBufferSink::Record& record = slot->record;
+    record.level            = msg.level;
+    record.time             = msg.time;
+    record.thread_id        = msg.thread_id;
+    record.source           = msg.source;
+    record.logger_name_size = std::min(msg.logger_name.size(),improc::AsyncRingBufferSink::kMaxRecordSize);
+    record.payload_size     = std::min(msg.payload.size(),improc::AsyncRingBufferSink::kMaxRecordSize - record.logger_name_size);
+    std::memcpy(record.text,msg.logger_name.data(),record.logger_name_size);
+    std::memcpy(record.text + record.logger_name_size,msg.payload.data(),record.payload_size);
+    slot->sequence.store(position + 1,std::memory_order_release);
+}
+
+/**
+ * @brief Wait until records logged before the call are written and flush the sinks
+ */
+void improc::AsyncRingBufferSink::flush()
+{
+    const size_t kFlushPosition = this->enqueue_pos_.load(std::memory_order_acquire);
+    size_t flush_position = this->flush_pos_.load(std::memory_order_relaxed);
+    while (flush_position < kFlushPosition && this->flush_pos_.compare_exchange_weak(flush_position,kFlushPosition) == false);
+    while (this->flushed_pos_.load(std::memory_order_acquire) < kFlushPosition && this->is_running_.load(std::memory_order_acquire) == true)
+    {
+        std::this_thread::sleep_for(kIdleWaitTime);
+    }
+}
+
+/**
+ * @brief Set pattern of the sinks. Pattern is set while the background thread is not writing to the sinks.
+ */
+void improc::AsyncRingBufferSink::set_pattern(const std::string& pattern)
+{
+    std::lock_guard<std::mutex> lock {this->sinks_mutex_};
+    for (const spdlog::sink_ptr& sink : this->sinks_)
+    {
+        sink->set_pattern(pattern);
+    }
+}
+
+/**
+ * @brief Set formatter of the sinks. Formatter is set while the background thread is not writing to the sinks.
+ */
+void improc::AsyncRingBufferSink::set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter)
+{
+    std::lock_guard<std::mutex> lock {this->sinks_mutex_};
+    for (const spdlog::sink_ptr& sink : this->sinks_)
+    {
+        sink->set_formatter(sink_formatter->clone());
+    }
+}
+
+/**
+ * @brief Write next record of the ring buffer to the sinks
+ *
+ * @return bool - false if the next record is not available
+ */
+bool improc::AsyncRingBufferSink::Dequeue()
+{
+    const size_t kPosition = this->dequeue_pos_.load(std::memory_order_relaxed);
+    improc::AsyncRingBufferSink::Slot& slot = this->slots_[kPosition & this->mask_];
+    if (slot.sequence.load(std::memory_order_acquire) != kPosition + 1)
+    {
+        return false;
+    }
+
+    const improc::AsyncRingBufferSink::Record& record = slot.record;
+    spdlog::details::log_msg msg { record.time,record.source
+                                 , spdlog::string_view_t(record.text,record.logger_name_size)
+                                 , record.level
+                                 , spdlog::string_view_t(record.text + record.logger_name_size,record.payload_size) };
+    msg.thread_id = record.thread_id;
+    {
+        std::lock_guard<std::mutex> lock {this->sinks_mutex_};
+        for (const spdlog::sink_ptr& sink : this->sinks_)
+        {
+            if (sink->should_log(msg.level) == true)
+            {
+                try
+                {
+                    sink->log(msg);
+                }
+                catch (...)
+                {
+                    // Errors cannot be reported to the logging thread. Record is skipped for this sink.
+                }
+            }
+        }
+    }
+    slot.sequence.store(kPosition + this->mask_ + 1,std::memory_order_release);
+    this->dequeue_pos_.store(kPosition + 1,std::memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Write records to the sinks until the sink is destroyed
+ */
+void improc::AsyncRingBufferSink::Drain()
+{
+    while (true)
+    {
+        const bool kIsRunning = this->is_running_.load(std::memory_order_acquire);
+        bool is_empty = true;
+        while (this->Dequeue() == true)
+        {
+            is_empty = false;
+        }
+
+        const size_t kDequeuePosition = this->dequeue_pos_.load(std::memory_order_relaxed);
+        if ( this->flush_pos_.load(std::memory_order_acquire) > this->flushed_pos_.load(std::memory_order_relaxed)
+          && kDequeuePosition >= this->flush_pos_.load(std::memory_order_acquire) )
+        {
+            {
+                std::lock_guard<std::mutex> lock {this->sinks_mutex_};
+                for (const spdlog::sink_ptr& sink : this->sinks_)
+                {
+                    sink->flush();
+                }
+            }
+            this->flushed_pos_.store(kDequeuePosition,std::memory_order_release);
+        }
+
+        if (kIsRunning == false)
+        {
+            break;
+        }
+        if (is_empty == true)
+        {
+            std::this_thread::sleep_for(kIdleWaitTime);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock {this->sinks_mutex_};
+    for (const spdlog::sink_ptr& sink : this->sinks_)
+    {
+        sink->flush();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,268 @@
+#include <improc/corecv/parsers/binary_plan.hpp>
+#include <improc/corecv/metrics.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace
+{
+    void AppendLittleEndian(std::vector<uchar>& data, uint64_t value, size_t number_bytes)
+    {
+        for (size_t byte_idx = 0; byte_idx < number_bytes; ++byte_idx)
+        {
+            data.push_back(static_cast<uchar>(value >> (8 * byte_idx)));
+        }
+    }
+
+    uint64_t ReadLittleEndian(const uchar* data, size_t number_bytes)
+    {
+        uint64_t value = 0;
+        for (size_t byte_idx = 0; byte_idx < number_bytes; ++byte_idx)
+        {
+            value |= static_cast<uint64_t>(data[byte_idx]) << (8 * byte_idx);
+        }
+        return value;
+    }
+}
+
+/**
+ * @brief Construct a new improc::PlanWriter object with the plan header
+ */
+improc::PlanWriter::PlanWriter() : data_(std::vector<uchar>())
+{
+    IMPROC_CORECV_LOGGER_TRACE("Creating plan writer...");
+    this->data_.insert(this->data_.end(),std::begin(improc::PlanWriter::kMagic),std::end(improc::PlanWriter::kMagic));
+    this->WriteUInt32(improc::PlanWriter::kVersion);
+}
+
+/**
+ * @brief Start record of service configuration
+ *
+ * @param service_name - service name checked when the record is read
+ */
+void improc::PlanWriter::WriteService(std::string_view service_name)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Writing plan record for service {}...",service_name);
+    this->WriteString(service_name);
+}
+
+void improc::PlanWriter::WriteBool(bool value)
+{
+    this->data_.push_back(value == true ? 1 : 0);
+}
+
+void improc::PlanWriter::WriteUInt32(uint32_t value)
+{
+    AppendLittleEndian(this->data_,value,sizeof(uint32_t));
+}
+
+void improc::PlanWriter::WriteInt32(int32_t value)
+{
+    AppendLittleEndian(this->data_,static_cast<uint32_t>(value),sizeof(int32_t));
+}
+
+void improc::PlanWriter::WriteDouble(double value)
+{
+    uint64_t bits = 0;
+    std::memcpy(&bits,&value,sizeof(double));
+    AppendLittleEndian(this->data_,bits,sizeof(double));
+}
+
+void improc::PlanWriter::WriteString(std::string_view value)
+{
+    this->WriteUInt32(static_cast<uint32_t>(value.size()));
+    this->data_.insert(this->data_.end(),value.begin(),value.end());
+}
+
+void improc::PlanWriter::WriteSize(const cv::Size& value)
+{
+    this->WriteInt32(value.width);
+    this->WriteInt32(value.height);
+}
+
+void improc::PlanWriter::WriteSize(const cv::Size2d& value)
+{
+    this->WriteDouble(value.width);
+    this->WriteDouble(value.height);
+}
+
+/**
+ * @brief Obtain plan data
+ */
+const std::vector<uchar>& improc::PlanWriter::get_data() const
+{
+    return this->data_;
+}
+
+/**
+ * @brief Write plan data to file
+ *
+ * @param filepath - plan filepath
+ */
+void improc::PlanWriter::Save(const std::string& filepath) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Saving plan to {}...",filepath);
+    std::ofstream plan_file {filepath,std::ios::binary | std::ios::trunc};
+    plan_file.write(reinterpret_cast<const char*>(this->data_.data()),static_cast<std::streamsize>(this->data_.size()));
+    if (plan_file.good() == false)
+    {
+        std::string error_message = fmt::format("Cannot write plan file {}.",filepath);
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::file_processing_error(std::move(error_message));
+    }
+}
+
+/**
+ * @brief Construct a new improc::PlanReader object from plan file
+ *
+ * @param filepath - plan filepath
+ */
+improc::PlanReader::PlanReader(const std::string& filepath) : data_(std::vector<uchar>())
+                                                            , position_(0)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Reading plan from {}...",filepath);
+    IMPROC_CORECV_METRICS_SCOPE(metrics_record,"PlanReader::Read");
+    std::ifstream plan_file {filepath,std::ios::binary};
+    if (plan_file.is_open() == false)
+    {
+        std::string error_message = fmt::format("Cannot open plan file {}.",filepath);
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::file_processing_error(std::move(error_message));
+    }
+    this->data_.assign(std::istreambuf_iterator<char>(plan_file),std::istreambuf_iterator<char>());
+    this->ReadHeader();
+}
+
+/**
+ * @brief Construct a new improc::PlanReader object from plan data
+ *
+ * @param data - plan data written by PlanWriter
+ */
+improc::PlanReader::PlanReader(std::vector<uchar> data) : data_(std::move(data))
+                                                        , position_(0)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Reading plan from data...");
+    IMPROC_CORECV_METRICS_SCOPE(metrics_record,"PlanReader::Read");
+    this->ReadHeader();
+}
+
+void improc::PlanReader::ReadHeader()
+{
+    if ( this->data_.size() < sizeof(improc::PlanWriter::kMagic)
+      || std::memcmp(this->data_.data(),improc::PlanWriter::kMagic,sizeof(improc::PlanWriter::kMagic)) != 0 )
+    {
+        std::string error_message = "Invalid plan data. Plan does not start with the plan magic.";
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::file_processing_error(std::move(error_message));
+    }
+    this->position_ = sizeof(improc::PlanWriter::kMagic);
+
+    const uint32_t kVersion = this->ReadUInt32();
+    if (kVersion != improc::PlanWriter::kVersion)
+    {
+        std::string error_message = fmt::format("Invalid plan version {}. Expected version {}.",kVersion,improc::PlanWriter::kVersion);
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_03: " + error_message);
+        throw improc::file_processing_error(std::move(error_message));
+    }
+}
+
+const uchar* improc::PlanReader::Consume(size_t size)
+{
+    if (size > this->data_.size() - this->position_)
+    {
+        std::string error_message = fmt::format("Invalid plan data. Plan ends at byte {} while reading {} bytes.",this->data_.size(),size);
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_04: " + error_message);
+        throw improc::file_processing_error(std::move(error_message));
+    }
+    const uchar* data = this->data_.data() + this->position_;
+    this->position_ += size;
+    return data;
+}
+
+void improc::PlanReader::ThrowInvalidEnum(int32_t value) const
+{
+    std::string error_message = fmt::format("Invalid plan data. Enum value {} is not defined.",value);
+    IMPROC_CORECV_LOGGER_ERROR("ERROR_05: " + error_message);
+    throw improc::file_processing_error(std::move(error_message));
+}
+
+/**
+ * @brief Check if all service records were read
+ */
+bool improc::PlanReader::IsEnd() const
+{
+    return this->position_ == this->data_.size();
+}
+
+/**
+ * @brief Obtain name of the next service record without reading it
+ */
+std::string_view improc::PlanReader::PeekService()
+{
+    const size_t kPosition = this->position_;
+    const std::string_view kServiceName = this->ReadString();
+    this->position_ = kPosition;
+    return kServiceName;
+}
+
+/**
+ * @brief Start reading record of service configuration
+ *
+ * @param service_name - expected service name
+ */
+void improc::PlanReader::ReadService(std::string_view service_name)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Reading plan record for service {}...",service_name);
+    const std::string_view kServiceName = this->ReadString();
+    if (kServiceName != service_name)
+    {
+        std::string error_message = fmt::format("Invalid plan record. Expected service {} received {}.",service_name,kServiceName);
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_06: " + error_message);
+        throw improc::file_processing_error(std::move(error_message));
+    }
+}
+
+bool improc::PlanReader::ReadBool()
+{
+    return *this->Consume(1) != 0;
+}
+
+uint32_t improc::PlanReader::ReadUInt32()
+{
+    return static_cast<uint32_t>(ReadLittleEndian(this->Consume(sizeof(uint32_t)),sizeof(uint32_t)));
+}
+
+int32_t improc::PlanReader::ReadInt32()
+{
+    return static_cast<int32_t>(this->ReadUInt32());
+}
+
+double improc::PlanReader::ReadDouble()
+{
+    const uint64_t kBits = ReadLittleEndian(this->Consume(sizeof(double)),sizeof(double));
+    double value = 0.0;
+    std::memcpy(&value,&kBits,sizeof(double));
+    return value;
+}
+
+/**
+ * @brief Read string. String view refers to the plan data and is valid while the reader exists.
+ */
+std::string_view improc::PlanReader::ReadString()
+{
+    const uint32_t kSize = this->ReadUInt32();
+    return std::string_view(reinterpret_cast<const char*>(this->Consume(kSize)),kSize);
+}
+
+cv::Size improc::PlanReader::ReadSize()
+{
+    const int32_t kWidth = this->ReadInt32();
+    return cv::Size(kWidth,this->ReadInt32());
+}
+
+cv::Size2d improc::PlanReader::ReadSize2d()
+{
+    const double kWidth = this->ReadDouble();
+    return cv::Size2d(kWidth,this->ReadDouble());
+}
\ No newline at end of file
@@ -0,0 +1,161 @@
+#include <improc/corecv/structures/color_conversion_plan.hpp>
+
+namespace
+{
+    /**
+     * @brief Information kept by a color space. A conversion through a color space
+     * with less information than the source and target color spaces is lossy.
+     * HSV and Lab quantize color to 8 bits, so conversions through them are lossy.
+     */
+    enum class ColorInformation : unsigned int
+    {
+            kLuminance          = 0
+        ,   kSubsampledColor    = 1
+        ,   kQuantizedColor     = 2
+        ,   kColor              = 3
+        ,   kColorAlpha         = 4
+    };
+
+    ColorInformation GetColorInformation(const improc::ColorSpace& color_space)
+    {
+        switch (color_space)
+        {
+            case improc::ColorSpace::Value::kGray: return ColorInformation::kLuminance;   break;
+            case improc::ColorSpace::Value::kBGR : return ColorInformation::kColor;       break;
+            case improc::ColorSpace::Value::kRGB : return ColorInformation::kColor;       break;
+            case improc::ColorSpace::Value::kBGRA: return ColorInformation::kColorAlpha;  break;
+            case improc::ColorSpace::Value::kRGBA: return ColorInformation::kColorAlpha;  break;
+            case improc::ColorSpace::Value::kNV12: return ColorInformation::kSubsampledColor; break;
+            case improc::ColorSpace::Value::kI420: return ColorInformation::kSubsampledColor; break;
+            case improc::ColorSpace::Value::kYUYV: return ColorInformation::kSubsampledColor; break;
+            case improc::ColorSpace::Value::kHSV : return ColorInformation::kQuantizedColor;  break;
+            case improc::ColorSpace::Value::kLab : return ColorInformation::kQuantizedColor;  break;
+            default:
+                throw improc::key_error("GetColorInformation method not defined for color space enum");
+        }
+    }
+
+    /**
+     * @brief Check if the conversion from -> to only reorders color channels or drops or adds an opaque alpha channel.
+     */
+    bool IsChannelSwizzle(const improc::ColorSpace& from_color_space, const improc::ColorSpace& to_color_space)
+    {
+        return GetColorInformation(from_color_space) >= ColorInformation::kColor
+            && GetColorInformation(to_color_space)   >= ColorInformation::kColor;
+    }
+
+    /**
+     * @brief Check if the conversions from -> intermediate -> to produce the same image as from -> to. There should be a
+     * direct conversion from -> to: YUV color spaces are only obtained from color images as I420 and HSV and Lab are only
+     * converted from and to RGB and BGR. Conversions from YUV are only collapsed when followed by a channel swizzle, since
+     * the direct conversions to gray and YUV copy the luminance plane instead of converting the color image. Conversions
+     * from or to HSV and Lab are never collapsed, since their 8-bit round trips lose hues of gray pixels and colors outside
+     * the RGB gamut.
+     */
+    bool IsCollapsible( const improc::ColorSpace& from_color_space
+                      , const improc::ColorSpace& intermediate_color_space
+                      , const improc::ColorSpace& to_color_space )
+    {
+        if (GetColorInformation(from_color_space) == ColorInformation::kQuantizedColor
+            || GetColorInformation(to_color_space) == ColorInformation::kQuantizedColor)
+        {
+            return false;
+        }
+        if (GetColorInformation(from_color_space) == ColorInformation::kSubsampledColor
+            && IsChannelSwizzle(intermediate_color_space,to_color_space) == false)
+        {
+            return false;
+        }
+        return (from_color_space == to_color_space || from_color_space.HasColorConversionCode(to_color_space) == true)
+            && GetColorInformation(intermediate_color_space) >= std::min( GetColorInformation(from_color_space)
+                                                                        , GetColorInformation(to_color_space) );
+    }
+}
+
+/**
+ * @brief Construct a new improc::ColorConversionPlan object
+ */
+improc::ColorConversionPlan::ColorConversionPlan() : from_color_space_(improc::ColorSpace::kRGB)
+                                                   , to_color_space_(std::vector<improc::ColorSpace>()) {}
+
+/**
+ * @brief Construct a new improc::ColorConversionPlan object
+ *
+ * @param from_color_space - source color space
+ * @param to_color_space - sequence of target color spaces
+ */
+improc::ColorConversionPlan::ColorConversionPlan( const improc::ColorSpace& from_color_space
+                                                , const std::vector<improc::ColorSpace>& to_color_space ) : ColorConversionPlan()
+{
+    IMPROC_CORECV_LOGGER_TRACE("Creating color conversion plan from {} with {} conversions...", from_color_space.ToString(), to_color_space.size());
+    this->from_color_space_ = from_color_space;
+
+    // Color spaces visited by the plan. The first element is the source color space.
+    std::vector<improc::ColorSpace> color_spaces {from_color_space};
+    color_spaces.reserve(to_color_space.size() + 1);
+    for (const improc::ColorSpace& next_color_space : to_color_space)
+    {
+        if (next_color_space == color_spaces.back())
+        {
+            IMPROC_CORECV_LOGGER_DEBUG("Dropping conversion to {}. Image is already in target color space.", next_color_space.ToString());
+            continue;
+        }
+        color_spaces.push_back(next_color_space);
+
+        while (color_spaces.size() >= 3)
+        {
+            const size_t kIntermediateIdx = color_spaces.size() - 2;
+            if (IsCollapsible(color_spaces[kIntermediateIdx - 1],color_spaces[kIntermediateIdx],color_spaces[kIntermediateIdx + 1]) == false)
+            {
+                break;
+            }
+
+            IMPROC_CORECV_LOGGER_DEBUG("Collapsing conversion through {}.", color_spaces[kIntermediateIdx].ToString());
+            color_spaces.erase(color_spaces.begin() + kIntermediateIdx);
+            if (color_spaces[kIntermediateIdx - 1] == color_spaces[kIntermediateIdx])
+            {
+                color_spaces.pop_back();
+            }
+        }
+    }
+    this->to_color_space_.assign(color_spaces.begin() + 1,color_spaces.end());
+}
+
+/**
+ * @brief Obtain source color space
+ */
+improc::ColorSpace improc::ColorConversionPlan::get_from_color_space() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining source color space...");
+    return this->from_color_space_;
+}
+
+/**
+ * @brief Obtain color space of the image after applying the plan
+ */
+improc::ColorSpace improc::ColorConversionPlan::get_to_color_space() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining target color space...");
+    if (this->to_color_space_.empty() == true)
+    {
+        return this->from_color_space_;
+    }
+    return this->to_color_space_.back();
+}
+
+/**
+ * @brief Obtain sequence of conversions to be performed
+ */
+const std::vector<improc::ColorSpace>& improc::ColorConversionPlan::get_conversions() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining color conversions...");
+    return this->to_color_space_;
+}
+
+/**
+ * @brief Check if the plan does not require any conversion
+ */
+bool improc::ColorConversionPlan::IsIdentity() const
+{
+    return this->to_color_space_.empty();
+}
@@ -10,14 +10,60 @@ improc::ColorSpace::ColorSpace() : value_(improc::ColorSpace::kRGB) {};
  * 
  * @param color_space_str - color space description as string
  */
-improc::ColorSpace::ColorSpace(const std::string& color_space_str)
+improc::ColorSpace::ColorSpace(std::string_view color_space_str)
 {
     IMPROC_CORECV_LOGGER_TRACE("Creating color space from string {}...", color_space_str);
-    static const std::unordered_map<std::string,ColorSpace::Value> kToElemType = { {"rgb" ,ColorSpace::Value::kRGB }
-                                                                                 , {"bgr" ,ColorSpace::Value::kBGR }
-                                                                                 , {"rgba",ColorSpace::Value::kRGBA}
-                                                                                 , {"bgra",ColorSpace::Value::kBGRA}
-                                                                                 , {"gray",ColorSpace::Value::kGray}
-                                                                                 };
-    this->value_ = kToElemType.at(improc::String::ToLower(std::move(color_space_str)));
+    this->value_ = improc::ColorSpace::kEnumTable.Parse(color_space_str);
 }
+
+
+/**
+ * @brief Obtain size of the image data storing an image of size. Planar YUV images store the
+ * chroma planes below the luma plane.
+ * 
+ * @param image_size - image size in pixels
+ */
+cv::Size improc::ColorSpace::GetDataSize(const cv::Size& image_size) const
+{
+    if (this->value_ == improc::ColorSpace::kNV12 || this->value_ == improc::ColorSpace::kI420)
+    {
+        return cv::Size(image_size.width,image_size.height * 3 / 2);
+    }
+    return image_size;
+}
+
+/**
+ * @brief Obtain size in pixels of the image stored in image data of size
+ * 
+ * @param data_size - image data size
+ */
+cv::Size improc::ColorSpace::GetImageSize(const cv::Size& data_size) const
+{
+    if (this->value_ == improc::ColorSpace::kNV12 || this->value_ == improc::ColorSpace::kI420)
+    {
+        return cv::Size(data_size.width,data_size.height * 2 / 3);
+    }
+    return data_size;
+}
+
+/**
+ * @brief Check if image data of size stores a complete image. YUV images should have even width
+ * and planar YUV images should also have an even number of luma rows.
+ * 
+ * @param data_size - image data size
+ */
+bool improc::ColorSpace::IsValidDataSize(const cv::Size& data_size) const
+{
+    switch (this->value_)
+    {
+        case improc::ColorSpace::Value::kNV12:
+        case improc::ColorSpace::Value::kI420:
+            return data_size.width % 2 == 0 && data_size.height % 3 == 0;
+            break;
+        case improc::ColorSpace::Value::kYUYV:
+            return data_size.width % 2 == 0;
+            break;
+        default:
+            return true;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include <improc/corecv/context_image.hpp>
+
+/**
+ * @brief Obtain image data stored in context value without copying it
+ *
+ * @param context_value - context value with image data, an image or a color space image
+ * @return const cv::Mat& - image data owned by the context value
+ */
+const cv::Mat& improc::ContextImage::GetData(const std::any& context_value)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining image data from context value...");
+    if (const cv::Mat* image_data = std::any_cast<cv::Mat>(&context_value); image_data != nullptr)
+    {
+        return *image_data;
+    }
+    if (const improc::ColorSpaceImage* image = std::any_cast<improc::ColorSpaceImage>(&context_value); image != nullptr)
+    {
+        return image->get_data();
+    }
+    if (const improc::Image* image = std::any_cast<improc::Image>(&context_value); image != nullptr)
+    {
+        return image->get_data();
+    }
+
+    std::string error_message = fmt::format("Context value type {} is not an image.",context_value.type().name());
+    IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+    throw improc::not_supported_data_type(std::move(error_message));
+}
+
+/**
+ * @brief Obtain color space of image stored in context value
+ *
+ * @param context_value - context value with image data, an image or a color space image
+ * @return std::optional<improc::ColorSpace> - empty if the context value does not have a color space image
+ */
+std::optional<improc::ColorSpace> improc::ContextImage::GetColorSpace(const std::any& context_value)
+{
+    const improc::ColorSpaceImage* image = std::any_cast<improc::ColorSpaceImage>(&context_value);
+    if (image == nullptr)
+    {
+        return std::nullopt;
+    }
+    return image->get_color_space();
+}
+
+/**
+ * @brief Move image data into context value as a color space image, if a color space is given, or as an image
+ *
+ * @param context_value - context value receiving the image
+ * @param image_data - 8-bit image data moved into the context value
+ * @param color_space - image color space
+ */
+void improc::ContextImage::SetData(std::any& context_value, cv::Mat&& image_data, const std::optional<improc::ColorSpace>& color_space)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Setting image data in context value...");
+    if (color_space.has_value() == true)
+    {
+        improc::ContextImage::Set(context_value,improc::ColorSpaceImage(std::move(image_data),color_space.value()));
+    }
+    else
+    {
+        improc::ContextImage::Set(context_value,improc::Image(std::move(image_data)));
+    }
+}
\ No newline at end of file
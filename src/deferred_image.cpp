@@ -0,0 +1,484 @@
+#include <improc/corecv/deferred_image.hpp>
+#include <improc/corecv/image_allocator.hpp>
+#include <improc/corecv/kernels/channel_swizzle.hpp>
+#include <improc/corecv/structures/resize_coefficients.hpp>
+
+#include <opencv2/imgproc.hpp>
+
+#include <optional>
+
+namespace
+{
+    /**
+     * @brief Region of an image followed by a clockwise rotation
+     */
+    struct Geometry
+    {
+        cv::Rect                                region;
+        improc::RotationType::Value             rotation;
+    };
+
+    /**
+     * @brief Operations executed together for each output tile. Color conversions are stored as the chain of
+     * color spaces, starting with the color space of the stage input.
+     */
+    struct Stage
+    {
+        Geometry                                pre_geometry;
+        std::vector<improc::ColorSpace>         pre_color_spaces;
+        std::optional<improc::ResizeCoefficients> resize;
+        Geometry                                post_geometry;
+        std::vector<improc::ColorSpace>         post_color_spaces;
+    };
+
+    /**
+     * @brief Obtain region of the image that gives a region of the rotated image
+     *
+     * @param rotated_region - region of the rotated image
+     * @param image_size - image size before rotation
+     * @param rotation - clockwise rotation
+     */
+    cv::Rect GetUnrotatedRegion(const cv::Rect& rotated_region, const cv::Size& image_size, improc::RotationType::Value rotation)
+    {
+        switch (rotation)
+        {
+            // rotated(row,col) = image(rows - 1 - col, row)
+            case improc::RotationType::Value::k90Deg : return cv::Rect( rotated_region.y, image_size.height - rotated_region.x - rotated_region.width
+                                                                      , rotated_region.height, rotated_region.width );  break;
+            case improc::RotationType::Value::k180Deg: return cv::Rect( image_size.width  - rotated_region.x - rotated_region.width
+                                                                      , image_size.height - rotated_region.y - rotated_region.height
+                                                                      , rotated_region.width, rotated_region.height );  break;
+            // rotated(row,col) = image(col, cols - 1 - row)
+            case improc::RotationType::Value::k270Deg: return cv::Rect( image_size.width - rotated_region.y - rotated_region.height, rotated_region.x
+                                                                      , rotated_region.height, rotated_region.width );  break;
+            default:                                   return rotated_region;
+        }
+    }
+
+    /**
+     * @brief Obtain size of the image after the geometry
+     */
+    cv::Size GetSize(const Geometry& geometry)
+    {
+        if (geometry.rotation == improc::RotationType::Value::k90Deg || geometry.rotation == improc::RotationType::Value::k270Deg)
+        {
+            return cv::Size(geometry.region.height,geometry.region.width);
+        }
+        return geometry.region.size();
+    }
+
+    /**
+     * @brief Compose crop of the image after the geometry with the geometry
+     */
+    void AddCrop(Geometry& geometry, const cv::Rect& region)
+    {
+        geometry.region = GetUnrotatedRegion(region,geometry.region.size(),geometry.rotation) + geometry.region.tl();
+    }
+
+    /**
+     * @brief Compose rotation of the image after the geometry with the geometry
+     */
+    void AddRotation(Geometry& geometry, const improc::RotationType& rotation)
+    {
+        geometry.rotation = static_cast<improc::RotationType::Value>((geometry.rotation + rotation) % 4);
+    }
+
+    /**
+     * @brief Check if conversion reorders or copies channels without dropping any of them
+     */
+    bool IsLosslessSwizzle(const improc::ColorSpace& from_color_space, const improc::ColorSpace& to_color_space)
+    {
+        return improc::ChannelSwizzle::IsSwizzle(from_color_space,to_color_space) == true
+            && to_color_space.GetNumberChannels() >= from_color_space.GetNumberChannels();
+    }
+
+    /**
+     * @brief Check if converting before or after a resize gives the same image. Nearest resizes only copy pixels.
+     * Linear resizes interpolate each channel, so conversions that reorder, copy or drop channels commute with them.
+     * Alpha channels added by a conversion are not interpolated exactly and do not commute.
+     */
+    bool CommutesWithResize( const improc::ColorSpace& from_color_space, const improc::ColorSpace& to_color_space
+                           , const improc::InterpolationType& interpolation )
+    {
+        if (interpolation == improc::InterpolationType::Value::kNearest)
+        {
+            return true;
+        }
+        return improc::ChannelSwizzle::IsSwizzle(from_color_space,to_color_space) == true
+            && (to_color_space.GetNumberChannels() <= from_color_space.GetNumberChannels() || to_color_space.GetNumberChannels() == 3);
+    }
+
+    /**
+     * @brief Remove intermediate color spaces reached by lossless swizzles. Converting from the previous
+     * color space reads the same values, and returning to the previous color space is removed.
+     */
+    void SimplifyColorSpaces(std::vector<improc::ColorSpace>& color_spaces)
+    {
+        size_t color_space_idx = 1;
+        while (color_space_idx + 1 < color_spaces.size())
+        {
+            const improc::ColorSpace& kFromColorSpace = color_spaces[color_space_idx - 1];
+            const improc::ColorSpace& kToColorSpace   = color_spaces[color_space_idx + 1];
+            if ( IsLosslessSwizzle(kFromColorSpace,color_spaces[color_space_idx]) == true
+              && (kFromColorSpace == kToColorSpace || kFromColorSpace.HasColorConversionCode(kToColorSpace) == true) )
+            {
+                color_spaces.erase(color_spaces.begin() + color_space_idx);
+                if (kFromColorSpace == color_spaces[color_space_idx])
+                {
+                    color_spaces.erase(color_spaces.begin() + color_space_idx);
+                }
+                color_space_idx = 1;
+            }
+            else
+            {
+                ++color_space_idx;
+            }
+        }
+    }
+
+    /**
+     * @brief Convert tile along the chain of color spaces
+     */
+    void ConvertTile(cv::Mat& tile, const std::vector<improc::ColorSpace>& color_spaces)
+    {
+        for (size_t color_space_idx = 1; color_space_idx < color_spaces.size(); ++color_space_idx)
+        {
+            improc::ColorSpaceImage tile_image {tile,color_spaces[color_space_idx - 1]};
+            tile_image.ConvertToColorSpace(color_spaces[color_space_idx]);
+            tile = tile_image.get_data();
+        }
+    }
+
+    Stage CreateStage(const improc::ColorSpaceImage& image)
+    {
+        Stage stage {};
+        stage.pre_geometry     = Geometry {cv::Rect(cv::Point(),image.get_data().size()),improc::RotationType::Value::k0Deg};
+        stage.pre_color_spaces = {image.get_color_space()};
+        return stage;
+    }
+
+    /**
+     * @brief Execute stage for each output tile, from the source region read by the tile to the output
+     */
+    improc::ColorSpaceImage RunStage(const improc::ColorSpaceImage& image, Stage stage)
+    {
+        if (stage.resize.has_value() == true)
+        {
+            // Convert on the side of the resize with fewer pixels. Conversions that add channels are kept after
+            // upscales, since resizing the added channels costs more than converting the larger image.
+            const improc::InterpolationType kInterpolation = stage.resize->get_interpolation();
+            if (stage.resize->get_to_image_size().area() < stage.resize->get_from_image_size().area())
+            {
+                while ( stage.pre_color_spaces.size() > 1
+                     && CommutesWithResize(stage.pre_color_spaces.rbegin()[1],stage.pre_color_spaces.back(),kInterpolation) == true )
+                {
+                    stage.post_color_spaces.insert(stage.post_color_spaces.begin(),stage.pre_color_spaces.rbegin()[1]);
+                    stage.pre_color_spaces.pop_back();
+                }
+            }
+            else
+            {
+                while ( stage.post_color_spaces.size() > 1
+                     && stage.post_color_spaces[1].GetNumberChannels() <= stage.post_color_spaces[0].GetNumberChannels()
+                     && CommutesWithResize(stage.post_color_spaces[0],stage.post_color_spaces[1],kInterpolation) == true )
+                {
+                    stage.pre_color_spaces.push_back(stage.post_color_spaces[1]);
+                    stage.post_color_spaces.erase(stage.post_color_spaces.begin());
+                }
+            }
+            SimplifyColorSpaces(stage.post_color_spaces);
+        }
+        SimplifyColorSpaces(stage.pre_color_spaces);
+
+        const cv::Mat&           kImageData       = image.get_data();
+        const improc::ColorSpace kToColorSpace    = stage.resize.has_value() == true ? stage.post_color_spaces.back() : stage.pre_color_spaces.back();
+        const cv::Size           kToImageSize     = stage.resize.has_value() == true ? GetSize(stage.post_geometry)   : GetSize(stage.pre_geometry);
+        if ( stage.resize.has_value() == false && stage.pre_color_spaces.size() == 1
+          && stage.pre_geometry.rotation == improc::RotationType::Value::k0Deg )
+        {
+            IMPROC_CORECV_LOGGER_DEBUG("Stage only crops image. Image data is shared with the region.");
+            return improc::ColorSpaceImage(kImageData(stage.pre_geometry.region),kToColorSpace);
+        }
+
+        cv::Mat to_image_data = improc::ImageAllocator::get().CreateMat();
+        to_image_data.create(kToImageSize,CV_8UC(kToColorSpace.GetNumberChannels()));
+        const int kNumberTileRows = (kToImageSize.height + improc::DeferredImage::kTileSize - 1) / improc::DeferredImage::kTileSize;
+        cv::parallel_for_( cv::Range(0,kNumberTileRows)
+                         , [&kImageData,&stage,&to_image_data] (const cv::Range& range) -> void
+                           {
+                               static constexpr int kTileSize = improc::DeferredImage::kTileSize;
+                               const improc::RotationType kPreRotation  {stage.pre_geometry.rotation};
+                               const improc::RotationType kPostRotation {stage.post_geometry.rotation};
+                               cv::Mat resized_tile {};
+                               for (int tile_row = range.start * kTileSize; tile_row < std::min(range.end * kTileSize,to_image_data.rows); tile_row += kTileSize)
+                               {
+                                   for (int tile_col = 0; tile_col < to_image_data.cols; tile_col += kTileSize)
+                                   {
+                                       const cv::Rect kTile {tile_col,tile_row,std::min(kTileSize,to_image_data.cols - tile_col),std::min(kTileSize,to_image_data.rows - tile_row)};
+                                       cv::Mat to_tile = to_image_data(kTile);
+                                       if (stage.resize.has_value() == false)
+                                       {
+                                           cv::Mat tile = kImageData( GetUnrotatedRegion(kTile,stage.pre_geometry.region.size(),stage.pre_geometry.rotation)
+                                                                    + stage.pre_geometry.region.tl() );
+                                           ConvertTile(tile,stage.pre_color_spaces);
+                                           kPreRotation.Apply(tile,to_tile);
+                                       }
+                                       else
+                                       {
+                                           const cv::Rect kResizedRegion = GetUnrotatedRegion(kTile,stage.post_geometry.region.size(),stage.post_geometry.rotation)
+                                                                         + stage.post_geometry.region.tl();
+                                           const cv::Rect kResizeRegion  = stage.resize->GetSourceRegion(kResizedRegion);
+                                           cv::Mat tile = kImageData( GetUnrotatedRegion(kResizeRegion,stage.pre_geometry.region.size(),stage.pre_geometry.rotation)
+                                                                    + stage.pre_geometry.region.tl() );
+                                           ConvertTile(tile,stage.pre_color_spaces);
+                                           tile = kPreRotation.Apply(tile);
+                                           stage.resize->ApplyToRegion(tile,kResizedRegion,resized_tile);
+                                           ConvertTile(resized_tile,stage.post_color_spaces);
+                                           kPostRotation.Apply(resized_tile,to_tile);
+                                       }
+                                   }
+                               }
+                           } );
+        return improc::ColorSpaceImage(std::move(to_image_data),kToColorSpace);
+    }
+}
+
+/**
+ * @brief Construct a new improc::DeferredImage object
+ */
+improc::DeferredImage::DeferredImage() : image_(improc::ColorSpaceImage())
+                                       , image_size_(cv::Size())
+                                       , color_space_(improc::ColorSpace::kRGB)
+                                       , operations_(std::vector<Operation>()) {}
+
+/**
+ * @brief Construct a new improc::DeferredImage object. Image data is shared and not modified by the operations.
+ *
+ * @param image - color space image. YUV images are not supported.
+ */
+improc::DeferredImage::DeferredImage(const improc::ColorSpaceImage& image) : DeferredImage()
+{
+    IMPROC_CORECV_LOGGER_TRACE("Creating deferred {} image...",image.get_color_space().ToString());
+    if (image.get_color_space().IsYUV() == true)
+    {
+        std::string error_message = fmt::format("Deferred image not defined for {} images. Chroma planes are not aligned with luma pixels.",image.get_color_space().ToString());
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    if (image.get_data().empty() == true)
+    {
+        std::string error_message = "Deferred image not defined for empty images.";
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    this->image_       = image;
+    this->image_size_  = image.get_data().size();
+    this->color_space_ = image.get_color_space();
+}
+
+/**
+ * @brief Obtain image size after the recorded operations
+ */
+cv::Size improc::DeferredImage::get_image_size() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining deferred image size...");
+    return this->image_size_;
+}
+
+/**
+ * @brief Obtain color space after the recorded operations
+ */
+improc::ColorSpace improc::DeferredImage::get_color_space() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining deferred image color space...");
+    return this->color_space_;
+}
+
+/**
+ * @brief Obtain operations recorded since the last materialization
+ */
+const std::vector<improc::DeferredImage::Operation>& improc::DeferredImage::get_operations() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining deferred image operations...");
+    return this->operations_;
+}
+
+/**
+ * @brief Record crop of image
+ *
+ * @param region - region of the image after the recorded operations
+ */
+void improc::DeferredImage::Crop(const cv::Rect& region)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Recording crop...");
+    if (region.empty() == true || (region & cv::Rect(cv::Point(),this->image_size_)) != region)
+    {
+        std::string error_message = fmt::format ( "Invalid crop region ({},{}) {}x{} for image with size {}x{}."
+                                                , region.x, region.y, region.width, region.height
+                                                , this->image_size_.width, this->image_size_.height );
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_03: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    if (region.size() == this->image_size_)
+    {
+        IMPROC_CORECV_LOGGER_DEBUG("Crop not recorded. Region is the whole image.");
+        return;
+    }
+    improc::DeferredImage::Operation operation {};
+    operation.type   = improc::DeferredImage::OperationType::kCrop;
+    operation.region = region;
+    this->operations_.push_back(std::move(operation));
+    this->image_size_ = region.size();
+}
+
+/**
+ * @brief Record clockwise rotation of image
+ *
+ * @param rotation - rotation type
+ */
+void improc::DeferredImage::Rotate(const improc::RotationType& rotation)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Recording {} rotation...",rotation.ToString());
+    if (rotation == improc::RotationType::Value::k0Deg)
+    {
+        IMPROC_CORECV_LOGGER_DEBUG("Rotation not recorded. Image is not rotated.");
+        return;
+    }
+    improc::DeferredImage::Operation operation {};
+    operation.type     = improc::DeferredImage::OperationType::kRotation;
+    operation.rotation = rotation;
+    this->operations_.push_back(std::move(operation));
+    if (rotation == improc::RotationType::Value::k90Deg || rotation == improc::RotationType::Value::k270Deg)
+    {
+        this->image_size_ = cv::Size(this->image_size_.height,this->image_size_.width);
+    }
+}
+
+/**
+ * @brief Record resize of image to target size
+ *
+ * @param to_image_size - target image size
+ * @param interpolation - interpolation type. Cubic resizes are not fused with the other operations.
+ */
+void improc::DeferredImage::Resize(const cv::Size& to_image_size, const improc::InterpolationType& interpolation)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Recording resize using size...");
+    if (to_image_size.empty() == true)
+    {
+        std::string error_message = fmt::format("Invalid target size {}x{} for resize.",to_image_size.width,to_image_size.height);
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_04: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    if (to_image_size == this->image_size_)
+    {
+        IMPROC_CORECV_LOGGER_DEBUG("Resize not recorded. Image already has target size.");
+        return;
+    }
+    improc::DeferredImage::Operation operation {};
+    operation.type          = improc::DeferredImage::OperationType::kResize;
+    operation.image_size    = to_image_size;
+    operation.interpolation = interpolation;
+    this->operations_.push_back(std::move(operation));
+    this->image_size_ = to_image_size;
+}
+
+/**
+ * @brief Record resize of image using scaling factors. Target size is rounded as cv::resize.
+ *
+ * @param scaling - scaling factors for width and height
+ * @param interpolation - interpolation type. Cubic resizes are not fused with the other operations.
+ */
+void improc::DeferredImage::Resize(const cv::Size2d& scaling, const improc::InterpolationType& interpolation)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Recording resize using scale...");
+    this->Resize( cv::Size( cv::saturate_cast<int>(this->image_size_.width  * scaling.width)
+                          , cv::saturate_cast<int>(this->image_size_.height * scaling.height) )
+                , interpolation );
+}
+
+/**
+ * @brief Record conversion of image to color space
+ *
+ * @param to_color_space - target color space. YUV color spaces are not supported.
+ */
+void improc::DeferredImage::ConvertToColorSpace(const improc::ColorSpace& to_color_space)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Recording color conversion from {} to {}...",this->color_space_.ToString(),to_color_space.ToString());
+    if (this->color_space_ == to_color_space)
+    {
+        IMPROC_CORECV_LOGGER_DEBUG("Color conversion not recorded. Image is already in target color space.");
+        return;
+    }
+    if (to_color_space.IsYUV() == true || this->color_space_.HasColorConversionCode(to_color_space) == false)
+    {
+        std::string error_message = fmt::format ( "Color conversion from {} to {} not defined for deferred image."
+                                                , this->color_space_.ToString(), to_color_space.ToString() );
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_05: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    improc::DeferredImage::Operation operation {};
+    operation.type        = improc::DeferredImage::OperationType::kColorConversion;
+    operation.color_space = to_color_space;
+    this->operations_.push_back(std::move(operation));
+    this->color_space_ = to_color_space;
+}
+
+/**
+ * @brief Execute recorded operations. The deferred image keeps the result without recorded operations.
+ *
+ * @return improc::ColorSpaceImage - image after the operations. Images that are only cropped share the image data.
+ */
+improc::ColorSpaceImage improc::DeferredImage::Materialize()
+{
+    IMPROC_CORECV_LOGGER_TRACE("Materializing {} deferred operations...",this->operations_.size());
+    improc::ColorSpaceImage image = this->image_;
+    Stage stage = CreateStage(image);
+    for (const improc::DeferredImage::Operation& operation : this->operations_)
+    {
+        Geometry&                        geometry     = stage.resize.has_value() == true ? stage.post_geometry     : stage.pre_geometry;
+        std::vector<improc::ColorSpace>& color_spaces = stage.resize.has_value() == true ? stage.post_color_spaces : stage.pre_color_spaces;
+        switch (operation.type)
+        {
+            case improc::DeferredImage::OperationType::kCrop:
+                AddCrop(geometry,operation.region);
+                break;
+
+            case improc::DeferredImage::OperationType::kRotation:
+                AddRotation(geometry,operation.rotation);
+                break;
+
+            case improc::DeferredImage::OperationType::kColorConversion:
+                color_spaces.push_back(operation.color_space);
+                break;
+
+            case improc::DeferredImage::OperationType::kResize:
+            {
+                const bool kIsFused = improc::ResizeCoefficients::IsSupported( operation.interpolation
+                                                                             , CV_8UC(color_spaces.back().GetNumberChannels()) );
+                if (stage.resize.has_value() == true || kIsFused == false)
+                {
+                    IMPROC_CORECV_LOGGER_DEBUG("Materializing stage before {} resize...",operation.interpolation.ToString());
+                    image = RunStage(image,std::move(stage));
+                    stage = CreateStage(image);
+                }
+                if (kIsFused == false)
+                {
+                    image.Resize(operation.image_size,operation.interpolation);
+                    stage = CreateStage(image);
+                }
+                else
+                {
+                    stage.resize            = improc::ResizeCoefficients(GetSize(stage.pre_geometry),operation.image_size,operation.interpolation);
+                    stage.post_geometry     = Geometry {cv::Rect(cv::Point(),operation.image_size),improc::RotationType::Value::k0Deg};
+                    stage.post_color_spaces = {stage.pre_color_spaces.back()};
+                }
+                break;
+            }
+        }
+    }
+    image = RunStage(image,std::move(stage));
+
+    this->image_ = image;
+    this->operations_.clear();
+    return image;
+}
\ No newline at end of file
@@ -1,5 +1,54 @@
 #include <improc/corecv/image.hpp>
 
+namespace
+{
+    void CheckImageData(const cv::Mat& image_data)
+    {
+        if (image_data.depth() != CV_8U) 
+        {
+            std::string error_message = fmt::format ( "Not supported data type for image. Expected data type {} received {}."
+                                                    , CV_8U, image_data.depth() );
+            IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+            throw improc::value_error(std::move(error_message));
+        }
+    }
+
+    /**
+     * @brief Check that image data matches a YUV color space, since the chroma planes are stored below the luma plane
+     */
+    void CheckYUVImageData(const cv::Mat& image_data, const improc::ColorSpace& color_space)
+    {
+        if (static_cast<unsigned int>(image_data.channels()) != color_space.GetNumberChannels())
+        {
+            std::string error_message = fmt::format ( "Invalid image for {} color space image. Color space expects {} channels but image has {}."
+                                                    , color_space.ToString(), color_space.GetNumberChannels(), image_data.channels() );
+            IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+            throw improc::value_error(std::move(error_message));
+        }
+        if (color_space.IsValidDataSize(image_data.size()) == false)
+        {
+            std::string error_message = fmt::format ( "Invalid image size {}x{} for {} color space image. Chroma planes do not match the luma plane."
+                                                    , image_data.cols, image_data.rows, color_space.ToString() );
+            IMPROC_CORECV_LOGGER_ERROR("ERROR_02: " + error_message);
+            throw improc::value_error(std::move(error_message));
+        }
+    }
+
+    /**
+     * @brief Check that a color space image can be resized as a single image
+     */
+    void CheckResizable(const improc::ColorSpace& color_space)
+    {
+        if (color_space.IsYUV() == true)
+        {
+            std::string error_message = fmt::format ( "Cannot resize {} color space image. Chroma planes would be resized as part of the luma plane."
+                                                    , color_space.ToString() );
+            IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+            throw improc::value_error(std::move(error_message));
+        }
+    }
+}
+
 improc::Image::Image() : data_(cv::Mat()) {}
 
 improc::Image::Image(const cv::Mat& image_data) : Image()
@@ -8,20 +57,40 @@ improc::Image::Image(const cv::Mat& image_data) : Image()
     this->set_data(image_data);
 }
 
+/**
+ * @brief Construct a new improc::Image object taking ownership of the image data
+ * 
+ * @param image_data - 8-bit image data
+ */
+improc::Image::Image(cv::Mat&& image_data) : Image()
+{
+    IMPROC_CORECV_LOGGER_TRACE("Creating image object from moved data...");    
+    this->set_data(std::move(image_data));
+}
+
 void improc::Image::set_data(const cv::Mat& image_data)
 {
     IMPROC_CORECV_LOGGER_TRACE("Setting image data...");
-    if (image_data.depth() != CV_8U) 
-    {
-        std::string error_message = fmt::format ( "Not supported data type for image. Expected data type {} received {}."
-                                                , CV_8U, image_data.depth() );
-        IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
-        throw improc::value_error(std::move(error_message));
-    }
+    CheckImageData(image_data);
     this->data_ = image_data;
 }
 
-cv::Mat improc::Image::get_data() const
+/**
+ * @brief Set image data taking ownership of it, without changing its reference count
+ * 
+ * @param image_data - 8-bit image data
+ */
+void improc::Image::set_data(cv::Mat&& image_data)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Setting moved image data...");
+    CheckImageData(image_data);
+    this->data_ = std::move(image_data);
+}
+
+/**
+ * @brief Obtain image data. Image data is returned by reference to avoid changing its reference count.
+ */
+const cv::Mat& improc::Image::get_data() const
 {
     IMPROC_CORECV_LOGGER_TRACE("Obtaining image data...");    
     return this->data_;
@@ -30,47 +99,89 @@ cv::Mat improc::Image::get_data() const
 improc::Image improc::Image::Clone() const
 {
     IMPROC_CORECV_LOGGER_TRACE("Cloning image object...");    
-    return improc::Image(this->get_data().clone());
+    cv::Mat image_data = improc::ImageAllocator::get().CreateMat();
+    this->data_.copyTo(image_data);
+    return improc::Image(image_data);
 }
 
 
-// void improc::Image::Resize(const cv::Size& to_image_size, const InterpolationType& interpolation);
-// {
-//     SPDLOG_LOGGER_CALL( improc::ImageProcLogger::get()->data()
-//                       , spdlog::level::trace
-//                       , "Resizing image using size..." );
-//     if (this->data_.size() == image_size)
-//     {
-//         SPDLOG_LOGGER_CALL( improc::ImageProcLogger::get()->data()
-//                           , spdlog::level::debug
-//                           , "Resizing not performed. Image already has target size." );
-//     }
-//     else
-//     {
-//         cv::resize(this->data_,this->data_,to_image_size,0,0,interpolation.ToOpenCV());
-//     }
-// }
-
-// void improc::Image::Resize(const cv::Size2d& scaling, const InterpolationType& interpolation);
-// {
-//     SPDLOG_LOGGER_CALL( improc::ImageProcLogger::get()->data()
-//                       , spdlog::level::trace
-//                       , "Resizing image using scale..." );
-//     if (scaling.width == 1.0 && scaling.height == 1.0)
-//     {
-//         SPDLOG_LOGGER_CALL( improc::ImageProcLogger::get()->data()
-//                           , spdlog::level::debug
-//                           , "Resizing not performed. Image already has target size." );
-//     }
-//     else
-//     {
-//         cv::resize(this->data_,this->data_,cv::Size(),scaling.width,scaling.height,interpolation.ToOpenCV());
-//     }
-// }
+/**
+ * @brief Resize image to target size
+ * 
+ * @param to_image_size - target image size
+ * @param interpolation - interpolation type
+ */
+void improc::Image::Resize(const cv::Size& to_image_size, const improc::InterpolationType& interpolation)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Resizing image using size...");
+    if (this->data_.size() == to_image_size)
+    {
+        IMPROC_CORECV_LOGGER_DEBUG("Resizing not performed. Image already has target size.");
+    }
+    else
+    {
+        cv::Mat resized_data = improc::ImageAllocator::get().CreateMat();
+        cv::resize(this->data_,resized_data,to_image_size,0,0,interpolation.ToOpenCV());
+        this->data_ = std::move(resized_data);
+    }
+}
+
+/**
+ * @brief Resize image using scaling factors
+ * 
+ * @param scaling - scaling factors for width and height
+ * @param interpolation - interpolation type
+ */
+void improc::Image::Resize(const cv::Size2d& scaling, const improc::InterpolationType& interpolation)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Resizing image using scale...");
+    if (scaling.width == 1.0 && scaling.height == 1.0)
+    {
+        IMPROC_CORECV_LOGGER_DEBUG("Resizing not performed. Image already has target size.");
+    }
+    else
+    {
+        cv::Mat resized_data = improc::ImageAllocator::get().CreateMat();
+        cv::resize(this->data_,resized_data,cv::Size(),scaling.width,scaling.height,interpolation.ToOpenCV());
+        this->data_ = std::move(resized_data);
+    }
+}
 
 improc::ColorSpaceImage::ColorSpaceImage() : improc::Image()
                                            , color_space_(improc::ColorSpace::kRGB) {}
 
+/**
+ * @brief Set image data. For YUV color spaces, image data should have the number of channels of the color
+ * space and chroma planes that match the luma plane.
+ * 
+ * @param image_data - 8-bit image data
+ */
+void improc::ColorSpaceImage::set_data(const cv::Mat& image_data)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Setting color space image data...");
+    if (this->color_space_.IsYUV() == true)
+    {
+        CheckYUVImageData(image_data,this->color_space_);
+    }
+    this->Image::set_data(image_data);
+}
+
+/**
+ * @brief Set image data taking ownership of it. For YUV color spaces, image data should have the number
+ * of channels of the color space and chroma planes that match the luma plane.
+ * 
+ * @param image_data - 8-bit image data
+ */
+void improc::ColorSpaceImage::set_data(cv::Mat&& image_data)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Setting moved color space image data...");
+    if (this->color_space_.IsYUV() == true)
+    {
+        CheckYUVImageData(image_data,this->color_space_);
+    }
+    this->Image::set_data(std::move(image_data));
+}
+
 improc::ColorSpace improc::ColorSpaceImage::get_color_space() const
 {
     IMPROC_CORECV_LOGGER_TRACE("Obtaining color space...");    
@@ -82,3 +193,30 @@ improc::ColorSpaceImage improc::ColorSpaceImage::Clone() const
     IMPROC_CORECV_LOGGER_TRACE("Cloning color space image object...");    
     return improc::ColorSpaceImage(this->Image::Clone().get_data(),this->color_space_);
 }
+
+
+/**
+ * @brief Resize image to target size. YUV color space images are not supported.
+ * 
+ * @param to_image_size - target image size
+ * @param interpolation - interpolation type
+ */
+void improc::ColorSpaceImage::Resize(const cv::Size& to_image_size, const improc::InterpolationType& interpolation)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Resizing color space image using size...");
+    CheckResizable(this->color_space_);
+    this->Image::Resize(to_image_size,interpolation);
+}
+
+/**
+ * @brief Resize image using scaling factors. YUV color space images are not supported.
+ * 
+ * @param scaling - scaling factors for width and height
+ * @param interpolation - interpolation type
+ */
+void improc::ColorSpaceImage::Resize(const cv::Size2d& scaling, const improc::InterpolationType& interpolation)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Resizing color space image using scale...");
+    CheckResizable(this->color_space_);
+    this->Image::Resize(scaling,interpolation);
+}
\ No newline at end of file
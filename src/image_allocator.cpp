@@ -0,0 +1,214 @@
+#include <improc/corecv/image_allocator.hpp>
+
+/**
+ * @brief Construct a new improc::ImageAllocator object
+ */
+improc::ImageAllocator::ImageAllocator() : cv::MatAllocator()
+                                         , buffers_(std::unordered_map<size_t,std::vector<Buffer>>())
+                                         , cached_bytes_(0)
+                                         , hits_(0)
+                                         , misses_(0)
+                                         , enabled_(false)
+                                         , max_cached_bytes_(kDefaultMaxCachedBytes) {}
+
+/**
+ * @brief Obtain image allocator instance
+ */
+improc::ImageAllocator& improc::ImageAllocator::get()
+{
+    // Allocator is never destroyed, since images released during static destruction still return their buffers to it.
+    static improc::ImageAllocator* instance = new improc::ImageAllocator();
+    return *instance;
+}
+
+/**
+ * @brief Start allocating image buffers from the pool
+ *
+ * @param max_cached_bytes - maximum number of bytes kept in the pool for reuse
+ */
+void improc::ImageAllocator::Enable(size_t max_cached_bytes)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Enabling image allocator with {} cached bytes...", max_cached_bytes);
+    this->max_cached_bytes_ = max_cached_bytes;
+    this->enabled_ = true;
+}
+
+/**
+ * @brief Stop allocating image buffers from the pool and release cached buffers
+ */
+void improc::ImageAllocator::Disable()
+{
+    IMPROC_CORECV_LOGGER_TRACE("Disabling image allocator...");
+    this->enabled_ = false;
+    this->Clear();
+}
+
+/**
+ * @brief Check if image buffers are allocated from the pool
+ */
+bool improc::ImageAllocator::IsEnabled() const
+{
+    return this->enabled_;
+}
+
+/**
+ * @brief Create empty image data that allocates its buffer from the pool when the allocator is enabled
+ */
+cv::Mat improc::ImageAllocator::CreateMat() const
+{
+    cv::Mat image_data {};
+    if (this->enabled_ == true)
+    {
+        image_data.allocator = const_cast<improc::ImageAllocator*>(this);
+    }
+    return image_data;
+}
+
+/**
+ * @brief Create image data that allocates its buffer from the pool when the allocator is enabled
+ *
+ * @param size - image size
+ * @param type - image OpenCV type
+ */
+cv::Mat improc::ImageAllocator::CreateMat(const cv::Size& size, int type) const
+{
+    cv::Mat image_data = this->CreateMat();
+    image_data.create(size,type);
+    return image_data;
+}
+
+/**
+ * @brief Obtain pool usage counters
+ */
+improc::ImageAllocator::Statistics improc::ImageAllocator::GetStatistics() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining image allocator statistics...");
+    improc::ImageAllocator::Statistics statistics {};
+    statistics.hits   = this->hits_;
+    statistics.misses = this->misses_;
+
+    std::lock_guard<std::mutex> lock {this->mutex_};
+    for (const auto& [size, buffers] : this->buffers_)
+    {
+        statistics.cached_buffers += buffers.size();
+    }
+    statistics.cached_bytes = this->cached_bytes_;
+    return statistics;
+}
+
+/**
+ * @brief Reset hit and miss counters
+ */
+void improc::ImageAllocator::ResetStatistics()
+{
+    IMPROC_CORECV_LOGGER_TRACE("Resetting image allocator statistics...");
+    this->hits_   = 0;
+    this->misses_ = 0;
+}
+
+/**
+ * @brief Release buffers cached in the pool
+ */
+void improc::ImageAllocator::Clear()
+{
+    IMPROC_CORECV_LOGGER_TRACE("Clearing image allocator...");
+    std::lock_guard<std::mutex> lock {this->mutex_};
+    for (auto& [size, buffers] : this->buffers_)
+    {
+        for (const improc::ImageAllocator::Buffer& buffer : buffers)
+        {
+            cv::fastFree(buffer.origdata);
+        }
+    }
+    this->buffers_.clear();
+    this->cached_bytes_ = 0;
+}
+
+/**
+ * @brief Allocate image buffer. Only two-dimensional buffers owned by the allocator are pooled.
+ */
+cv::UMatData* improc::ImageAllocator::allocate( int dims, const int* sizes, int type, void* data, size_t* step
+                                              , cv::AccessFlag flags, cv::UMatUsageFlags usage_flags ) const
+{
+    if (dims != 2 || data != nullptr || step == nullptr)
+    {
+        return cv::Mat::getStdAllocator()->allocate(dims,sizes,type,data,step,flags,usage_flags);
+    }
+
+    const size_t kElemSize = CV_ELEM_SIZE(type);
+    const size_t kRowStep  = cv::alignSize(kElemSize * sizes[1],static_cast<int>(kRowAlignment));
+    const size_t kSize     = kRowStep * sizes[0];
+    step[0] = kRowStep;
+    step[1] = kElemSize;
+
+    improc::ImageAllocator::Buffer buffer {nullptr,nullptr};
+    {
+        std::lock_guard<std::mutex> lock {this->mutex_};
+        auto buffers_iter = this->buffers_.find(kSize);
+        if (buffers_iter != this->buffers_.end() && buffers_iter->second.empty() == false)
+        {
+            buffer = buffers_iter->second.back();
+            buffers_iter->second.pop_back();
+            this->cached_bytes_ -= kSize;
+        }
+    }
+
+    if (buffer.origdata == nullptr)
+    {
+        ++this->misses_;
+        buffer.origdata = static_cast<uchar*>(cv::fastMalloc(kSize + kRowAlignment));
+        buffer.data     = cv::alignPtr(buffer.origdata,static_cast<int>(kRowAlignment));
+    }
+    else
+    {
+        ++this->hits_;
+    }
+
+    cv::UMatData* mat_data = new cv::UMatData(this);
+    mat_data->origdata = buffer.origdata;
+    mat_data->data     = buffer.data;
+    mat_data->size     = kSize;
+    return mat_data;
+}
+
+/**
+ * @brief Allocate image buffer for existing data. Image buffers always live in host memory.
+ */
+bool improc::ImageAllocator::allocate(cv::UMatData* data, cv::AccessFlag, cv::UMatUsageFlags) const
+{
+    return data != nullptr;
+}
+
+/**
+ * @brief Return image buffer to the pool
+ */
+void improc::ImageAllocator::deallocate(cv::UMatData* data) const
+{
+    if (data == nullptr)
+    {
+        return;
+    }
+
+    CV_Assert(data->urefcount == 0);
+    CV_Assert(data->refcount  == 0);
+    if (!(data->flags & cv::UMatData::USER_ALLOCATED))
+    {
+        bool is_cached = false;
+        if (this->enabled_ == true)
+        {
+            std::lock_guard<std::mutex> lock {this->mutex_};
+            if (this->cached_bytes_ + data->size <= this->max_cached_bytes_)
+            {
+                this->buffers_[data->size].push_back({data->origdata,data->data});
+                this->cached_bytes_ += data->size;
+                is_cached = true;
+            }
+        }
+        if (is_cached == false)
+        {
+            cv::fastFree(data->origdata);
+        }
+        data->origdata = nullptr;
+    }
+    delete data;
+}
@@ -0,0 +1,233 @@
+#include <improc/corecv/image_debug_singleton.hpp>
+#include <improc/corecv/raw_image.hpp>
+
+#include <opencv2/imgcodecs.hpp>
+
+#include <fstream>
+
+/**
+ * @brief Construct a new improc::ImageDebugSingleton object
+ */
+improc::ImageDebugSingleton::ImageDebugSingleton() : queue_(std::deque<improc::ImageDebugSingleton::DebugImage>())
+                                                   , capacity_(kDefaultCapacity)
+                                                   , overflow_policy_(improc::ImageDebugSingleton::OverflowPolicy::kDropOldest)
+                                                   , enabled_(false)
+                                                   , is_running_(false)
+                                                   , is_writing_(false)
+                                                   , statistics_({0,0,0,0}) {}
+
+/**
+ * @brief Destroy the improc::ImageDebugSingleton object. Queued images are written before the background thread stops.
+ */
+improc::ImageDebugSingleton::~ImageDebugSingleton()
+{
+    {
+        std::lock_guard<std::mutex> lock {this->mutex_};
+        this->is_running_ = false;
+    }
+    this->queue_condition_.notify_all();
+    if (this->worker_.joinable() == true)
+    {
+        this->worker_.join();
+    }
+}
+
+/**
+ * @brief Obtain image debug instance
+ */
+improc::ImageDebugSingleton& improc::ImageDebugSingleton::get()
+{
+    static improc::ImageDebugSingleton instance {};
+    return instance;
+}
+
+/**
+ * @brief Start capturing images. Background thread is started on the first call.
+ *
+ * @param capacity - maximum number of images waiting to be written
+ * @param overflow_policy - images dropped when the queue is full
+ */
+void improc::ImageDebugSingleton::Enable(size_t capacity, improc::ImageDebugSingleton::OverflowPolicy overflow_policy)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Enabling image debug with capacity {}...",capacity);
+    if (capacity == 0)
+    {
+        std::string error_message = "Invalid image debug capacity. Capacity should be positive.";
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    std::lock_guard<std::mutex> lock {this->mutex_};
+    this->capacity_        = capacity;
+    this->overflow_policy_ = overflow_policy;
+    while (this->queue_.size() > this->capacity_)
+    {
+        this->queue_.pop_front();
+        ++this->statistics_.dropped;
+    }
+    if (this->is_running_ == false)
+    {
+        this->is_running_ = true;
+        this->worker_     = std::thread([this] () -> void {this->Write();});
+    }
+    this->enabled_ = true;
+}
+
+/**
+ * @brief Stop capturing images. Queued images are still written.
+ */
+void improc::ImageDebugSingleton::Disable()
+{
+    IMPROC_CORECV_LOGGER_TRACE("Disabling image debug...");
+    this->enabled_ = false;
+}
+
+/**
+ * @brief Check if images are captured
+ */
+bool improc::ImageDebugSingleton::IsEnabled() const
+{
+    return this->enabled_;
+}
+
+/**
+ * @brief Queue image to be encoded and written by the background thread
+ *
+ * @param image - image to be written. Image data is shared, not copied.
+ * @param filepath - destination filepath
+ * @param image_format - encoding format
+ * @return bool - true if the image was queued
+ */
+bool improc::ImageDebugSingleton::Capture(const improc::Image& image, const std::string& filepath, const improc::ImageFormat& image_format)
+{
+    if (this->enabled_ == false)
+    {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock {this->mutex_};
+        ++this->statistics_.captured;
+        if (this->queue_.size() >= this->capacity_)
+        {
+            ++this->statistics_.dropped;
+            if (this->overflow_policy_ == improc::ImageDebugSingleton::OverflowPolicy::kDropNewest)
+            {
+                return false;
+            }
+            this->queue_.pop_front();
+        }
+        this->queue_.push_back({image,filepath,image_format});
+    }
+    this->queue_condition_.notify_one();
+    return true;
+}
+
+/**
+ * @brief Wait until queued images are written
+ */
+void improc::ImageDebugSingleton::Flush()
+{
+    IMPROC_CORECV_LOGGER_TRACE("Flushing image debug...");
+    std::unique_lock<std::mutex> lock {this->mutex_};
+    this->idle_condition_.wait(lock,[this] () -> bool
+                                    {
+                                        return this->is_running_ == false || (this->queue_.empty() == true && this->is_writing_ == false);
+                                    });
+}
+
+/**
+ * @brief Obtain debug image counters
+ */
+improc::ImageDebugSingleton::Statistics improc::ImageDebugSingleton::GetStatistics() const
+{
+    std::lock_guard<std::mutex> lock {this->mutex_};
+    return this->statistics_;
+}
+
+/**
+ * @brief Reset debug image counters
+ */
+void improc::ImageDebugSingleton::ResetStatistics()
+{
+    std::lock_guard<std::mutex> lock {this->mutex_};
+    this->statistics_ = {0,0,0,0};
+}
+
+/**
+ * @brief Encode and write queued images until the singleton is destroyed
+ */
+void improc::ImageDebugSingleton::Write()
+{
+    std::unique_lock<std::mutex> lock {this->mutex_};
+    while (true)
+    {
+        this->queue_condition_.wait(lock,[this] () -> bool {return this->is_running_ == false || this->queue_.empty() == false;});
+        if (this->queue_.empty() == true)
+        {
+            break;
+        }
+
+        improc::ImageDebugSingleton::DebugImage debug_image = std::move(this->queue_.front());
+        this->queue_.pop_front();
+        this->is_writing_ = true;
+        lock.unlock();
+
+        std::vector<uchar> encoded_image {};
+        bool is_written = false;
+        try
+        {
+            if (debug_image.image_format == improc::ImageFormat::Value::kRaw)
+            {
+                improc::RawImage::Write(debug_image.filepath,debug_image.image.get_data());
+                is_written = true;
+            }
+            else
+            {
+                is_written = cv::imencode(std::string(debug_image.image_format.ToOpenCV()),debug_image.image.get_data(),encoded_image);
+                if (is_written == true)
+                {
+                    std::ofstream debug_file {debug_image.filepath,std::ios::binary};
+                    debug_file.write(reinterpret_cast<const char*>(encoded_image.data()),static_cast<std::streamsize>(encoded_image.size()));
+                    is_written = debug_file.good();
+                }
+            }
+        }
+        catch (const cv::Exception&)
+        {
+            is_written = false;
+        }
+        catch (const improc::file_processing_error&)
+        {
+            is_written = false;
+        }
+        catch (const improc::value_error&)
+        {
+            is_written = false;
+        }
+        catch (...)
+        {
+            // Any other error is also counted as failed, since an exception escaping the writer thread terminates the process
+            is_written = false;
+        }
+        if (is_written == false)
+        {
+            IMPROC_CORECV_LOGGER_ERROR("ERROR_02: Cannot write debug image {} as {}.",debug_image.filepath,debug_image.image_format.ToString());
+        }
+        // Image data is released before the queue is reported as idle
+        debug_image = improc::ImageDebugSingleton::DebugImage {};
+
+        lock.lock();
+        this->is_writing_ = false;
+        if (is_written == true)
+        {
+            ++this->statistics_.written;
+        }
+        else
+        {
+            ++this->statistics_.failed;
+        }
+        this->idle_condition_.notify_all();
+    }
+    this->idle_condition_.notify_all();
+}
\ No newline at end of file
@@ -0,0 +1,228 @@
+#include <improc/corecv/parsers/image_header.hpp>
+#include <improc/corecv/raw_image.hpp>
+
+#include <climits>
+#include <cstring>
+
+namespace
+{
+    static constexpr uchar kPNGSignature[]      = {0x89,'P','N','G','\r','\n',0x1A,'\n'};
+    static constexpr uchar kJP2Signature[]      = {0x00,0x00,0x00,0x0C,'j','P',' ',' ',0x0D,0x0A,0x87,0x0A};
+    static constexpr uchar kJ2KSignature[]      = {0xFF,0x4F,0xFF,0x51};
+
+    uint32_t ReadBigEndian16(const uchar* data)
+    {
+        return (static_cast<uint32_t>(data[0]) << 8) | data[1];
+    }
+
+    uint32_t ReadBigEndian32(const uchar* data)
+    {
+        return (ReadBigEndian16(data) << 16) | ReadBigEndian16(data + 2);
+    }
+
+    std::optional<cv::Size> CreateSize(uint64_t width, uint64_t height)
+    {
+        if (width == 0 || height == 0 || width > INT_MAX || height > INT_MAX)
+        {
+            return std::nullopt;
+        }
+        return cv::Size(static_cast<int>(width),static_cast<int>(height));
+    }
+
+    /**
+     * @brief Read size from the first frame header segment. Segments are skipped until a start of frame marker is found.
+     */
+    std::optional<cv::Size> ReadJPEGSize(const uchar* encoded_data, size_t encoded_size)
+    {
+        size_t position = 2;
+        while (position + 1 < encoded_size)
+        {
+            if (encoded_data[position] != 0xFF)
+            {
+                return std::nullopt;
+            }
+            const uchar kMarker = encoded_data[position + 1];
+            position += 2;
+            // Fill bytes and segments without length
+            if (kMarker == 0xFF)
+            {
+                --position;
+                continue;
+            }
+            if (kMarker == 0x01 || (kMarker >= 0xD0 && kMarker <= 0xD7))
+            {
+                continue;
+            }
+            if (kMarker == 0xD9 || kMarker == 0xDA || position + 2 > encoded_size)
+            {
+                return std::nullopt;
+            }
+
+            const size_t kSegmentSize = ReadBigEndian16(encoded_data + position);
+            const bool   kIsFrame     = kMarker >= 0xC0 && kMarker <= 0xCF && kMarker != 0xC4 && kMarker != 0xC8 && kMarker != 0xCC;
+            if (kIsFrame == true)
+            {
+                if (kSegmentSize < 7 || position + 7 > encoded_size)
+                {
+                    return std::nullopt;
+                }
+                return CreateSize(ReadBigEndian16(encoded_data + position + 5),ReadBigEndian16(encoded_data + position + 3));
+            }
+            position += kSegmentSize;
+        }
+        return std::nullopt;
+    }
+
+    std::optional<cv::Size> ReadPNGSize(const uchar* encoded_data, size_t encoded_size)
+    {
+        static constexpr size_t kIHDREnd = 24;
+        if (encoded_size < kIHDREnd || std::memcmp(encoded_data + 12,"IHDR",4) != 0)
+        {
+            return std::nullopt;
+        }
+        return CreateSize(ReadBigEndian32(encoded_data + 16),ReadBigEndian32(encoded_data + 20));
+    }
+
+    /**
+     * @brief Read size from the SIZ marker segment of a JPEG2000 codestream
+     */
+    std::optional<cv::Size> ReadJ2KSize(const uchar* encoded_data, size_t encoded_size)
+    {
+        static constexpr size_t kSIZEnd = 24;
+        if (encoded_size < kSIZEnd)
+        {
+            return std::nullopt;
+        }
+        const uint32_t kWidth         = ReadBigEndian32(encoded_data + 8);
+        const uint32_t kHeight        = ReadBigEndian32(encoded_data + 12);
+        const uint32_t kOffsetWidth   = ReadBigEndian32(encoded_data + 16);
+        const uint32_t kOffsetHeight  = ReadBigEndian32(encoded_data + 20);
+        if (kOffsetWidth >= kWidth || kOffsetHeight >= kHeight)
+        {
+            return std::nullopt;
+        }
+        return CreateSize(kWidth - kOffsetWidth,kHeight - kOffsetHeight);
+    }
+
+    /**
+     * @brief Read size from the image header box inside the header super box of a JPEG2000 file
+     */
+    std::optional<cv::Size> ReadJP2Size(const uchar* encoded_data, size_t encoded_size)
+    {
+        static constexpr size_t kBoxHeaderSize = 8;
+        size_t position = 0;
+        size_t box_end  = encoded_size;
+        while (position + kBoxHeaderSize <= box_end)
+        {
+            size_t box_size = ReadBigEndian32(encoded_data + position);
+            if (box_size == 0)
+            {
+                box_size = box_end - position;
+            }
+            if (box_size < kBoxHeaderSize || position + box_size > box_end)
+            {
+                return std::nullopt;
+            }
+
+            const uchar* kBoxType = encoded_data + position + 4;
+            if (std::memcmp(kBoxType,"jp2h",4) == 0)
+            {
+                box_end   = position + box_size;
+                position += kBoxHeaderSize;
+                continue;
+            }
+            if (std::memcmp(kBoxType,"ihdr",4) == 0)
+            {
+                if (box_size < kBoxHeaderSize + 8)
+                {
+                    return std::nullopt;
+                }
+                return CreateSize( ReadBigEndian32(encoded_data + position + kBoxHeaderSize + 4)
+                                 , ReadBigEndian32(encoded_data + position + kBoxHeaderSize) );
+            }
+            if (std::memcmp(kBoxType,"jp2c",4) == 0)
+            {
+                return ReadJ2KSize(encoded_data + position + kBoxHeaderSize,box_size - kBoxHeaderSize);
+            }
+            position += box_size;
+        }
+        return std::nullopt;
+    }
+
+    std::optional<cv::Size> ReadRawSize(const uchar* encoded_data, size_t encoded_size)
+    {
+        try
+        {
+            return improc::RawImage::ReadHeader(encoded_data,encoded_size).image_size;
+        }
+        catch (const improc::value_error&)
+        {
+            return std::nullopt;
+        }
+    }
+}
+
+/**
+ * @brief Read image format and size of encoded image
+ *
+ * @param encoded_data - encoded image bytes
+ * @param encoded_size - number of encoded image bytes
+ * @return std::optional<improc::ImageHeader> - empty if the format is not supported or the header is invalid
+ */
+std::optional<improc::ImageHeader> improc::ImageHeader::Read(const uchar* encoded_data, size_t encoded_size)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Reading encoded image header...");
+    if (encoded_data == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    std::optional<cv::Size> image_size {};
+    improc::ImageFormat     image_format {};
+    if (encoded_size >= 3 && encoded_data[0] == 0xFF && encoded_data[1] == 0xD8 && encoded_data[2] == 0xFF)
+    {
+        image_format = improc::ImageFormat(improc::ImageFormat::Value::kJPEG);
+        image_size   = ReadJPEGSize(encoded_data,encoded_size);
+    }
+    else if (encoded_size >= sizeof(kPNGSignature) && std::memcmp(encoded_data,kPNGSignature,sizeof(kPNGSignature)) == 0)
+    {
+        image_format = improc::ImageFormat(improc::ImageFormat::Value::kPNG);
+        image_size   = ReadPNGSize(encoded_data,encoded_size);
+    }
+    else if (encoded_size >= sizeof(kJP2Signature) && std::memcmp(encoded_data,kJP2Signature,sizeof(kJP2Signature)) == 0)
+    {
+        image_format = improc::ImageFormat(improc::ImageFormat::Value::kJPEG2000);
+        image_size   = ReadJP2Size(encoded_data,encoded_size);
+    }
+    else if (encoded_size >= sizeof(kJ2KSignature) && std::memcmp(encoded_data,kJ2KSignature,sizeof(kJ2KSignature)) == 0)
+    {
+        image_format = improc::ImageFormat(improc::ImageFormat::Value::kJPEG2000);
+        image_size   = ReadJ2KSize(encoded_data,encoded_size);
+    }
+    else if (improc::RawImage::IsRawImage(encoded_data,encoded_size) == true)
+    {
+        image_format = improc::ImageFormat(improc::ImageFormat::Value::kRaw);
+        image_size   = ReadRawSize(encoded_data,encoded_size);
+    }
+
+    if (image_size.has_value() == false)
+    {
+        return std::nullopt;
+    }
+    return improc::ImageHeader {image_format,image_size.value()};
+}
+
+/**
+ * @brief Read image format and size of encoded image
+ *
+ * @param encoded_data - continuous 8-bit buffer with encoded image bytes
+ * @return std::optional<improc::ImageHeader> - empty if the format is not supported or the header is invalid
+ */
+std::optional<improc::ImageHeader> improc::ImageHeader::Read(const cv::Mat& encoded_data)
+{
+    if (encoded_data.empty() == true || encoded_data.isContinuous() == false || encoded_data.depth() != CV_8U)
+    {
+        return std::nullopt;
+    }
+    return improc::ImageHeader::Read(encoded_data.ptr<uchar>(),encoded_data.total() * encoded_data.elemSize());
+}
\ No newline at end of file
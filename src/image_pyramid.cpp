@@ -0,0 +1,236 @@
+#include <improc/corecv/structures/image_pyramid.hpp>
+#include <improc/corecv/image_allocator.hpp>
+
+#include <opencv2/imgproc.hpp>
+
+namespace
+{
+    /**
+     * @brief Check if level index is a pyramid level
+     */
+    void CheckLevel(size_t level_idx, size_t number_levels)
+    {
+        if (level_idx >= number_levels)
+        {
+            std::string error_message = fmt::format("Invalid pyramid level {}. Pyramid has {} levels.",level_idx,number_levels);
+            IMPROC_CORECV_LOGGER_ERROR("ERROR_04: " + error_message);
+            throw improc::value_error(std::move(error_message));
+        }
+    }
+}
+
+/**
+ * @brief Construct a new improc::ImagePyramid object
+ */
+improc::ImagePyramid::ImagePyramid() : downsampling_(improc::ImagePyramid::Downsampling::kGaussian)
+                                     , color_space_(std::optional<improc::ColorSpace>())
+                                     , levels_(std::vector<std::unique_ptr<Level>>()) {}
+
+/**
+ * @brief Construct a new improc::ImagePyramid object. Image data is shared with level 0.
+ *
+ * @param image - image at level 0
+ * @param number_levels - number of levels including level 0
+ * @param downsampling - downsampling from each level to the next one
+ */
+improc::ImagePyramid::ImagePyramid( const improc::Image& image, size_t number_levels
+                                  , improc::ImagePyramid::Downsampling downsampling ) : ImagePyramid()
+{
+    IMPROC_CORECV_LOGGER_TRACE("Creating image pyramid with {} levels...",number_levels);
+    this->downsampling_ = downsampling;
+    this->Initialize(image.get_data(),number_levels);
+}
+
+/**
+ * @brief Construct a new improc::ImagePyramid object. Image data is shared with level 0 and all levels
+ * keep the image color space.
+ *
+ * @param image - color space image at level 0. YUV images are not supported.
+ * @param number_levels - number of levels including level 0
+ * @param downsampling - downsampling from each level to the next one
+ */
+improc::ImagePyramid::ImagePyramid( const improc::ColorSpaceImage& image, size_t number_levels
+                                  , improc::ImagePyramid::Downsampling downsampling ) : ImagePyramid()
+{
+    IMPROC_CORECV_LOGGER_TRACE("Creating {} image pyramid with {} levels...",image.get_color_space().ToString(),number_levels);
+    if (image.get_color_space().IsYUV() == true)
+    {
+        std::string error_message = fmt::format("Image pyramid not defined for {} images. Chroma planes cannot be downsampled with luma.",image.get_color_space().ToString());
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    this->downsampling_ = downsampling;
+    this->color_space_  = image.get_color_space();
+    this->Initialize(image.get_data(),number_levels);
+}
+
+/**
+ * @brief Allocate levels and set level 0
+ */
+void improc::ImagePyramid::Initialize(const cv::Mat& image_data, size_t number_levels)
+{
+    if (image_data.empty() == true)
+    {
+        std::string error_message = "Image pyramid not defined for empty images.";
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    const size_t kMaxNumberLevels = improc::ImagePyramid::GetMaxNumberLevels(image_data.size());
+    if (number_levels == 0 || number_levels > kMaxNumberLevels)
+    {
+        std::string error_message = fmt::format ( "Invalid number of levels {} for image pyramid. Image of size {}x{} has between 1 and {} levels."
+                                                , number_levels, image_data.cols, image_data.rows, kMaxNumberLevels );
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_03: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    this->levels_.clear();
+    for (size_t level_idx = 0; level_idx < number_levels; ++level_idx)
+    {
+        this->levels_.push_back(std::make_unique<Level>());
+    }
+    this->levels_[0]->data = image_data;
+    this->levels_[0]->is_cached = true;
+}
+
+/**
+ * @brief Compute level from the previous level, computing the previous level first if it is not cached
+ */
+void improc::ImagePyramid::ComputeLevel(size_t level_idx) const
+{
+    std::call_once( this->levels_[level_idx]->computed_flag
+                  , [this,level_idx] () -> void
+                    {
+                        const cv::Mat& kFinerLevelData = this->GetLevelData(level_idx - 1);
+                        IMPROC_CORECV_LOGGER_DEBUG("Computing image pyramid level {}...",level_idx);
+                        cv::Mat level_data = improc::ImageAllocator::get().CreateMat();
+                        if (this->downsampling_ == improc::ImagePyramid::Downsampling::kGaussian)
+                        {
+                            cv::pyrDown(kFinerLevelData,level_data);
+                        }
+                        else
+                        {
+                            cv::resize(kFinerLevelData,level_data,this->GetLevelSize(level_idx),0,0,cv::INTER_AREA);
+                        }
+                        this->levels_[level_idx]->data = std::move(level_data);
+                        this->levels_[level_idx]->is_cached = true;
+                    } );
+}
+
+/**
+ * @brief Obtain number of levels until the image is reduced to a single pixel
+ *
+ * @param image_size - image size at level 0
+ */
+size_t improc::ImagePyramid::GetMaxNumberLevels(const cv::Size& image_size)
+{
+    if (image_size.empty() == true)
+    {
+        return 0;
+    }
+    size_t number_levels = 1;
+    cv::Size level_size = image_size;
+    while (level_size.width > 1 || level_size.height > 1)
+    {
+        level_size = cv::Size((level_size.width + 1) / 2,(level_size.height + 1) / 2);
+        ++number_levels;
+    }
+    return number_levels;
+}
+
+/**
+ * @brief Obtain number of levels including level 0
+ */
+size_t improc::ImagePyramid::get_number_levels() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining number of pyramid levels...");
+    return this->levels_.size();
+}
+
+/**
+ * @brief Obtain downsampling from each level to the next one
+ */
+improc::ImagePyramid::Downsampling improc::ImagePyramid::get_downsampling() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining pyramid downsampling...");
+    return this->downsampling_;
+}
+
+/**
+ * @brief Obtain color space of the levels. Empty if the pyramid was created from an image without color space.
+ */
+std::optional<improc::ColorSpace> improc::ImagePyramid::get_color_space() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining pyramid color space...");
+    return this->color_space_;
+}
+
+/**
+ * @brief Obtain size of level without computing it
+ *
+ * @param level_idx - pyramid level
+ */
+cv::Size improc::ImagePyramid::GetLevelSize(size_t level_idx) const
+{
+    CheckLevel(level_idx,this->levels_.size());
+    cv::Size level_size = this->levels_[0]->data.size();
+    for (size_t idx = 0; idx < level_idx; ++idx)
+    {
+        level_size = cv::Size((level_size.width + 1) / 2,(level_size.height + 1) / 2);
+    }
+    return level_size;
+}
+
+/**
+ * @brief Check if level was already computed
+ *
+ * @param level_idx - pyramid level
+ */
+bool improc::ImagePyramid::IsLevelCached(size_t level_idx) const
+{
+    CheckLevel(level_idx,this->levels_.size());
+    return this->levels_[level_idx]->is_cached;
+}
+
+/**
+ * @brief Obtain image data of level, computing it if it is not cached. Image data is shared with the
+ * pyramid and should not be modified.
+ *
+ * @param level_idx - pyramid level
+ */
+const cv::Mat& improc::ImagePyramid::GetLevelData(size_t level_idx) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining image pyramid level {}...",level_idx);
+    CheckLevel(level_idx,this->levels_.size());
+    if (this->levels_[level_idx]->is_cached == false)
+    {
+        this->ComputeLevel(level_idx);
+    }
+    return this->levels_[level_idx]->data;
+}
+
+/**
+ * @brief Obtain image of level sharing the image data with the pyramid
+ *
+ * @param level_idx - pyramid level
+ */
+improc::Image improc::ImagePyramid::GetLevel(size_t level_idx) const
+{
+    return improc::Image(this->GetLevelData(level_idx));
+}
+
+/**
+ * @brief Obtain color space image of level sharing the image data with the pyramid
+ *
+ * @param level_idx - pyramid level
+ */
+improc::ColorSpaceImage improc::ImagePyramid::GetColorSpaceLevel(size_t level_idx) const
+{
+    if (this->color_space_.has_value() == false)
+    {
+        std::string error_message = "Image pyramid was created from an image without color space.";
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_05: " + error_message);
+        throw improc::processing_flow_error(std::move(error_message));
+    }
+    return improc::ColorSpaceImage(this->GetLevelData(level_idx),this->color_space_.value());
+}
\ No newline at end of file
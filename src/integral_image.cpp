@@ -0,0 +1,227 @@
+#include <improc/corecv/structures/integral_image.hpp>
+#include <improc/corecv/image_allocator.hpp>
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * @brief Construct a new improc::IntegralImage object
+ */
+improc::IntegralImage::IntegralImage() : sum_(cv::Mat())
+                                       , square_sum_(cv::Mat()) {}
+
+/**
+ * @brief Construct a new improc::IntegralImage object
+ *
+ * @param image - single channel 8-bit image data
+ * @param with_square_sum - compute also the sums of the squared pixels
+ */
+improc::IntegralImage::IntegralImage(const cv::Mat& image, bool with_square_sum) : improc::IntegralImage()
+{
+    this->Compute(image,with_square_sum);
+}
+
+/**
+ * @brief Check if integral image can be computed for images with type
+ *
+ * @param image_type - image OpenCV type
+ */
+bool improc::IntegralImage::IsSupported(int image_type)
+{
+    return image_type == CV_8UC1;
+}
+
+/**
+ * @brief Compute summed-area table of image
+ *
+ * Image is split in one stripe of rows per thread and is read once: each stripe accumulates the sums of
+ * its own rows in parallel. The sums of the previous stripes are then added to the rows of each stripe.
+ *
+ * @param image - single channel 8-bit image data
+ * @param with_square_sum - compute also the sums of the squared pixels
+ */
+void improc::IntegralImage::Compute(const cv::Mat& image, bool with_square_sum)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Computing integral image...");
+    if (image.empty() == true || improc::IntegralImage::IsSupported(image.type()) == false)
+    {
+        std::string error_message = fmt::format("Invalid image for integral image. Expected single channel 8-bit image received type {}.",image.type());
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    // Tables are always allocated, since copies of the integral image share them
+    const cv::Size kTableSize {image.cols + 1,image.rows + 1};
+    this->sum_        = improc::ImageAllocator::get().CreateMat(kTableSize,CV_32SC1);
+    this->square_sum_ = with_square_sum == true ? improc::ImageAllocator::get().CreateMat(kTableSize,CV_32SC1) : cv::Mat();
+    std::fill_n(this->sum_.ptr<uint32_t>(0),kTableSize.width,0);
+    if (with_square_sum == true)
+    {
+        std::fill_n(this->square_sum_.ptr<uint32_t>(0),kTableSize.width,0);
+    }
+
+    const int kNumberStripes = std::max(1,std::min(image.rows,cv::getNumThreads()));
+    std::vector<int> stripe_rows (kNumberStripes + 1);
+    for (int stripe = 0; stripe <= kNumberStripes; ++stripe)
+    {
+        stripe_rows[stripe] = static_cast<int>(static_cast<int64_t>(image.rows) * stripe / kNumberStripes);
+    }
+
+    // Stripes start from zero sums and table row 0 of each stripe is the stripe first image row
+    cv::parallel_for_( cv::Range(0,kNumberStripes)
+                     , [this,&image,&stripe_rows,with_square_sum] (const cv::Range& range) -> void
+                       {
+                           for (int stripe = range.start; stripe < range.end; ++stripe)
+                           {
+                               for (int row = stripe_rows[stripe]; row < stripe_rows[stripe + 1]; ++row)
+                               {
+                                   const uchar*    image_row      = image.ptr<uchar>(row);
+                                   uint32_t*       sum_row        = this->sum_.ptr<uint32_t>(row + 1);
+                                   const uint32_t* kPrevSumRow    = row == stripe_rows[stripe] ? nullptr : this->sum_.ptr<uint32_t>(row);
+                                   uint32_t        row_sum        = 0;
+                                   sum_row[0] = 0;
+                                   for (int col = 0; col < image.cols; ++col)
+                                   {
+                                       row_sum += image_row[col];
+                                       sum_row[col + 1] = kPrevSumRow == nullptr ? row_sum : kPrevSumRow[col + 1] + row_sum;
+                                   }
+
+                                   if (with_square_sum == true)
+                                   {
+                                       uint32_t*       square_sum_row     = this->square_sum_.ptr<uint32_t>(row + 1);
+                                       const uint32_t* kPrevSquareSumRow  = row == stripe_rows[stripe] ? nullptr : this->square_sum_.ptr<uint32_t>(row);
+                                       uint32_t        row_square_sum     = 0;
+                                       square_sum_row[0] = 0;
+                                       for (int col = 0; col < image.cols; ++col)
+                                       {
+                                           row_square_sum += static_cast<uint32_t>(image_row[col]) * image_row[col];
+                                           square_sum_row[col + 1] = kPrevSquareSumRow == nullptr ? row_square_sum : kPrevSquareSumRow[col + 1] + row_square_sum;
+                                       }
+                                   }
+                               }
+                           }
+                       }
+                     , kNumberStripes );
+
+    if (kNumberStripes == 1)
+    {
+        return;
+    }
+
+    // Sums of previous stripes are the last table row of each previous stripe, accumulated in order
+    std::vector<cv::Mat> tables {this->sum_};
+    if (with_square_sum == true)
+    {
+        tables.push_back(this->square_sum_);
+    }
+    for (cv::Mat& table : tables)
+    {
+        std::vector<std::vector<uint32_t>> stripe_offsets (kNumberStripes,std::vector<uint32_t>(kTableSize.width,0));
+        for (int stripe = 1; stripe < kNumberStripes; ++stripe)
+        {
+            const uint32_t* kLastRow = table.ptr<uint32_t>(stripe_rows[stripe]);
+            for (int col = 0; col < kTableSize.width; ++col)
+            {
+                stripe_offsets[stripe][col] = stripe_offsets[stripe - 1][col] + kLastRow[col];
+            }
+        }
+        cv::parallel_for_( cv::Range(stripe_rows[1],image.rows)
+                         , [&table,&stripe_rows,&stripe_offsets,kNumberStripes] (const cv::Range& range) -> void
+                           {
+                               int stripe = static_cast<int>(std::upper_bound(stripe_rows.begin(),stripe_rows.end(),range.start) - stripe_rows.begin()) - 1;
+                               for (int row = range.start; row < range.end; ++row)
+                               {
+                                   while (stripe + 1 < kNumberStripes && row >= stripe_rows[stripe + 1])
+                                   {
+                                       ++stripe;
+                                   }
+                                   uint32_t*       table_row = table.ptr<uint32_t>(row + 1);
+                                   const uint32_t* kOffsets  = stripe_offsets[stripe].data();
+                                   for (int col = 0; col < table.cols; ++col)
+                                   {
+                                       table_row[col] += kOffsets[col];
+                                   }
+                               }
+                           } );
+    }
+}
+
+/**
+ * @brief Obtain size of the image summed by the table
+ */
+cv::Size improc::IntegralImage::GetImageSize() const
+{
+    return this->sum_.empty() == true ? cv::Size() : cv::Size(this->sum_.cols - 1,this->sum_.rows - 1);
+}
+
+/**
+ * @brief Check if sums of the squared pixels were computed
+ */
+bool improc::IntegralImage::HasSquareSum() const
+{
+    return this->square_sum_.empty() == false;
+}
+
+/**
+ * @brief Obtain summed-area table of pixels. Entries are 32-bit unsigned integers stored as CV_32SC1.
+ */
+const cv::Mat& improc::IntegralImage::get_sum() const
+{
+    return this->sum_;
+}
+
+/**
+ * @brief Obtain summed-area table of squared pixels. Entries are 32-bit unsigned integers stored as CV_32SC1.
+ */
+const cv::Mat& improc::IntegralImage::get_square_sum() const
+{
+    return this->square_sum_;
+}
+
+/**
+ * @brief Compute mean of the window centered at each pixel. Windows are clipped to the image,
+ * so border pixels are the mean of the window pixels inside the image.
+ *
+ * @param window_size - window size. Window should have at most kMaxSumArea pixels.
+ * @param mean_image - destination for single channel 8-bit mean image. Buffer is reused when it already has the image size and type.
+ */
+void improc::IntegralImage::BoxFilter(const cv::Size& window_size, cv::Mat& mean_image) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Filtering integral image with {}x{} box...",window_size.width,window_size.height);
+    if (this->sum_.empty() == true)
+    {
+        std::string error_message = "Integral image should be computed before box filtering.";
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::processing_flow_error(std::move(error_message));
+    }
+    if (window_size.width <= 0 || window_size.height <= 0)
+    {
+        std::string error_message = fmt::format("Invalid window size {}x{}. Window size should be positive.",window_size.width,window_size.height);
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_03: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    if (static_cast<uint64_t>(window_size.width) * static_cast<uint64_t>(window_size.height) > static_cast<uint64_t>(improc::IntegralImage::kMaxSumArea))
+    {
+        std::string error_message = fmt::format ( "Invalid window size {}x{}. Window should have at most {} pixels."
+                                                , window_size.width,window_size.height,improc::IntegralImage::kMaxSumArea );
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_04: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    const cv::Size kImageSize = this->GetImageSize();
+    mean_image.create(kImageSize,CV_8UC1);
+    cv::parallel_for_( cv::Range(0,kImageSize.height)
+                     , [this,&window_size,&kImageSize,&mean_image] (const cv::Range& range) -> void
+                       {
+                           for (int row = range.start; row < range.end; ++row)
+                           {
+                               uchar* mean_row = mean_image.ptr<uchar>(row);
+                               for (int col = 0; col < kImageSize.width; ++col)
+                               {
+                                   const cv::Rect kWindow = this->GetCenteredWindow(row,col,window_size);
+                                   const uint64_t kArea   = static_cast<uint64_t>(kWindow.area());
+                                   mean_row[col] = static_cast<uchar>((this->GetSum(kWindow) + kArea / 2) / kArea);
+                               }
+                           }
+                       } );
+}
\ No newline at end of file
@@ -10,12 +10,8 @@ improc::InterpolationType::InterpolationType() : value_(improc::InterpolationTyp
  * 
  * @param interpolation_type_str - interpolation type description as string
  */
-improc::InterpolationType::InterpolationType(const std::string& interpolation_type_str)
+improc::InterpolationType::InterpolationType(std::string_view interpolation_type_str)
 {
     IMPROC_CORECV_LOGGER_TRACE("Creating interpolation type from string {}...", interpolation_type_str);
-    static const std::unordered_map<std::string,InterpolationType::Value> kToElemType = { {"linear" ,InterpolationType::Value::kLinear }
-                                                                                        , {"cubic"  ,InterpolationType::Value::kCubic  }
-                                                                                        , {"nearest",InterpolationType::Value::kNearest}
-                                                                                        };
-    this->value_ = kToElemType.at(improc::String::ToLower(std::move(interpolation_type_str)));
+    this->value_ = improc::InterpolationType::kEnumTable.Parse(interpolation_type_str);
 }
@@ -0,0 +1,272 @@
+#include <improc/corecv/kernels/channel_swizzle.hpp>
+#include <improc/corecv/image_allocator.hpp>
+
+#include "channel_swizzle_kernels.hpp"
+
+#include <string_view>
+
+namespace
+{
+    /**
+     * @brief Obtain channel order of color space. Gray is represented by luminance channel L.
+     * Color spaces that are not byte permutations of each other return an empty channel order.
+     */
+    std::string_view GetChannelOrder(const improc::ColorSpace& color_space)
+    {
+        switch (color_space)
+        {
+            case improc::ColorSpace::Value::kRGB : return "RGB";    break;
+            case improc::ColorSpace::Value::kBGR : return "BGR";    break;
+            case improc::ColorSpace::Value::kRGBA: return "RGBA";   break;
+            case improc::ColorSpace::Value::kBGRA: return "BGRA";   break;
+            case improc::ColorSpace::Value::kGray: return "L";      break;
+            default:                               return "";
+        }
+    }
+
+    /**
+     * @brief Obtain source channel for each target channel
+     *
+     * @return bool - true if every target channel is a copy of a source channel or the alpha channel
+     */
+    bool GetChannelMap( const improc::ColorSpace& from_color_space, const improc::ColorSpace& to_color_space
+                      , std::array<int,4>& channel_map )
+    {
+        const std::string_view kFromChannels = GetChannelOrder(from_color_space);
+        const std::string_view kToChannels   = GetChannelOrder(to_color_space);
+        if (kFromChannels.empty() == true || kToChannels.empty() == true || from_color_space == to_color_space)
+        {
+            return false;
+        }
+
+        channel_map.fill(improc::ChannelSwizzle::kAlphaChannel);
+        for (size_t to_channel = 0; to_channel < kToChannels.size(); ++to_channel)
+        {
+            const char kChannel = kToChannels[to_channel];
+            if (kFromChannels == "L" && kChannel != 'A')
+            {
+                channel_map[to_channel] = 0;
+            }
+            else if (kFromChannels.find(kChannel) != std::string_view::npos)
+            {
+                channel_map[to_channel] = static_cast<int>(kFromChannels.find(kChannel));
+            }
+            else if (kChannel != 'A')
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Swizzle the pixels of a row one by one
+     */
+    void SwizzleScalar( const uchar* src, uchar* dst, size_t number_pixels
+                      , size_t in_channels, size_t out_channels, const std::array<int,4>& channel_map )
+    {
+        for (size_t pixel = 0; pixel < number_pixels; ++pixel)
+        {
+            const uchar* src_pixel = src + pixel * in_channels;
+            uchar*       dst_pixel = dst + pixel * out_channels;
+            for (size_t channel = 0; channel < out_channels; ++channel)
+            {
+                dst_pixel[channel] = channel_map[channel] == improc::ChannelSwizzle::kAlphaChannel ? 255 : src_pixel[channel_map[channel]];
+            }
+        }
+    }
+}
+
+std::atomic<bool> improc::ChannelSwizzle::enabled_ {true};
+
+/**
+ * @brief Construct a new improc::ChannelSwizzle object
+ *
+ * @param from_color_space - source color space
+ * @param to_color_space - target color space
+ */
+improc::ChannelSwizzle::ChannelSwizzle( const improc::ColorSpace& from_color_space
+                                      , const improc::ColorSpace& to_color_space ) : from_color_space_(from_color_space)
+                                                                                   , to_color_space_(to_color_space)
+                                                                                   , channel_map_(std::array<int,4>())
+{
+    IMPROC_CORECV_LOGGER_TRACE("Creating channel swizzle from {} to {}...", from_color_space.ToString(), to_color_space.ToString());
+    if (GetChannelMap(from_color_space,to_color_space,this->channel_map_) == false)
+    {
+        std::string error_message = fmt::format ( "Color conversion from {} to {} is not a channel swizzle."
+                                                , from_color_space.ToString(), to_color_space.ToString() );
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+}
+
+/**
+ * @brief Check if color conversion only reorders, adds or drops channels
+ *
+ * @param from_color_space - source color space
+ * @param to_color_space - target color space
+ */
+bool improc::ChannelSwizzle::IsSwizzle(const improc::ColorSpace& from_color_space, const improc::ColorSpace& to_color_space)
+{
+    std::array<int,4> channel_map {};
+    return GetChannelMap(from_color_space,to_color_space,channel_map);
+}
+
+/**
+ * @brief Use channel swizzle kernels for color conversions
+ */
+void improc::ChannelSwizzle::Enable()
+{
+    IMPROC_CORECV_LOGGER_TRACE("Enabling channel swizzle...");
+    improc::ChannelSwizzle::enabled_ = true;
+}
+
+/**
+ * @brief Use OpenCV for all color conversions
+ */
+void improc::ChannelSwizzle::Disable()
+{
+    IMPROC_CORECV_LOGGER_TRACE("Disabling channel swizzle...");
+    improc::ChannelSwizzle::enabled_ = false;
+}
+
+/**
+ * @brief Check if channel swizzle kernels are used for color conversions
+ */
+bool improc::ChannelSwizzle::IsEnabled()
+{
+    return improc::ChannelSwizzle::enabled_;
+}
+
+/**
+ * @brief Obtain widest instruction set supported by the CPU
+ */
+improc::ChannelSwizzle::InstructionSet improc::ChannelSwizzle::GetInstructionSet()
+{
+    static const improc::ChannelSwizzle::InstructionSet kInstructionSet = []
+    {
+        for (improc::ChannelSwizzle::InstructionSet instruction_set : { improc::ChannelSwizzle::InstructionSet::kAVX512BW
+                                                                      , improc::ChannelSwizzle::InstructionSet::kAVX2
+                                                                      , improc::ChannelSwizzle::InstructionSet::kSSE41 })
+        {
+            if (improc::ChannelSwizzle::IsInstructionSetSupported(instruction_set) == true)
+            {
+                return instruction_set;
+            }
+        }
+        return improc::ChannelSwizzle::InstructionSet::kScalar;
+    }();
+    return kInstructionSet;
+}
+
+/**
+ * @brief Check if instruction set is supported by the library build and the CPU
+ *
+ * @param instruction_set - instruction set
+ */
+bool improc::ChannelSwizzle::IsInstructionSetSupported(improc::ChannelSwizzle::InstructionSet instruction_set)
+{
+    switch (instruction_set)
+    {
+        case improc::ChannelSwizzle::InstructionSet::kScalar  : return true;    break;
+        #ifdef IMPROC_CORECV_WITH_X86_KERNELS
+        case improc::ChannelSwizzle::InstructionSet::kSSE41   : return cv::checkHardwareSupport(CV_CPU_SSE4_1);     break;
+        case improc::ChannelSwizzle::InstructionSet::kAVX2    : return cv::checkHardwareSupport(CV_CPU_AVX2);       break;
+        case improc::ChannelSwizzle::InstructionSet::kAVX512BW: return cv::checkHardwareSupport(CV_CPU_AVX_512F) 
+                                                                    && cv::checkHardwareSupport(CV_CPU_AVX_512BW);  break;
+        #endif
+        default:                                                return false;
+    }
+}
+
+/**
+ * @brief Apply channel swizzle to image using the widest instruction set supported by the CPU
+ *
+ * @param image - image data in source color space
+ * @param swizzled_image - image data in target color space
+ */
+void improc::ChannelSwizzle::Apply(const cv::Mat& image, cv::Mat& swizzled_image) const
+{
+    this->Apply(image,swizzled_image,improc::ChannelSwizzle::GetInstructionSet());
+}
+
+/**
+ * @brief Apply channel swizzle to image
+ *
+ * @param image - image data in source color space
+ * @param swizzled_image - image data in target color space
+ * @param instruction_set - instruction set used by the kernel
+ */
+void improc::ChannelSwizzle::Apply( const cv::Mat& image, cv::Mat& swizzled_image
+                                  , improc::ChannelSwizzle::InstructionSet instruction_set ) const
+{
+    IMPROC_CORECV_LOGGER_TRACE  ( "Applying channel swizzle from {} to {}..."
+                                , this->from_color_space_.ToString(), this->to_color_space_.ToString() );
+    if (image.depth() != CV_8U || image.channels() != static_cast<int>(this->from_color_space_.GetNumberChannels()))
+    {
+        std::string error_message = fmt::format ( "Invalid image for channel swizzle. Expected {} channels with data type {} received {} channels with data type {}."
+                                                , this->from_color_space_.GetNumberChannels(), CV_8U, image.channels(), image.depth() );
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    if (improc::ChannelSwizzle::IsInstructionSetSupported(instruction_set) == false)
+    {
+        std::string error_message = fmt::format ( "Instruction set {} not supported for channel swizzle."
+                                                , static_cast<unsigned int>(instruction_set) );
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_03: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    const size_t kInChannels  = this->from_color_space_.GetNumberChannels();
+    const size_t kOutChannels = this->to_color_space_.GetNumberChannels();
+    improc::kernels::SwizzleMasks masks {};
+    masks.in_channels     = kInChannels;
+    masks.out_channels    = kOutChannels;
+    masks.pixels_per_lane = 16 / std::max(kInChannels,kOutChannels);
+    for (size_t lane_byte = 0; lane_byte < 16; ++lane_byte)
+    {
+        const size_t kPixel   = lane_byte / kOutChannels;
+        const size_t kChannel = lane_byte % kOutChannels;
+        masks.shuffle[lane_byte] = 0x80;
+        masks.alpha  [lane_byte] = 0x00;
+        if (kPixel < masks.pixels_per_lane)
+        {
+            if (this->channel_map_[kChannel] == improc::ChannelSwizzle::kAlphaChannel)
+            {
+                masks.alpha[lane_byte] = 0xFF;
+            }
+            else
+            {
+                masks.shuffle[lane_byte] = static_cast<std::uint8_t>(kPixel * kInChannels + this->channel_map_[kChannel]);
+            }
+        }
+    }
+
+    // Kernels cannot swizzle in-place, since a row can be read after being partially written
+    cv::Mat swizzled_image_buffer = swizzled_image.data != nullptr && swizzled_image.data == image.data ? improc::ImageAllocator::get().CreateMat() 
+                                                                                                                   : swizzled_image;
+    swizzled_image_buffer.create(image.size(),CV_8UC(static_cast<int>(kOutChannels)));
+    cv::parallel_for_( cv::Range(0,image.rows)
+                     , [this,&image,&swizzled_image_buffer,&masks,instruction_set] (const cv::Range& range) -> void
+                       {
+                           for (int row = range.start; row < range.end; ++row)
+                           {
+                               const uchar* src = image.ptr<uchar>(row);
+                               uchar*       dst = swizzled_image_buffer.ptr<uchar>(row);
+                               const size_t kNumberPixels = static_cast<size_t>(image.cols);
+                               size_t processed_pixels = 0;
+                               switch (instruction_set)
+                               {
+                                   #ifdef IMPROC_CORECV_WITH_X86_KERNELS
+                                   case improc::ChannelSwizzle::InstructionSet::kSSE41   : processed_pixels = improc::kernels::SwizzleSSE41   (src,dst,kNumberPixels,masks);  break;
+                                   case improc::ChannelSwizzle::InstructionSet::kAVX2    : processed_pixels = improc::kernels::SwizzleAVX2    (src,dst,kNumberPixels,masks);  break;
+                                   case improc::ChannelSwizzle::InstructionSet::kAVX512BW: processed_pixels = improc::kernels::SwizzleAVX512BW(src,dst,kNumberPixels,masks);  break;
+                                   #endif
+                                   default:                                                break;
+                               }
+                               SwizzleScalar( src + processed_pixels * masks.in_channels, dst + processed_pixels * masks.out_channels
+                                            , kNumberPixels - processed_pixels, masks.in_channels, masks.out_channels, this->channel_map_ );
+                           }
+                       } );
+    swizzled_image = std::move(swizzled_image_buffer);
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+#include "channel_swizzle_kernels.hpp"
+
+#include <immintrin.h>
+
+std::size_t improc::kernels::SwizzleAVX2( const std::uint8_t* src, std::uint8_t* dst, std::size_t number_pixels
+                                        , const improc::kernels::SwizzleMasks& masks )
+{
+    const __m256i kShuffle = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(masks.shuffle)));
+    const __m256i kAlpha   = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(masks.alpha)));
+    const std::size_t kInLaneBytes  = masks.pixels_per_lane * masks.in_channels;
+    const std::size_t kOutLaneBytes = masks.pixels_per_lane * masks.out_channels;
+    const std::size_t kInRowBytes   = number_pixels * masks.in_channels;
+    const std::size_t kOutRowBytes  = number_pixels * masks.out_channels;
+
+    std::size_t pixel = 0;
+    if (kInLaneBytes == 16 && kOutLaneBytes == 16)
+    {
+        // Lanes are contiguous in source and destination
+        for (; (pixel + masks.pixels_per_lane) * masks.in_channels + 16 <= kInRowBytes; pixel += 2 * masks.pixels_per_lane)
+        {
+            __m256i lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + pixel * masks.in_channels));
+            lanes = _mm256_or_si256(_mm256_shuffle_epi8(lanes,kShuffle),kAlpha);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + pixel * masks.out_channels),lanes);
+        }
+        return pixel;
+    }
+
+    // Lanes are loaded and stored with 16 bytes. Bytes written after the lane pixels are overwritten by the next lane.
+    for (; (pixel + masks.pixels_per_lane) * masks.in_channels  + 16 <= kInRowBytes 
+        && (pixel + masks.pixels_per_lane) * masks.out_channels + 16 <= kOutRowBytes; pixel += 2 * masks.pixels_per_lane)
+    {
+        const std::uint8_t* src_pixel = src + pixel * masks.in_channels;
+        std::uint8_t*       dst_pixel = dst + pixel * masks.out_channels;
+        __m256i lanes = _mm256_inserti128_si256( _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src_pixel)))
+                                               , _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_pixel + kInLaneBytes)), 1 );
+        lanes = _mm256_or_si256(_mm256_shuffle_epi8(lanes,kShuffle),kAlpha);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_pixel)                ,_mm256_castsi256_si128(lanes));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_pixel + kOutLaneBytes),_mm256_extracti128_si256(lanes,1));
+    }
+    return pixel;
+}
\ No newline at end of file
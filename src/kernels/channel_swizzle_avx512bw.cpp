@@ -0,0 +1,45 @@
+#include "channel_swizzle_kernels.hpp"
+
+#include <immintrin.h>
+
+std::size_t improc::kernels::SwizzleAVX512BW( const std::uint8_t* src, std::uint8_t* dst, std::size_t number_pixels
+                                            , const improc::kernels::SwizzleMasks& masks )
+{
+    const __m512i kShuffle = _mm512_broadcast_i32x4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(masks.shuffle)));
+    const __m512i kAlpha   = _mm512_broadcast_i32x4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(masks.alpha)));
+    const std::size_t kInLaneBytes  = masks.pixels_per_lane * masks.in_channels;
+    const std::size_t kOutLaneBytes = masks.pixels_per_lane * masks.out_channels;
+    const std::size_t kInRowBytes   = number_pixels * masks.in_channels;
+    const std::size_t kOutRowBytes  = number_pixels * masks.out_channels;
+
+    std::size_t pixel = 0;
+    if (kInLaneBytes == 16 && kOutLaneBytes == 16)
+    {
+        // Lanes are contiguous in source and destination
+        for (; (pixel + 3 * masks.pixels_per_lane) * masks.in_channels + 16 <= kInRowBytes; pixel += 4 * masks.pixels_per_lane)
+        {
+            __m512i lanes = _mm512_loadu_si512(src + pixel * masks.in_channels);
+            lanes = _mm512_or_si512(_mm512_shuffle_epi8(lanes,kShuffle),kAlpha);
+            _mm512_storeu_si512(dst + pixel * masks.out_channels,lanes);
+        }
+        return pixel;
+    }
+
+    // Lanes are loaded and stored with 16 bytes. Bytes written after the lane pixels are overwritten by the next lane.
+    for (; (pixel + 3 * masks.pixels_per_lane) * masks.in_channels  + 16 <= kInRowBytes 
+        && (pixel + 3 * masks.pixels_per_lane) * masks.out_channels + 16 <= kOutRowBytes; pixel += 4 * masks.pixels_per_lane)
+    {
+        const std::uint8_t* src_pixel = src + pixel * masks.in_channels;
+        std::uint8_t*       dst_pixel = dst + pixel * masks.out_channels;
+        __m512i lanes = _mm512_castsi128_si512(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src_pixel)));
+        lanes = _mm512_inserti32x4(lanes,_mm_loadu_si128(reinterpret_cast<const __m128i*>(src_pixel + 1 * kInLaneBytes)),1);
+        lanes = _mm512_inserti32x4(lanes,_mm_loadu_si128(reinterpret_cast<const __m128i*>(src_pixel + 2 * kInLaneBytes)),2);
+        lanes = _mm512_inserti32x4(lanes,_mm_loadu_si128(reinterpret_cast<const __m128i*>(src_pixel + 3 * kInLaneBytes)),3);
+        lanes = _mm512_or_si512(_mm512_shuffle_epi8(lanes,kShuffle),kAlpha);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_pixel)                    ,_mm512_castsi512_si128(lanes));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_pixel + 1 * kOutLaneBytes),_mm512_extracti32x4_epi32(lanes,1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_pixel + 2 * kOutLaneBytes),_mm512_extracti32x4_epi32(lanes,2));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_pixel + 3 * kOutLaneBytes),_mm512_extracti32x4_epi32(lanes,3));
+    }
+    return pixel;
+}
\ No newline at end of file
@@ -0,0 +1,37 @@
+#ifndef IMPROC_CORECV_CHANNEL_SWIZZLE_KERNELS_HPP
+#define IMPROC_CORECV_CHANNEL_SWIZZLE_KERNELS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+// Kernels are compiled with instruction set specific flags. This header must not include
+// OpenCV or logging headers, so that inline functions are not emitted with those flags.
+namespace improc::kernels
+{
+    /**
+     * @brief Byte shuffle applied to each 16 byte lane of a row
+     */
+    struct SwizzleMasks
+    {
+        std::uint8_t                    shuffle[16];    // Source byte for each destination byte. 0x80 writes zero.
+        std::uint8_t                    alpha[16];      // Bytes OR-ed after the shuffle to fill the alpha channel.
+        std::size_t                     in_channels;
+        std::size_t                     out_channels;
+        std::size_t                     pixels_per_lane;
+    };
+
+    /**
+     * @brief Swizzle the leading pixels of a row
+     *
+     * Each function processes pixels while full lanes can be loaded and stored inside the row
+     * and returns the number of pixels processed. Remaining pixels are left to the caller.
+     */
+    std::size_t                         SwizzleSSE41    ( const std::uint8_t* src, std::uint8_t* dst, std::size_t number_pixels
+                                                        , const SwizzleMasks& masks );
+    std::size_t                         SwizzleAVX2     ( const std::uint8_t* src, std::uint8_t* dst, std::size_t number_pixels
+                                                        , const SwizzleMasks& masks );
+    std::size_t                         SwizzleAVX512BW ( const std::uint8_t* src, std::uint8_t* dst, std::size_t number_pixels
+                                                        , const SwizzleMasks& masks );
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,22 @@
+#include "channel_swizzle_kernels.hpp"
+
+#include <immintrin.h>
+
+std::size_t improc::kernels::SwizzleSSE41( const std::uint8_t* src, std::uint8_t* dst, std::size_t number_pixels
+                                         , const improc::kernels::SwizzleMasks& masks )
+{
+    const __m128i kShuffle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(masks.shuffle));
+    const __m128i kAlpha   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(masks.alpha));
+    const std::size_t kInRowBytes  = number_pixels * masks.in_channels;
+    const std::size_t kOutRowBytes = number_pixels * masks.out_channels;
+
+    // Lanes are loaded and stored with 16 bytes. Bytes written after the lane pixels are overwritten by the next lane.
+    std::size_t pixel = 0;
+    for (; pixel * masks.in_channels + 16 <= kInRowBytes && pixel * masks.out_channels + 16 <= kOutRowBytes; pixel += masks.pixels_per_lane)
+    {
+        __m128i lane = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pixel * masks.in_channels));
+        lane = _mm_or_si128(_mm_shuffle_epi8(lane,kShuffle),kAlpha);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + pixel * masks.out_channels),lane);
+    }
+    return pixel;
+}
\ No newline at end of file
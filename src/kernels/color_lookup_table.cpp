@@ -0,0 +1,313 @@
+#include <improc/corecv/kernels/color_lookup_table.hpp>
+
+#include <opencv2/imgproc.hpp>
+
+#include <array>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+
+namespace
+{
+    constexpr int kWeightBits    = 7;
+    constexpr int kWeightOne     = 1 << kWeightBits;
+    constexpr int kRoundingShift = 3 * kWeightBits;
+    constexpr int kHueRange      = 180;
+
+    /**
+     * @brief Grid cell and fixed-point weight of the upper node for each 8-bit value.
+     * Grid nodes are multiples of the grid step and the last node is 255.
+     */
+    struct GridCoordinates
+    {
+        std::array<int,256>     index;
+        std::array<int,256>     weight;
+    };
+
+    int GetNodeValue(int node_idx)
+    {
+        return std::min(node_idx * improc::ColorLookupTable::kGridStep,255);
+    }
+
+    const GridCoordinates& GetGridCoordinates()
+    {
+        static const GridCoordinates kGridCoordinates = []
+        {
+            GridCoordinates grid_coordinates {};
+            for (int value = 0; value < 256; ++value)
+            {
+                const int kIndex    = std::min(value / improc::ColorLookupTable::kGridStep,improc::ColorLookupTable::kGridNodes - 2);
+                const int kLowNode  = GetNodeValue(kIndex);
+                const int kCellSize = GetNodeValue(kIndex + 1) - kLowNode;
+                grid_coordinates.index[value]  = kIndex;
+                grid_coordinates.weight[value] = ((value - kLowNode) * kWeightOne + kCellSize / 2) / kCellSize;
+            }
+            return grid_coordinates;
+        }();
+        return kGridCoordinates;
+    }
+}
+
+std::atomic<improc::ColorLookupTable::Mode> improc::ColorLookupTable::default_mode_ {improc::ColorLookupTable::Mode::kDisabled};
+
+/**
+ * @brief Construct a new improc::ColorLookupTable object
+ *
+ * @param from_color_space - source color space
+ * @param to_color_space - target color space
+ * @param mode - trilinear or full lookup table
+ */
+improc::ColorLookupTable::ColorLookupTable( const improc::ColorSpace& from_color_space, const improc::ColorSpace& to_color_space
+                                          , improc::ColorLookupTable::Mode mode ) : from_color_space_(from_color_space)
+                                                                                  , to_color_space_(to_color_space)
+                                                                                  , mode_(mode)
+                                                                                  , table_(cv::Mat())
+{
+    IMPROC_CORECV_LOGGER_TRACE("Building {} to {} color lookup table...",from_color_space.ToString(),to_color_space.ToString());
+    if (improc::ColorLookupTable::IsSupported(from_color_space,to_color_space) == false)
+    {
+        std::string error_message = fmt::format ( "Color lookup table not defined from {} to {}."
+                                                , from_color_space.ToString(), to_color_space.ToString() );
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    cv::Mat colors {};
+    if (mode == improc::ColorLookupTable::Mode::kTrilinear)
+    {
+        // Node (i0,i1,i2) is stored at row i0 * kGridNodes + i1 and column i2
+        colors.create(improc::ColorLookupTable::kGridNodes * improc::ColorLookupTable::kGridNodes,improc::ColorLookupTable::kGridNodes,CV_8UC3);
+        for (int row = 0; row < colors.rows; ++row)
+        {
+            cv::Vec3b* colors_row = colors.ptr<cv::Vec3b>(row);
+            for (int col = 0; col < colors.cols; ++col)
+            {
+                colors_row[col] = cv::Vec3b( static_cast<uchar>(GetNodeValue(row / improc::ColorLookupTable::kGridNodes))
+                                           , static_cast<uchar>(GetNodeValue(row % improc::ColorLookupTable::kGridNodes))
+                                           , static_cast<uchar>(GetNodeValue(col)) );
+            }
+        }
+    }
+    else if (mode == improc::ColorLookupTable::Mode::kFull)
+    {
+        // Color (c0,c1,c2) is stored at position c0 << 16 | c1 << 8 | c2
+        colors.create(4096,4096,CV_8UC3);
+        cv::parallel_for_( cv::Range(0,colors.rows)
+                         , [&colors] (const cv::Range& range) -> void
+                           {
+                               for (int row = range.start; row < range.end; ++row)
+                               {
+                                   cv::Vec3b* colors_row = colors.ptr<cv::Vec3b>(row);
+                                   for (int col = 0; col < colors.cols; ++col)
+                                   {
+                                       const int kColor = (row << 12) | col;
+                                       colors_row[col] = cv::Vec3b( static_cast<uchar>(kColor >> 16)
+                                                                  , static_cast<uchar>((kColor >> 8) & 0xFF)
+                                                                  , static_cast<uchar>(kColor & 0xFF) );
+                                   }
+                               }
+                           } );
+    }
+    else
+    {
+        std::string error_message = fmt::format("Invalid color lookup table mode {}.",static_cast<unsigned int>(mode));
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    cv::cvtColor(colors,this->table_,from_color_space.GetColorConversionCode(to_color_space));
+}
+
+/**
+ * @brief Check if a lookup table can be built for the color conversion. Conversions from RGB or BGR
+ * to HSV or Lab are supported. Conversions from HSV and Lab clip colors outside the RGB gamut, which
+ * cannot be interpolated.
+ *
+ * @param from_color_space - source color space
+ * @param to_color_space - target color space
+ */
+bool improc::ColorLookupTable::IsSupported(const improc::ColorSpace& from_color_space, const improc::ColorSpace& to_color_space)
+{
+    return (from_color_space == improc::ColorSpace::Value::kBGR || from_color_space == improc::ColorSpace::Value::kRGB)
+        && (to_color_space == improc::ColorSpace::Value::kHSV || to_color_space == improc::ColorSpace::Value::kLab);
+}
+
+/**
+ * @brief Obtain lookup table for the color conversion. Tables are built on first use and shared for the
+ * lifetime of the process.
+ *
+ * @param from_color_space - source color space
+ * @param to_color_space - target color space
+ * @param mode - trilinear or full lookup table
+ */
+const improc::ColorLookupTable& improc::ColorLookupTable::Get( const improc::ColorSpace& from_color_space, const improc::ColorSpace& to_color_space
+                                                             , improc::ColorLookupTable::Mode mode )
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining {} to {} color lookup table...",from_color_space.ToString(),to_color_space.ToString());
+    using TableKey = std::tuple<improc::ColorSpace::Value,improc::ColorSpace::Value,improc::ColorLookupTable::Mode>;
+    static std::mutex                                                          tables_mutex {};
+    static std::map<TableKey,std::unique_ptr<const improc::ColorLookupTable>>  tables {};
+
+    std::lock_guard<std::mutex> tables_lock {tables_mutex};
+    std::unique_ptr<const improc::ColorLookupTable>& table = tables[TableKey(from_color_space,to_color_space,mode)];
+    if (table == nullptr)
+    {
+        table.reset(new improc::ColorLookupTable(from_color_space,to_color_space,mode));
+    }
+    return *table;
+}
+
+/**
+ * @brief Set lookup table mode used by color space images for supported conversions
+ *
+ * @param mode - lookup table mode. Disabled uses OpenCV for all conversions.
+ */
+void improc::ColorLookupTable::SetMode(improc::ColorLookupTable::Mode mode)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Setting color lookup table mode...");
+    improc::ColorLookupTable::default_mode_ = mode;
+}
+
+/**
+ * @brief Obtain lookup table mode used by color space images for supported conversions
+ */
+improc::ColorLookupTable::Mode improc::ColorLookupTable::GetMode()
+{
+    return improc::ColorLookupTable::default_mode_;
+}
+
+/**
+ * @brief Obtain source color space
+ */
+improc::ColorSpace improc::ColorLookupTable::get_from_color_space() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining source color space...");
+    return this->from_color_space_;
+}
+
+/**
+ * @brief Obtain target color space
+ */
+improc::ColorSpace improc::ColorLookupTable::get_to_color_space() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining target color space...");
+    return this->to_color_space_;
+}
+
+/**
+ * @brief Obtain lookup table mode
+ */
+improc::ColorLookupTable::Mode improc::ColorLookupTable::get_mode() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining color lookup table mode...");
+    return this->mode_;
+}
+
+/**
+ * @brief Convert image with the lookup table
+ *
+ * @param image - 8-bit image with three channels in the source color space
+ * @param converted_image - destination for converted image. Buffer is reused when it already has the image size and type.
+ */
+void improc::ColorLookupTable::Apply(const cv::Mat& image, cv::Mat& converted_image) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Converting image from {} to {} with lookup table...",this->from_color_space_.ToString(),this->to_color_space_.ToString());
+    if (image.type() != CV_8UC3)
+    {
+        std::string error_message = fmt::format("Invalid image for color lookup table. Expected 8-bit image with 3 channels received type {}.",image.type());
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_03: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    converted_image.create(image.size(),CV_8UC3);
+    const uchar* kTable = this->table_.ptr<uchar>();
+    if (this->mode_ == improc::ColorLookupTable::Mode::kFull)
+    {
+        cv::parallel_for_( cv::Range(0,image.rows)
+                         , [&image,&converted_image,kTable] (const cv::Range& range) -> void
+                           {
+                               for (int row = range.start; row < range.end; ++row)
+                               {
+                                   const uchar* kImageRow     = image.ptr<uchar>(row);
+                                   uchar*       converted_row = converted_image.ptr<uchar>(row);
+                                   for (int col = 0; col < image.cols * 3; col += 3)
+                                   {
+                                       const uchar* kEntry = kTable + 3 * (kImageRow[col] << 16 | kImageRow[col + 1] << 8 | kImageRow[col + 2]);
+                                       converted_row[col]     = kEntry[0];
+                                       converted_row[col + 1] = kEntry[1];
+                                       converted_row[col + 2] = kEntry[2];
+                                   }
+                               }
+                           } );
+        return;
+    }
+
+    const GridCoordinates& kGrid = GetGridCoordinates();
+    const bool kIsHue = this->to_color_space_ == improc::ColorSpace::Value::kHSV;
+    cv::parallel_for_( cv::Range(0,image.rows)
+                     , [&image,&converted_image,&kGrid,kTable,kIsHue] (const cv::Range& range) -> void
+                       {
+                           static constexpr int kStep2 = 3;
+                           static constexpr int kStep1 = kStep2 * improc::ColorLookupTable::kGridNodes;
+                           static constexpr int kStep0 = kStep1 * improc::ColorLookupTable::kGridNodes;
+                           for (int row = range.start; row < range.end; ++row)
+                           {
+                               const uchar* kImageRow     = image.ptr<uchar>(row);
+                               uchar*       converted_row = converted_image.ptr<uchar>(row);
+                               for (int col = 0; col < image.cols * 3; col += 3)
+                               {
+                                   const int kWeights[3] = { kGrid.weight[kImageRow[col]]
+                                                           , kGrid.weight[kImageRow[col + 1]]
+                                                           , kGrid.weight[kImageRow[col + 2]] };
+                                   const uchar* kCell = kTable + kGrid.index[kImageRow[col]]     * kStep0
+                                                               + kGrid.index[kImageRow[col + 1]] * kStep1
+                                                               + kGrid.index[kImageRow[col + 2]] * kStep2;
+                                   int corner_weights[8] {};
+                                   const uchar* corners[8] {};
+                                   for (int corner = 0; corner < 8; ++corner)
+                                   {
+                                       corner_weights[corner] = ((corner & 4) != 0 ? kWeights[0] : kWeightOne - kWeights[0])
+                                                              * ((corner & 2) != 0 ? kWeights[1] : kWeightOne - kWeights[1])
+                                                              * ((corner & 1) != 0 ? kWeights[2] : kWeightOne - kWeights[2]);
+                                       corners[corner] = kCell + ((corner & 4) != 0 ? kStep0 : 0)
+                                                               + ((corner & 2) != 0 ? kStep1 : 0)
+                                                               + ((corner & 1) != 0 ? kStep2 : 0);
+                                   }
+
+                                   int first_channel = 0;
+                                   if (kIsHue == true)
+                                   {
+                                       // Hue is interpolated along the shortest arc from the hue of the first corner
+                                       const int kReferenceHue = corners[0][0];
+                                       int hue_difference = 0;
+                                       for (int corner = 0; corner < 8; ++corner)
+                                       {
+                                           int corner_difference = corners[corner][0] - kReferenceHue;
+                                           if (corner_difference > kHueRange / 2)
+                                           {
+                                               corner_difference -= kHueRange;
+                                           }
+                                           else if (corner_difference < -kHueRange / 2)
+                                           {
+                                               corner_difference += kHueRange;
+                                           }
+                                           hue_difference += corner_difference * corner_weights[corner];
+                                       }
+                                       int hue = kReferenceHue + ((hue_difference + (1 << (kRoundingShift - 1))) >> kRoundingShift);
+                                       hue = hue < 0 ? hue + kHueRange : (hue >= kHueRange ? hue - kHueRange : hue);
+                                       converted_row[col] = static_cast<uchar>(hue);
+                                       first_channel = 1;
+                                   }
+                                   for (int channel = first_channel; channel < 3; ++channel)
+                                   {
+                                       int value = 0;
+                                       for (int corner = 0; corner < 8; ++corner)
+                                       {
+                                           value += corners[corner][channel] * corner_weights[corner];
+                                       }
+                                       converted_row[col + channel] = static_cast<uchar>((value + (1 << (kRoundingShift - 1))) >> kRoundingShift);
+                                   }
+                               }
+                           }
+                       } );
+}
\ No newline at end of file
@@ -0,0 +1,385 @@
+#include <improc/corecv/kernels/luminance_threshold.hpp>
+
+#include <cfloat>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+    /**
+     * @brief Luminance of pixel with blue channel at kBlueIdx and red channel at 2 - kBlueIdx.
+     * Uses the fixed-point gray coefficients of cv::cvtColor for 8-bit images.
+     */
+    template <int kChannelsValue, int kBlueIdx>
+    struct Luminance
+    {
+        static constexpr int    kChannels   = kChannelsValue;
+        static constexpr int    kShift      = 14;
+        static constexpr int    kBlueCoeff  = 1868;
+        static constexpr int    kGreenCoeff = 9617;
+        static constexpr int    kRedCoeff   = 4899;
+
+        static uchar            Apply(const uchar* pixel)
+        {
+            if constexpr (kChannels == 1)
+            {
+                return pixel[0];
+            }
+            else
+            {
+                return static_cast<uchar>( ( pixel[kBlueIdx] * kBlueCoeff + pixel[1] * kGreenCoeff + pixel[2 - kBlueIdx] * kRedCoeff
+                                           + (1 << (kShift - 1)) ) >> kShift );
+            }
+        }
+    };
+
+    /**
+     * @brief Call kernel with the luminance of the color space channel layout
+     */
+    template <typename Kernel>
+    void VisitLuminance(const improc::ColorSpace& color_space, const Kernel& kernel)
+    {
+        switch (color_space)
+        {
+            case improc::ColorSpace::Value::kGray: kernel(Luminance<1,0>());  break;
+            case improc::ColorSpace::Value::kBGR : kernel(Luminance<3,0>());  break;
+            case improc::ColorSpace::Value::kRGB : kernel(Luminance<3,2>());  break;
+            case improc::ColorSpace::Value::kBGRA: kernel(Luminance<4,0>());  break;
+            case improc::ColorSpace::Value::kRGBA: kernel(Luminance<4,2>());  break;
+            default:
+                throw improc::key_error("VisitLuminance method not defined for color space enum");
+        }
+    }
+
+    void ValidateImage(const cv::Mat& image, const improc::ColorSpace& color_space)
+    {
+        if ( image.empty() == true || improc::LuminanceThreshold::IsSupported(image.type()) == false
+          || static_cast<unsigned int>(image.channels()) != color_space.GetNumberChannels() )
+        {
+            std::string error_message = fmt::format ( "Invalid image for luminance threshold. Expected 8-bit {} image received type {}."
+                                                    , color_space.ToString(), image.type() );
+            IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+            throw improc::value_error(std::move(error_message));
+        }
+    }
+}
+
+/**
+ * @brief Construct a new improc::LuminanceThreshold object
+ */
+improc::LuminanceThreshold::LuminanceThreshold() : threshold_type_(improc::ThresholdType::kOtsu)
+                                                 , threshold_(0.0)
+                                                 , max_value_(255.0)
+                                                 , window_size_(0) {}
+
+/**
+ * @brief Construct a new improc::LuminanceThreshold object
+ *
+ * @param threshold_type - threshold type
+ * @param threshold - luminance threshold for binary threshold, offset subtracted from the window mean for
+ * adaptive mean threshold and k parameter for Sauvola threshold. Not used by Otsu threshold.
+ * @param max_value - value of pixels with luminance above threshold
+ * @param window_size - side of the square window centered at each pixel. Only used by adaptive thresholds.
+ */
+improc::LuminanceThreshold::LuminanceThreshold( const improc::ThresholdType& threshold_type
+                                              , double threshold, double max_value, int window_size ) : threshold_type_(threshold_type)
+                                                                                                      , threshold_(threshold)
+                                                                                                      , max_value_(max_value)
+                                                                                                      , window_size_(window_size)
+{
+    if (threshold_type.IsAdaptive() == false)
+    {
+        return;
+    }
+    if (window_size < 3 || window_size % 2 == 0)
+    {
+        std::string error_message = fmt::format("Invalid window size {} for {} threshold. Window size should be odd and at least 3.",window_size,threshold_type.ToString());
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    if ( threshold_type == improc::ThresholdType::Value::kSauvola
+      && static_cast<int64_t>(window_size) * window_size > improc::IntegralImage::kMaxSquareSumArea )
+    {
+        std::string error_message = fmt::format( "Invalid window size {} for Sauvola threshold. Window area should be at most {} pixels."
+                                               , window_size, improc::IntegralImage::kMaxSquareSumArea );
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_03: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    if (static_cast<int64_t>(window_size) * window_size > improc::IntegralImage::kMaxSumArea)
+    {
+        std::string error_message = fmt::format( "Invalid window size {} for {} threshold. Window area should be at most {} pixels."
+                                               , window_size, threshold_type.ToString(), improc::IntegralImage::kMaxSumArea );
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_04: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+}
+
+/**
+ * @brief Check if images with type can be thresholded
+ *
+ * @param image_type - image OpenCV type
+ */
+bool improc::LuminanceThreshold::IsSupported(int image_type)
+{
+    return CV_MAT_DEPTH(image_type) == CV_8U;
+}
+
+/**
+ * @brief Compute luminance histogram of image
+ *
+ * Image is split in one stripe of rows per thread and each stripe accumulates its own histogram,
+ * so that threads do not share counters.
+ *
+ * @param image - 8-bit image data
+ * @param color_space - image color space
+ */
+improc::LuminanceThreshold::Histogram improc::LuminanceThreshold::ComputeHistogram(const cv::Mat& image, const improc::ColorSpace& color_space)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Computing luminance histogram for {} image...",color_space.ToString());
+    ValidateImage(image,color_space);
+
+    const int kNumberStripes = std::max(1,std::min(image.rows,cv::getNumThreads()));
+    std::vector<improc::LuminanceThreshold::Histogram> stripe_histograms (kNumberStripes,improc::LuminanceThreshold::Histogram {});
+    VisitLuminance( color_space
+                  , [&image,&stripe_histograms,kNumberStripes] (auto luminance) -> void
+                    {
+                        using LuminanceType = decltype(luminance);
+                        cv::parallel_for_( cv::Range(0,kNumberStripes)
+                                         , [&image,&stripe_histograms,kNumberStripes] (const cv::Range& range) -> void
+                                           {
+                                               for (int stripe = range.start; stripe < range.end; ++stripe)
+                                               {
+                                                   improc::LuminanceThreshold::Histogram& histogram = stripe_histograms[stripe];
+                                                   const int kRowStart = static_cast<int>(static_cast<int64_t>(image.rows) * stripe / kNumberStripes);
+                                                   const int kRowEnd   = static_cast<int>(static_cast<int64_t>(image.rows) * (stripe + 1) / kNumberStripes);
+                                                   for (int row = kRowStart; row < kRowEnd; ++row)
+                                                   {
+                                                       const uchar* image_row = image.ptr<uchar>(row);
+                                                       for (int col = 0; col < image.cols; ++col)
+                                                       {
+                                                           ++histogram[LuminanceType::Apply(image_row + col * LuminanceType::kChannels)];
+                                                       }
+                                                   }
+                                               }
+                                           }
+                                         , kNumberStripes );
+                    } );
+
+    improc::LuminanceThreshold::Histogram histogram {};
+    for (const improc::LuminanceThreshold::Histogram& stripe_histogram : stripe_histograms)
+    {
+        for (int level = 0; level < improc::LuminanceThreshold::kHistogramSize; ++level)
+        {
+            histogram[level] += stripe_histogram[level];
+        }
+    }
+    return histogram;
+}
+
+/**
+ * @brief Compute Otsu threshold from luminance histogram. Follows the cv::threshold implementation,
+ * so that the selected level is the same.
+ *
+ * @param histogram - luminance histogram
+ */
+double improc::LuminanceThreshold::ComputeOtsuThreshold(const improc::LuminanceThreshold::Histogram& histogram)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Computing Otsu threshold...");
+    size_t number_pixels = 0;
+    double mu = 0.0;
+    for (int level = 0; level < improc::LuminanceThreshold::kHistogramSize; ++level)
+    {
+        number_pixels += histogram[level];
+        mu            += level * static_cast<double>(histogram[level]);
+    }
+    if (number_pixels == 0)
+    {
+        return 0.0;
+    }
+
+    const double kScale = 1.0 / number_pixels;
+    mu *= kScale;
+
+    double mu1 = 0.0;
+    double q1  = 0.0;
+    double max_sigma = 0.0;
+    double max_level = 0.0;
+    for (int level = 0; level < improc::LuminanceThreshold::kHistogramSize; ++level)
+    {
+        const double kProbability = histogram[level] * kScale;
+        mu1 *= q1;
+        q1  += kProbability;
+        const double kQ2 = 1.0 - q1;
+        if (std::min(q1,kQ2) < FLT_EPSILON || std::max(q1,kQ2) > 1.0 - FLT_EPSILON)
+        {
+            continue;
+        }
+
+        mu1 = (mu1 + level * kProbability) / q1;
+        const double kMu2   = (mu - q1 * mu1) / kQ2;
+        const double kSigma = q1 * kQ2 * (mu1 - kMu2) * (mu1 - kMu2);
+        if (kSigma > max_sigma)
+        {
+            max_sigma = kSigma;
+            max_level = level;
+        }
+    }
+    return max_level;
+}
+
+/**
+ * @brief Obtain threshold type
+ */
+improc::ThresholdType improc::LuminanceThreshold::get_threshold_type() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining threshold type...");
+    return this->threshold_type_;
+}
+
+/**
+ * @brief Obtain luminance threshold of binary threshold, offset of adaptive mean threshold or k parameter of Sauvola threshold
+ */
+double improc::LuminanceThreshold::get_threshold() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining threshold...");
+    return this->threshold_;
+}
+
+/**
+ * @brief Obtain value of pixels with luminance above threshold
+ */
+double improc::LuminanceThreshold::get_max_value() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining threshold maximum value...");
+    return this->max_value_;
+}
+
+/**
+ * @brief Obtain side of the window used by adaptive thresholds
+ */
+int improc::LuminanceThreshold::get_window_size() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining threshold window size...");
+    return this->window_size_;
+}
+
+/**
+ * @brief Apply threshold to image luminance
+ *
+ * @param image - 8-bit image data
+ * @param color_space - image color space
+ * @param threshold_image - destination for single channel binary image. Buffer is reused when it already has the image size and type.
+ * @param integral_image - destination for the luminance integral image computed by adaptive thresholds, so that
+ * later stages can reuse it. Not modified by global thresholds.
+ * @return double - luminance threshold applied. Adaptive thresholds return NaN, since each pixel has its own threshold.
+ */
+double improc::LuminanceThreshold::Apply( const cv::Mat& image, const improc::ColorSpace& color_space, cv::Mat& threshold_image
+                                        , improc::IntegralImage* integral_image ) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Applying {} luminance threshold to {} image...",this->threshold_type_.ToString(),color_space.ToString());
+    ValidateImage(image,color_space);
+    if (this->threshold_type_.IsAdaptive() == true)
+    {
+        this->ApplyAdaptive(image,color_space,threshold_image,integral_image);
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    const double kThreshold = this->threshold_type_ == improc::ThresholdType::Value::kOtsu
+                            ? improc::LuminanceThreshold::ComputeOtsuThreshold(improc::LuminanceThreshold::ComputeHistogram(image,color_space))
+                            : this->threshold_;
+    const int   kLevel    = cvFloor(kThreshold);
+    const uchar kMaxValue = cv::saturate_cast<uchar>(this->max_value_);
+
+    // Each pixel is read before its output is written, so a gray image can be thresholded in-place
+    threshold_image.create(image.size(),CV_8UC1);
+    VisitLuminance( color_space
+                  , [&image,&threshold_image,kLevel,kMaxValue] (auto luminance) -> void
+                    {
+                        using LuminanceType = decltype(luminance);
+                        cv::parallel_for_( cv::Range(0,image.rows)
+                                         , [&image,&threshold_image,kLevel,kMaxValue] (const cv::Range& range) -> void
+                                           {
+                                               for (int row = range.start; row < range.end; ++row)
+                                               {
+                                                   const uchar* image_row     = image.ptr<uchar>(row);
+                                                   uchar*       threshold_row = threshold_image.ptr<uchar>(row);
+                                                   for (int col = 0; col < image.cols; ++col)
+                                                   {
+                                                       threshold_row[col] = LuminanceType::Apply(image_row + col * LuminanceType::kChannels) > kLevel ? kMaxValue : 0;
+                                                   }
+                                               }
+                                           } );
+                    } );
+    return kThreshold;
+}
+
+
+/**
+ * @brief Apply adaptive threshold to image luminance
+ *
+ * Luminance is written to the destination image, except for gray images that are already luminance.
+ * Window sums are read from the luminance integral image and the destination is thresholded in-place,
+ * since each pixel luminance is read before its output is written.
+ */
+void improc::LuminanceThreshold::ApplyAdaptive( const cv::Mat& image, const improc::ColorSpace& color_space, cv::Mat& threshold_image
+                                              , improc::IntegralImage* integral_image ) const
+{
+    threshold_image.create(image.size(),CV_8UC1);
+    if (color_space != improc::ColorSpace::Value::kGray)
+    {
+        VisitLuminance( color_space
+                      , [&image,&threshold_image] (auto luminance) -> void
+                        {
+                            using LuminanceType = decltype(luminance);
+                            cv::parallel_for_( cv::Range(0,image.rows)
+                                             , [&image,&threshold_image] (const cv::Range& range) -> void
+                                               {
+                                                   for (int row = range.start; row < range.end; ++row)
+                                                   {
+                                                       const uchar* image_row     = image.ptr<uchar>(row);
+                                                       uchar*       luminance_row = threshold_image.ptr<uchar>(row);
+                                                       for (int col = 0; col < image.cols; ++col)
+                                                       {
+                                                           luminance_row[col] = LuminanceType::Apply(image_row + col * LuminanceType::kChannels);
+                                                       }
+                                                   }
+                                               } );
+                        } );
+    }
+    const cv::Mat& kLuminanceImage = color_space == improc::ColorSpace::Value::kGray ? image : threshold_image;
+
+    const bool kIsSauvola = this->threshold_type_ == improc::ThresholdType::Value::kSauvola;
+    improc::IntegralImage integral {kLuminanceImage,kIsSauvola};
+
+    const cv::Size kWindowSize {this->window_size_,this->window_size_};
+    const double   kParameter = this->threshold_;
+    const uchar    kMaxValue  = cv::saturate_cast<uchar>(this->max_value_);
+    cv::parallel_for_( cv::Range(0,image.rows)
+                     , [&integral,&kLuminanceImage,&threshold_image,&kWindowSize,kParameter,kMaxValue,kIsSauvola] (const cv::Range& range) -> void
+                       {
+                           for (int row = range.start; row < range.end; ++row)
+                           {
+                               const uchar* luminance_row = kLuminanceImage.ptr<uchar>(row);
+                               uchar*       threshold_row = threshold_image.ptr<uchar>(row);
+                               for (int col = 0; col < kLuminanceImage.cols; ++col)
+                               {
+                                   const cv::Rect kWindow = integral.GetCenteredWindow(row,col,kWindowSize);
+                                   const double   kArea   = kWindow.area();
+                                   const double   kMean   = integral.GetSum(kWindow) / kArea;
+                                   double threshold = kMean - kParameter;
+                                   if (kIsSauvola == true)
+                                   {
+                                       const double kVariance = std::max(0.0,integral.GetSquareSum(kWindow) / kArea - kMean * kMean);
+                                       threshold = kMean * (1.0 + kParameter * (std::sqrt(kVariance) / improc::LuminanceThreshold::kSauvolaDynamicRange - 1.0));
+                                   }
+                                   threshold_row[col] = luminance_row[col] > threshold ? kMaxValue : 0;
+                               }
+                           }
+                       } );
+
+    if (integral_image != nullptr)
+    {
+        (*integral_image) = std::move(integral);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,277 @@
+#include <improc/corecv/kernels/rectangle_morphology.hpp>
+#include <improc/corecv/image_allocator.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+    static constexpr size_t kColumnStripBytes = 256;
+
+    /**
+     * @brief Minimum used by erosion. Pixels outside the image take the identity value.
+     */
+    struct MinOper
+    {
+        static constexpr uchar  kIdentity = std::numeric_limits<uchar>::max();
+        static uchar            Apply(uchar lhs, uchar rhs) {return std::min(lhs,rhs);}
+    };
+
+    /**
+     * @brief Maximum used by dilation. Pixels outside the image take the identity value.
+     */
+    struct MaxOper
+    {
+        static constexpr uchar  kIdentity = std::numeric_limits<uchar>::min();
+        static uchar            Apply(uchar lhs, uchar rhs) {return std::max(lhs,rhs);}
+    };
+
+    /**
+     * @brief Van Herk/Gil-Werman running minimum or maximum along lines of elements
+     *
+     * The line is padded with the identity value by anchor elements before and kernel_size - anchor - 1
+     * elements after, and split in blocks of kernel_size elements. The window of output y starts in block j
+     * and ends in block j + 1, so it is given by the suffix of block j at y and the prefix of block j + 1 at
+     * y + kernel_size - 1. Only one suffix and one prefix block are kept, each with kernel_size lines.
+     *
+     * @param length - number of lines
+     * @param kernel_size - window size
+     * @param anchor - window position of output line
+     * @param width - number of elements of each line
+     * @param line_at - obtain pointer to source line
+     * @param output_at - obtain pointer to output line
+     * @param identity_line - line with identity value of operation
+     * @param suffix - buffer with kernel_size lines
+     * @param prefix - buffer with kernel_size lines
+     */
+    template <typename Oper, typename LineAt, typename OutputAt>
+    void RunningExtremum( int length, int kernel_size, int anchor, size_t width
+                        , const LineAt& line_at, const OutputAt& output_at, const uchar* identity_line
+                        , uchar* suffix, uchar* prefix )
+    {
+        const int kPaddedLength = length + kernel_size - 1;
+        const auto kPaddedLineAt = [&line_at,identity_line,length,anchor] (int padded_idx) -> const uchar*
+                                   {
+                                       const int kIdx = padded_idx - anchor;
+                                       return kIdx >= 0 && kIdx < length ? line_at(kIdx) : identity_line;
+                                   };
+
+        for (int block_start = 0; block_start < length; block_start += kernel_size)
+        {
+            // Block is always complete, since block_start + kernel_size <= length + kernel_size - 1
+            const int kBlockEnd = block_start + kernel_size;
+            std::copy_n(kPaddedLineAt(kBlockEnd - 1),width,suffix + (kernel_size - 1) * width);
+            for (int idx = kBlockEnd - 2; idx >= block_start; --idx)
+            {
+                const uchar* line        = kPaddedLineAt(idx);
+                const uchar* next_suffix = suffix + (idx - block_start + 1) * width;
+                uchar*       cur_suffix  = suffix + (idx - block_start)     * width;
+                for (size_t elem = 0; elem < width; ++elem)
+                {
+                    cur_suffix[elem] = Oper::Apply(line[elem],next_suffix[elem]);
+                }
+            }
+
+            const int kNextBlockEnd = std::min(kBlockEnd + kernel_size,kPaddedLength);
+            if (kBlockEnd < kNextBlockEnd)
+            {
+                std::copy_n(kPaddedLineAt(kBlockEnd),width,prefix);
+            }
+            for (int idx = kBlockEnd + 1; idx < kNextBlockEnd; ++idx)
+            {
+                const uchar* line        = kPaddedLineAt(idx);
+                const uchar* prev_prefix = prefix + (idx - kBlockEnd - 1) * width;
+                uchar*       cur_prefix  = prefix + (idx - kBlockEnd)     * width;
+                for (size_t elem = 0; elem < width; ++elem)
+                {
+                    cur_prefix[elem] = Oper::Apply(line[elem],prev_prefix[elem]);
+                }
+            }
+
+            std::copy_n(suffix,width,output_at(block_start));
+            for (int idx = block_start + 1; idx < std::min(kBlockEnd,length); ++idx)
+            {
+                const uchar* cur_suffix = suffix + (idx - block_start) * width;
+                const uchar* cur_prefix = prefix + (idx - block_start - 1) * width;
+                uchar*       output     = output_at(idx);
+                for (size_t elem = 0; elem < width; ++elem)
+                {
+                    output[elem] = Oper::Apply(cur_suffix[elem],cur_prefix[elem]);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Apply running minimum or maximum along rows of image
+     */
+    template <typename Oper>
+    void ApplyRows(const cv::Mat& image, cv::Mat& row_image, int kernel_width, int anchor_x)
+    {
+        cv::parallel_for_( cv::Range(0,image.rows)
+                         , [&image,&row_image,kernel_width,anchor_x] (const cv::Range& range) -> void
+                           {
+                               const size_t kPixelSize = image.elemSize();
+                               const std::vector<uchar> kIdentityPixel (kPixelSize,Oper::kIdentity);
+                               std::vector<uchar> suffix (kernel_width * kPixelSize);
+                               std::vector<uchar> prefix (kernel_width * kPixelSize);
+                               for (int row = range.start; row < range.end; ++row)
+                               {
+                                   const uchar* image_row = image.ptr<uchar>(row);
+                                   uchar*       output_row = row_image.ptr<uchar>(row);
+                                   RunningExtremum<Oper>( image.cols,kernel_width,anchor_x,kPixelSize
+                                                        , [image_row,kPixelSize] (int col) -> const uchar* {return image_row + col * kPixelSize;}
+                                                        , [output_row,kPixelSize] (int col) -> uchar* {return output_row + col * kPixelSize;}
+                                                        , kIdentityPixel.data(),suffix.data(),prefix.data() );
+                               }
+                           } );
+    }
+
+    /**
+     * @brief Apply running minimum or maximum along columns of image. Columns are processed in
+     * vertical strips, so that the inner loops run over contiguous bytes of each row.
+     */
+    template <typename Oper>
+    void ApplyColumns(const cv::Mat& image, cv::Mat& column_image, int kernel_height, int anchor_y)
+    {
+        const size_t kRowBytes        = image.cols * image.elemSize();
+        const int    kNumberStrips    = static_cast<int>((kRowBytes + kColumnStripBytes - 1) / kColumnStripBytes);
+        cv::parallel_for_( cv::Range(0,kNumberStrips)
+                         , [&image,&column_image,kRowBytes,kernel_height,anchor_y] (const cv::Range& range) -> void
+                           {
+                               const std::vector<uchar> kIdentityLine (kColumnStripBytes,Oper::kIdentity);
+                               std::vector<uchar> suffix (kernel_height * kColumnStripBytes);
+                               std::vector<uchar> prefix (kernel_height * kColumnStripBytes);
+                               for (int strip = range.start; strip < range.end; ++strip)
+                               {
+                                   const size_t kStripStart = strip * kColumnStripBytes;
+                                   const size_t kStripWidth = std::min(kColumnStripBytes,kRowBytes - kStripStart);
+                                   RunningExtremum<Oper>( image.rows,kernel_height,anchor_y,kStripWidth
+                                                        , [&image,kStripStart] (int row) -> const uchar* {return image.ptr<uchar>(row) + kStripStart;}
+                                                        , [&column_image,kStripStart] (int row) -> uchar* {return column_image.ptr<uchar>(row) + kStripStart;}
+                                                        , kIdentityLine.data(),suffix.data(),prefix.data() );
+                               }
+                           } );
+    }
+
+    /**
+     * @brief Erode or dilate image with separable row and column passes
+     */
+    template <typename Oper>
+    void ApplySeparable(const cv::Mat& image, cv::Mat& morphology_image, const cv::Size& kernel_size, const cv::Point& anchor)
+    {
+        // Row pass output is a separate buffer, since passes read source lines after output lines are written
+        cv::Mat row_image = improc::ImageAllocator::get().CreateMat(image.size(),image.type());
+        ApplyRows<Oper>(image,row_image,kernel_size.width,anchor.x);
+        morphology_image.create(image.size(),image.type());
+        ApplyColumns<Oper>(row_image,morphology_image,kernel_size.height,anchor.y);
+    }
+}
+
+/**
+ * @brief Construct a new improc::RectangleMorphology object
+ */
+improc::RectangleMorphology::RectangleMorphology() : oper_(improc::MorphologicalOper::kDilate)
+                                                   , kernel_size_(cv::Size(1,1))
+                                                   , anchor_(cv::Point(0,0)) {}
+
+/**
+ * @brief Construct a new improc::RectangleMorphology object
+ *
+ * @param oper - morphological operation
+ * @param kernel_size - rectangular kernel size
+ * @param number_iterations - number of times the operation is applied. Iterations are folded into an enlarged kernel.
+ */
+improc::RectangleMorphology::RectangleMorphology( const improc::MorphologicalOper& oper, const cv::Size& kernel_size
+                                                , unsigned int number_iterations ) : RectangleMorphology()
+{
+    IMPROC_CORECV_LOGGER_TRACE  ( "Creating rectangle morphology {} with kernel {}x{} and {} iterations..."
+                                , oper.ToString(), kernel_size.width, kernel_size.height, number_iterations );
+    if (kernel_size.width <= 0 || kernel_size.height <= 0 || number_iterations == 0)
+    {
+        std::string error_message = fmt::format ( "Invalid rectangle morphology with kernel {}x{} and {} iterations."
+                                                , kernel_size.width, kernel_size.height, number_iterations );
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    // Applying a rectangle n times is the same as applying once a rectangle with size n * (size - 1) + 1.
+    // This also holds when pixels outside the image are ignored, since rectangles are convex.
+    const int kNumberIterations = static_cast<int>(number_iterations);
+    this->oper_        = oper;
+    this->kernel_size_ = cv::Size( kNumberIterations * (kernel_size.width  - 1) + 1
+                                 , kNumberIterations * (kernel_size.height - 1) + 1 );
+    this->anchor_      = cv::Point(kNumberIterations * (kernel_size.width / 2),kNumberIterations * (kernel_size.height / 2));
+}
+
+/**
+ * @brief Check if images with type can be processed by the kernel
+ *
+ * @param image_type - image OpenCV type
+ */
+bool improc::RectangleMorphology::IsSupported(int image_type)
+{
+    return CV_MAT_DEPTH(image_type) == CV_8U;
+}
+
+/**
+ * @brief Obtain morphological operation
+ */
+improc::MorphologicalOper improc::RectangleMorphology::get_oper() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining morphological operation...");
+    return this->oper_;
+}
+
+/**
+ * @brief Obtain kernel size with iterations folded
+ */
+cv::Size improc::RectangleMorphology::get_kernel_size() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining kernel size...");
+    return this->kernel_size_;
+}
+
+/**
+ * @brief Obtain kernel anchor with iterations folded
+ */
+cv::Point improc::RectangleMorphology::get_anchor() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining kernel anchor...");
+    return this->anchor_;
+}
+
+/**
+ * @brief Apply morphological operation to image
+ *
+ * @param image - 8-bit image data
+ * @param morphology_image - destination for processed image. Buffer is reused when it already has the image size and type.
+ */
+void improc::RectangleMorphology::Apply(const cv::Mat& image, cv::Mat& morphology_image) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Applying rectangle morphology {}...",this->oper_.ToString());
+    if (image.empty() == true || improc::RectangleMorphology::IsSupported(image.type()) == false)
+    {
+        std::string error_message = fmt::format("Invalid image for rectangle morphology. Expected 8-bit image received type {}.",image.type());
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    switch (this->oper_)
+    {
+        case improc::MorphologicalOper::Value::kErode:
+            ApplySeparable<MinOper>(image,morphology_image,this->kernel_size_,this->anchor_);
+            break;
+        case improc::MorphologicalOper::Value::kDilate:
+            ApplySeparable<MaxOper>(image,morphology_image,this->kernel_size_,this->anchor_);
+            break;
+        case improc::MorphologicalOper::Value::kOpen:
+            ApplySeparable<MinOper>(image,morphology_image,this->kernel_size_,this->anchor_);
+            ApplySeparable<MaxOper>(morphology_image,morphology_image,this->kernel_size_,this->anchor_);
+            break;
+        case improc::MorphologicalOper::Value::kClose:
+            ApplySeparable<MaxOper>(image,morphology_image,this->kernel_size_,this->anchor_);
+            ApplySeparable<MinOper>(morphology_image,morphology_image,this->kernel_size_,this->anchor_);
+            break;
+    }
+}
@@ -0,0 +1,315 @@
+#include <improc/corecv/kernels/yuv_resize.hpp>
+
+#include <algorithm>
+
+namespace
+{
+    /**
+     * @brief Plane of 8-bit samples. Sample (row,col) is at row * step + col * pixel_step.
+     */
+    struct Plane
+    {
+        const uchar*    data;
+        size_t          step;
+        size_t          pixel_step;
+
+        uchar           At(int row, int col) const
+        {
+            return this->data[row * this->step + col * this->pixel_step];
+        }
+    };
+
+    /**
+     * @brief Luma and chroma planes of YUV image data. Chroma rows are luma rows shifted by chroma_row_shift.
+     */
+    struct YUVPlanes
+    {
+        Plane           luma;
+        Plane           u;
+        Plane           v;
+        int             chroma_row_shift;
+    };
+
+    YUVPlanes GetPlanes(const cv::Mat& image, const improc::ColorSpace& color_space, const cv::Size& image_size)
+    {
+        const size_t kStep = image.step[0];
+        switch (color_space)
+        {
+            case improc::ColorSpace::Value::kNV12:
+            {
+                const uchar* kChroma = image.ptr<uchar>(image_size.height);
+                return YUVPlanes {{image.data,kStep,1},{kChroma,kStep,2},{kChroma + 1,kStep,2},1};
+            }
+            case improc::ColorSpace::Value::kI420:
+            {
+                // Chroma planes are packed after the luma plane, so image data should be continuous
+                const size_t kChromaStep = static_cast<size_t>(image_size.width / 2);
+                const uchar* kU = image.data + kStep * image_size.height;
+                const uchar* kV = kU + kChromaStep * (image_size.height / 2);
+                return YUVPlanes {{image.data,kStep,1},{kU,kChromaStep,1},{kV,kChromaStep,1},1};
+            }
+            case improc::ColorSpace::Value::kYUYV:
+                return YUVPlanes {{image.data,kStep,2},{image.data + 1,kStep,4},{image.data + 3,kStep,4},0};
+            default:
+                throw improc::key_error("GetPlanes method not defined for color space enum");
+        }
+    }
+
+    /**
+     * @brief Writer of pixels with blue channel at kBlueIdx and red channel at 2 - kBlueIdx.
+     * Uses the fixed-point BT.601 coefficients of cv::cvtColor for 8-bit YUV images.
+     */
+    template <int kChannelsValue, int kBlueIdx>
+    struct RGBWriter
+    {
+        static constexpr int    kChannels       = kChannelsValue;
+        static constexpr int    kShift          = 20;
+        static constexpr int    kYCoeff         = 1220542;
+        static constexpr int    kUBlueCoeff     = 2116026;
+        static constexpr int    kUGreenCoeff    = -409993;
+        static constexpr int    kVGreenCoeff    = -852492;
+        static constexpr int    kVRedCoeff      = 1673527;
+
+        static void             Write(uchar* pixel, int luma, int u, int v)
+        {
+            if constexpr (kChannels == 1)
+            {
+                pixel[0] = static_cast<uchar>(luma);
+            }
+            else
+            {
+                const int kLuma  = std::max(0,luma - 16) * kYCoeff;
+                const int kRound = 1 << (kShift - 1);
+                pixel[kBlueIdx]     = cv::saturate_cast<uchar>((kLuma + kRound + kUBlueCoeff  * (u - 128)) >> kShift);
+                pixel[1]            = cv::saturate_cast<uchar>((kLuma + kRound + kUGreenCoeff * (u - 128) + kVGreenCoeff * (v - 128)) >> kShift);
+                pixel[2 - kBlueIdx] = cv::saturate_cast<uchar>((kLuma + kRound + kVRedCoeff   * (v - 128)) >> kShift);
+                if constexpr (kChannels == 4)
+                {
+                    pixel[3] = 255;
+                }
+            }
+        }
+    };
+
+    /**
+     * @brief Call kernel with the writer of the color space channel layout
+     */
+    template <typename Kernel>
+    void VisitWriter(const improc::ColorSpace& color_space, const Kernel& kernel)
+    {
+        switch (color_space)
+        {
+            case improc::ColorSpace::Value::kGray: kernel(RGBWriter<1,0>());  break;
+            case improc::ColorSpace::Value::kBGR : kernel(RGBWriter<3,0>());  break;
+            case improc::ColorSpace::Value::kRGB : kernel(RGBWriter<3,2>());  break;
+            case improc::ColorSpace::Value::kBGRA: kernel(RGBWriter<4,0>());  break;
+            case improc::ColorSpace::Value::kRGBA: kernel(RGBWriter<4,2>());  break;
+            default:
+                throw improc::key_error("VisitWriter method not defined for color space enum");
+        }
+    }
+
+    /**
+     * @brief Interpolate plane sample from its two neighbor rows and columns with fixed-point weights
+     */
+    int Interpolate( const Plane& plane, const int rows[2], const int cols[2]
+                   , const short* x_coefficients, const short* y_coefficients )
+    {
+        static constexpr int kRoundingShift = 2 * improc::ResizeCoefficients::kCoefficientBits;
+        const int kTop    = plane.At(rows[0],cols[0]) * x_coefficients[0] + plane.At(rows[0],cols[1]) * x_coefficients[1];
+        const int kBottom = plane.At(rows[1],cols[0]) * x_coefficients[0] + plane.At(rows[1],cols[1]) * x_coefficients[1];
+        return (kTop * y_coefficients[0] + kBottom * y_coefficients[1] + (1 << (kRoundingShift - 1))) >> kRoundingShift;
+    }
+}
+
+/**
+ * @brief Construct a new improc::YUVResize object
+ */
+improc::YUVResize::YUVResize() : from_color_space_(improc::ColorSpace::kNV12)
+                               , to_color_space_(improc::ColorSpace::kBGR)
+                               , luma_coefficients_(improc::ResizeCoefficients())
+                               , chroma_coefficients_(improc::ResizeCoefficients()) {}
+
+/**
+ * @brief Construct a new improc::YUVResize object
+ *
+ * @param from_color_space - source YUV color space
+ * @param to_color_space - target color space. Gray, RGB, BGR, RGBA and BGRA are supported.
+ * @param from_image_size - source image size in pixels. Width should be even, as well as height of planar images.
+ * @param to_image_size - target image size
+ * @param interpolation - interpolation type. Only linear and nearest interpolation are supported.
+ */
+improc::YUVResize::YUVResize( const improc::ColorSpace& from_color_space, const improc::ColorSpace& to_color_space
+                            , const cv::Size& from_image_size, const cv::Size& to_image_size
+                            , const improc::InterpolationType& interpolation ) : YUVResize()
+{
+    IMPROC_CORECV_LOGGER_TRACE  ( "Creating {} to {} resize from {}x{} to {}x{}..."
+                                , from_color_space.ToString(), to_color_space.ToString()
+                                , from_image_size.width, from_image_size.height, to_image_size.width, to_image_size.height );
+    if (improc::YUVResize::IsSupported(from_color_space,to_color_space,interpolation) == false)
+    {
+        std::string error_message = fmt::format ( "YUV resize not defined from {} to {} with {} interpolation."
+                                                , from_color_space.ToString(), to_color_space.ToString(), interpolation.ToString() );
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    if ( from_image_size.width % 2 != 0
+      || (from_color_space != improc::ColorSpace::Value::kYUYV && from_image_size.height % 2 != 0) )
+    {
+        std::string error_message = fmt::format ( "Invalid image size {}x{} for {} resize. Width and planar image height should be even."
+                                                , from_image_size.width, from_image_size.height, from_color_space.ToString() );
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    this->from_color_space_  = from_color_space;
+    this->to_color_space_    = to_color_space;
+    this->luma_coefficients_ = improc::ResizeCoefficients(from_image_size,to_image_size,interpolation);
+    // Nearest chroma samples are the chroma of the nearest luma samples, as in cv::cvtColor
+    if (interpolation == improc::InterpolationType::Value::kLinear)
+    {
+        const cv::Size kChromaSize {from_image_size.width / 2,from_color_space == improc::ColorSpace::Value::kYUYV ? from_image_size.height : from_image_size.height / 2};
+        this->chroma_coefficients_ = improc::ResizeCoefficients(kChromaSize,to_image_size,interpolation);
+    }
+}
+
+/**
+ * @brief Check if YUV images can be converted and resized
+ *
+ * @param from_color_space - source color space
+ * @param to_color_space - target color space
+ * @param interpolation - interpolation type
+ */
+bool improc::YUVResize::IsSupported( const improc::ColorSpace& from_color_space, const improc::ColorSpace& to_color_space
+                                   , const improc::InterpolationType& interpolation )
+{
+    return from_color_space.IsYUV() == true && to_color_space.IsYUV() == false
+        && (interpolation == improc::InterpolationType::Value::kLinear || interpolation == improc::InterpolationType::Value::kNearest);
+}
+
+/**
+ * @brief Obtain source color space
+ */
+improc::ColorSpace improc::YUVResize::get_from_color_space() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining source color space...");
+    return this->from_color_space_;
+}
+
+/**
+ * @brief Obtain target color space
+ */
+improc::ColorSpace improc::YUVResize::get_to_color_space() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining target color space...");
+    return this->to_color_space_;
+}
+
+/**
+ * @brief Obtain source image size in pixels
+ */
+cv::Size improc::YUVResize::get_from_image_size() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining source image size...");
+    return this->luma_coefficients_.get_from_image_size();
+}
+
+/**
+ * @brief Obtain target image size
+ */
+cv::Size improc::YUVResize::get_to_image_size() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining target image size...");
+    return this->luma_coefficients_.get_to_image_size();
+}
+
+/**
+ * @brief Obtain interpolation type
+ */
+improc::InterpolationType improc::YUVResize::get_interpolation() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining interpolation type...");
+    return this->luma_coefficients_.get_interpolation();
+}
+
+/**
+ * @brief Convert and resize YUV image
+ *
+ * @param image - YUV image data with source image size. I420 image data should be continuous.
+ * @param resized_image - destination for converted and resized image. Buffer is reused when it already has the target size and type.
+ */
+void improc::YUVResize::Apply(const cv::Mat& image, cv::Mat& resized_image) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Resizing {} image to {}...",this->from_color_space_.ToString(),this->to_color_space_.ToString());
+    const cv::Size kFromImageSize = this->luma_coefficients_.get_from_image_size();
+    if ( image.type() != CV_8UC(static_cast<int>(this->from_color_space_.GetNumberChannels()))
+      || image.size() != this->from_color_space_.GetDataSize(kFromImageSize)
+      || (this->from_color_space_ == improc::ColorSpace::Value::kI420 && image.isContinuous() == false) )
+    {
+        const cv::Size kDataSize = this->from_color_space_.GetDataSize(kFromImageSize);
+        std::string error_message = fmt::format ( "Invalid image for YUV resize. Expected {} image data with size {}x{} received type {} with size {}x{}."
+                                                , this->from_color_space_.ToString(), kDataSize.width, kDataSize.height
+                                                , image.type(), image.cols, image.rows );
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_03: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    const cv::Size  kToImageSize = this->luma_coefficients_.get_to_image_size();
+    const YUVPlanes kPlanes      = GetPlanes(image,this->from_color_space_,kFromImageSize);
+    resized_image.create(kToImageSize,CV_8UC(static_cast<int>(this->to_color_space_.GetNumberChannels())));
+    const bool kIsLinear = this->luma_coefficients_.get_interpolation() == improc::InterpolationType::Value::kLinear;
+    VisitWriter( this->to_color_space_
+               , [this,&kPlanes,&kFromImageSize,&resized_image,kIsLinear] (auto writer) -> void
+                 {
+                     using WriterType = decltype(writer);
+                     const std::vector<int>& kXOffsets = this->luma_coefficients_.get_x_offsets();
+                     const std::vector<int>& kYOffsets = this->luma_coefficients_.get_y_offsets();
+                     cv::parallel_for_( cv::Range(0,resized_image.rows)
+                                      , [this,&kPlanes,&kFromImageSize,&resized_image,&kXOffsets,&kYOffsets,kIsLinear] (const cv::Range& range) -> void
+                                        {
+                                            if (kIsLinear == false)
+                                            {
+                                                for (int to_row = range.start; to_row < range.end; ++to_row)
+                                                {
+                                                    const int kLumaRow   = kYOffsets[to_row];
+                                                    const int kChromaRow = kLumaRow >> kPlanes.chroma_row_shift;
+                                                    uchar*    resized_row = resized_image.ptr<uchar>(to_row);
+                                                    for (int to_col = 0; to_col < resized_image.cols; ++to_col)
+                                                    {
+                                                        const int kLumaCol   = kXOffsets[to_col];
+                                                        const int kChromaCol = kLumaCol / 2;
+                                                        WriterType::Write( resized_row + to_col * WriterType::kChannels,kPlanes.luma.At(kLumaRow,kLumaCol)
+                                                                         , kPlanes.u.At(kChromaRow,kChromaCol),kPlanes.v.At(kChromaRow,kChromaCol) );
+                                                    }
+                                                }
+                                                return;
+                                            }
+
+                                            const std::vector<short>& kXCoefficients       = this->luma_coefficients_.get_x_coefficients();
+                                            const std::vector<short>& kYCoefficients       = this->luma_coefficients_.get_y_coefficients();
+                                            const std::vector<int>&   kChromaXOffsets      = this->chroma_coefficients_.get_x_offsets();
+                                            const std::vector<int>&   kChromaYOffsets      = this->chroma_coefficients_.get_y_offsets();
+                                            const std::vector<short>& kChromaXCoefficients = this->chroma_coefficients_.get_x_coefficients();
+                                            const std::vector<short>& kChromaYCoefficients = this->chroma_coefficients_.get_y_coefficients();
+                                            const cv::Size            kChromaSize          = this->chroma_coefficients_.get_from_image_size();
+                                            for (int to_row = range.start; to_row < range.end; ++to_row)
+                                            {
+                                                const int kLumaRows[2]   = {kYOffsets[to_row],std::min(kYOffsets[to_row] + 1,kFromImageSize.height - 1)};
+                                                const int kChromaRows[2] = {kChromaYOffsets[to_row],std::min(kChromaYOffsets[to_row] + 1,kChromaSize.height - 1)};
+                                                uchar*    resized_row    = resized_image.ptr<uchar>(to_row);
+                                                for (int to_col = 0; to_col < resized_image.cols; ++to_col)
+                                                {
+                                                    const int kLumaCols[2]   = {kXOffsets[to_col],std::min(kXOffsets[to_col] + 1,kFromImageSize.width - 1)};
+                                                    const int kChromaCols[2] = {kChromaXOffsets[to_col],std::min(kChromaXOffsets[to_col] + 1,kChromaSize.width - 1)};
+                                                    const int kLuma = Interpolate( kPlanes.luma,kLumaRows,kLumaCols
+                                                                                 , kXCoefficients.data() + 2 * to_col,kYCoefficients.data() + 2 * to_row );
+                                                    const int kU    = Interpolate( kPlanes.u,kChromaRows,kChromaCols
+                                                                                 , kChromaXCoefficients.data() + 2 * to_col,kChromaYCoefficients.data() + 2 * to_row );
+                                                    const int kV    = Interpolate( kPlanes.v,kChromaRows,kChromaCols
+                                                                                 , kChromaXCoefficients.data() + 2 * to_col,kChromaYCoefficients.data() + 2 * to_row );
+                                                    WriterType::Write(resized_row + to_col * WriterType::kChannels,kLuma,kU,kV);
+                                                }
+                                            }
+                                        } );
+                 } );
+}
\ No newline at end of file
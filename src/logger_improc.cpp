@@ -0,0 +1,36 @@
+#include <improc/corecv/logger_improc.hpp>
+
+#include <atomic>
+
+namespace
+{
+    std::atomic<uint64_t> reload_generation {0};
+}
+
+/**
+ * @brief Obtain image processing logger for the calling thread
+ *
+ * The logger is obtained from the singleton once for each thread and for each reload, so that
+ * logging calls do not copy shared pointers to the singleton and to the logger.
+ */
+spdlog::logger* improc::ImageProcLogger::GetThreadLogger()
+{
+    thread_local std::shared_ptr<spdlog::logger> thread_logger     = nullptr;
+    thread_local uint64_t                        thread_generation = 0;
+    const uint64_t kReloadGeneration = reload_generation.load(std::memory_order_acquire);
+    if (thread_logger == nullptr || thread_generation != kReloadGeneration)
+    {
+        thread_logger     = improc::ImageProcLogger::get()->data();
+        thread_generation = kReloadGeneration;
+    }
+    return thread_logger.get();
+}
+
+/**
+ * @brief Make threads obtain the image processing logger again on their next logging call.
+ * Should be called after the logger of the singleton is replaced.
+ */
+void improc::ImageProcLogger::ReloadThreadLoggers()
+{
+    reload_generation.fetch_add(1,std::memory_order_release);
+}
\ No newline at end of file
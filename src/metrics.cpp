@@ -0,0 +1,392 @@
+#include <improc/corecv/metrics.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+/**
+ * @brief Counters of an operation in a shard. Counters are written by the shard thread and zeroed by resets,
+ * so that they are updated with relaxed read-modify-write operations. These stay in the cache of the shard thread.
+ */
+struct improc::Metrics::OperationCounters
+{
+    std::atomic<uint64_t>                                               calls       {0};
+    std::atomic<uint64_t>                                               bytes_in    {0};
+    std::atomic<uint64_t>                                               bytes_out   {0};
+    std::atomic<uint64_t>                                               pixels      {0};
+    std::atomic<uint64_t>                                               total_ns    {0};
+    std::atomic<uint64_t>                                               max_ns      {0};
+    std::array<std::atomic<uint64_t>,improc::Metrics::kNumberLatencyBuckets> buckets {};
+};
+
+/**
+ * @brief Counters of the operations recorded by a thread. Operation counters are allocated on first record.
+ */
+struct improc::Metrics::Shard
+{
+    std::array<std::atomic<improc::Metrics::OperationCounters*>,improc::Metrics::kMaxOperations> operations {};
+
+    ~Shard()
+    {
+        for (std::atomic<improc::Metrics::OperationCounters*>& operation : this->operations)
+        {
+            delete operation.load(std::memory_order_relaxed);
+        }
+    }
+
+    improc::Metrics::OperationCounters& GetOperation(size_t operation_id)
+    {
+        improc::Metrics::OperationCounters* counters = this->operations[operation_id].load(std::memory_order_relaxed);
+        if (counters == nullptr)
+        {
+            counters = new improc::Metrics::OperationCounters();
+            this->operations[operation_id].store(counters,std::memory_order_release);
+        }
+        return *counters;
+    }
+};
+
+/**
+ * @brief Owner of the thread shard. Shard counters are merged into the retired shard when the thread exits.
+ */
+struct improc::Metrics::ShardHandle
+{
+    improc::Metrics::Shard* shard = nullptr;
+
+    ~ShardHandle()
+    {
+        if (this->shard != nullptr)
+        {
+            improc::Metrics::get().RetireShard(this->shard);
+        }
+    }
+};
+
+namespace
+{
+    void Add(std::atomic<uint64_t>& counter, uint64_t value)
+    {
+        counter.fetch_add(value,std::memory_order_relaxed);
+    }
+
+    void Max(std::atomic<uint64_t>& counter, uint64_t value)
+    {
+        uint64_t current_value = counter.load(std::memory_order_relaxed);
+        while (value > current_value && counter.compare_exchange_weak(current_value,value,std::memory_order_relaxed) == false) {}
+    }
+
+    /**
+     * @brief Latency at quantile of the histogram. Latency is the upper bound of the bucket, limited by the maximum latency.
+     */
+    std::chrono::nanoseconds GetQuantile( const std::array<uint64_t,improc::Metrics::kNumberLatencyBuckets>& buckets
+                                        , uint64_t calls, uint64_t max_ns, double quantile )
+    {
+        if (calls == 0)
+        {
+            return std::chrono::nanoseconds(0);
+        }
+        const uint64_t kRank = std::max<uint64_t>(1,static_cast<uint64_t>(std::ceil(quantile * calls)));
+        uint64_t accumulated_calls = 0;
+        for (size_t bucket = 0; bucket < improc::Metrics::kNumberLatencyBuckets; ++bucket)
+        {
+            accumulated_calls += buckets[bucket];
+            if (accumulated_calls >= kRank)
+            {
+                return std::chrono::nanoseconds(std::min(improc::Metrics::GetLatencyBucketUpperBound(bucket),max_ns));
+            }
+        }
+        return std::chrono::nanoseconds(max_ns);
+    }
+}
+
+/**
+ * @brief Construct a new improc::Metrics object
+ */
+improc::Metrics::Metrics() : retired_shard_(new improc::Metrics::Shard()) {}
+
+/**
+ * @brief Obtain metrics of the library. Metrics are never destroyed, so that threads
+ * can merge their shards at exit regardless of the destruction order of static objects.
+ */
+improc::Metrics& improc::Metrics::get()
+{
+    static improc::Metrics* metrics = new improc::Metrics();
+    return *metrics;
+}
+
+/**
+ * @brief Obtain shard of calling thread
+ */
+improc::Metrics::Shard& improc::Metrics::GetThreadShard()
+{
+    static thread_local improc::Metrics::ShardHandle shard_handle {};
+    if (shard_handle.shard == nullptr)
+    {
+        shard_handle.shard = new improc::Metrics::Shard();
+        std::lock_guard<std::mutex> lock {this->mutex_};
+        this->shards_.push_back(shard_handle.shard);
+    }
+    return *shard_handle.shard;
+}
+
+/**
+ * @brief Merge shard of exiting thread into the retired shard and release it
+ */
+void improc::Metrics::RetireShard(improc::Metrics::Shard* shard)
+{
+    std::lock_guard<std::mutex> lock {this->mutex_};
+    for (size_t operation_id = 0; operation_id < improc::Metrics::kMaxOperations; ++operation_id)
+    {
+        const improc::Metrics::OperationCounters* kCounters = shard->operations[operation_id].load(std::memory_order_acquire);
+        if (kCounters == nullptr)
+        {
+            continue;
+        }
+        improc::Metrics::OperationCounters& retired = this->retired_shard_->GetOperation(operation_id);
+        Add(retired.calls    ,kCounters->calls.load(std::memory_order_relaxed));
+        Add(retired.bytes_in ,kCounters->bytes_in.load(std::memory_order_relaxed));
+        Add(retired.bytes_out,kCounters->bytes_out.load(std::memory_order_relaxed));
+        Add(retired.pixels   ,kCounters->pixels.load(std::memory_order_relaxed));
+        Add(retired.total_ns ,kCounters->total_ns.load(std::memory_order_relaxed));
+        Max(retired.max_ns   ,kCounters->max_ns.load(std::memory_order_relaxed));
+        for (size_t bucket = 0; bucket < improc::Metrics::kNumberLatencyBuckets; ++bucket)
+        {
+            Add(retired.buckets[bucket],kCounters->buckets[bucket].load(std::memory_order_relaxed));
+        }
+    }
+    this->shards_.erase(std::remove(this->shards_.begin(),this->shards_.end(),shard),this->shards_.end());
+    delete shard;
+}
+
+/**
+ * @brief Register operation and obtain its identifier. Registering an existing operation returns its identifier.
+ *
+ * @param operation_name - operation name
+ */
+size_t improc::Metrics::RegisterOperation(const std::string& operation_name)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Registering operation {} for metrics...",operation_name);
+    std::lock_guard<std::mutex> lock {this->mutex_};
+    std::vector<std::string>::const_iterator operation_iter = std::find(this->operation_names_.begin(),this->operation_names_.end(),operation_name);
+    if (operation_iter != this->operation_names_.end())
+    {
+        return static_cast<size_t>(operation_iter - this->operation_names_.begin());
+    }
+    if (this->operation_names_.size() >= improc::Metrics::kMaxOperations)
+    {
+        std::string error_message = fmt::format("Cannot register operation {}. Maximum number of operations is {}.",operation_name,improc::Metrics::kMaxOperations);
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    this->operation_names_.push_back(operation_name);
+    return this->operation_names_.size() - 1;
+}
+
+/**
+ * @brief Record call of operation in the shard of the calling thread
+ *
+ * @param operation_id - operation identifier obtained from registration
+ * @param latency - operation latency
+ * @param bytes_in - bytes read by the operation
+ * @param bytes_out - bytes written by the operation
+ * @param pixels - pixels processed by the operation
+ */
+void improc::Metrics::Record( size_t operation_id, std::chrono::nanoseconds latency
+                            , uint64_t bytes_in, uint64_t bytes_out, uint64_t pixels )
+{
+    if (operation_id >= improc::Metrics::kMaxOperations)
+    {
+        std::string error_message = fmt::format("Invalid operation identifier {}.",operation_id);
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    const uint64_t kLatency = static_cast<uint64_t>(std::max<std::chrono::nanoseconds::rep>(0,latency.count()));
+    improc::Metrics::OperationCounters& counters = this->GetThreadShard().GetOperation(operation_id);
+    Add(counters.calls    ,1);
+    Add(counters.bytes_in ,bytes_in);
+    Add(counters.bytes_out,bytes_out);
+    Add(counters.pixels   ,pixels);
+    Add(counters.total_ns ,kLatency);
+    Add(counters.buckets[improc::Metrics::GetLatencyBucket(kLatency)],1);
+    Max(counters.max_ns   ,kLatency);
+}
+
+/**
+ * @brief Obtain counters of registered operations merged from all threads.
+ * Records done concurrently with the snapshot may be partially included.
+ */
+std::vector<improc::Metrics::OperationSnapshot> improc::Metrics::GetSnapshot() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining metrics snapshot...");
+    std::lock_guard<std::mutex> lock {this->mutex_};
+    std::vector<const improc::Metrics::Shard*> shards (this->shards_.begin(),this->shards_.end());
+    shards.push_back(this->retired_shard_);
+
+    std::vector<improc::Metrics::OperationSnapshot> snapshot {};
+    snapshot.reserve(this->operation_names_.size());
+    for (size_t operation_id = 0; operation_id < this->operation_names_.size(); ++operation_id)
+    {
+        improc::Metrics::OperationSnapshot operation {this->operation_names_[operation_id],0,0,0,0,{},{},{},{}};
+        uint64_t total_ns = 0;
+        uint64_t max_ns   = 0;
+        std::array<uint64_t,improc::Metrics::kNumberLatencyBuckets> buckets {};
+        for (const improc::Metrics::Shard* shard : shards)
+        {
+            const improc::Metrics::OperationCounters* kCounters = shard->operations[operation_id].load(std::memory_order_acquire);
+            if (kCounters == nullptr)
+            {
+                continue;
+            }
+            operation.calls     += kCounters->calls.load(std::memory_order_relaxed);
+            operation.bytes_in  += kCounters->bytes_in.load(std::memory_order_relaxed);
+            operation.bytes_out += kCounters->bytes_out.load(std::memory_order_relaxed);
+            operation.pixels    += kCounters->pixels.load(std::memory_order_relaxed);
+            total_ns            += kCounters->total_ns.load(std::memory_order_relaxed);
+            max_ns               = std::max(max_ns,kCounters->max_ns.load(std::memory_order_relaxed));
+            for (size_t bucket = 0; bucket < improc::Metrics::kNumberLatencyBuckets; ++bucket)
+            {
+                buckets[bucket] += kCounters->buckets[bucket].load(std::memory_order_relaxed);
+            }
+        }
+        operation.total_latency = std::chrono::nanoseconds(total_ns);
+        operation.p50_latency   = GetQuantile(buckets,operation.calls,max_ns,0.50);
+        operation.p99_latency   = GetQuantile(buckets,operation.calls,max_ns,0.99);
+        operation.max_latency   = std::chrono::nanoseconds(max_ns);
+        snapshot.push_back(std::move(operation));
+    }
+    return snapshot;
+}
+
+/**
+ * @brief Obtain snapshot of registered operations as json object indexed by operation name. Latencies are in nanoseconds.
+ */
+Json::Value improc::Metrics::ToJson() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining metrics json...");
+    Json::Value metrics_json {Json::objectValue};
+    for (const improc::Metrics::OperationSnapshot& operation : this->GetSnapshot())
+    {
+        Json::Value operation_json {Json::objectValue};
+        operation_json["calls"]          = Json::UInt64(operation.calls);
+        operation_json["bytes_in"]       = Json::UInt64(operation.bytes_in);
+        operation_json["bytes_out"]      = Json::UInt64(operation.bytes_out);
+        operation_json["pixels"]         = Json::UInt64(operation.pixels);
+        operation_json["total_latency"]  = Json::UInt64(operation.total_latency.count());
+        operation_json["p50_latency"]    = Json::UInt64(operation.p50_latency.count());
+        operation_json["p99_latency"]    = Json::UInt64(operation.p99_latency.count());
+        operation_json["max_latency"]    = Json::UInt64(operation.max_latency.count());
+        metrics_json[operation.name]     = std::move(operation_json);
+    }
+    return metrics_json;
+}
+
+/**
+ * @brief Reset counters of all operations. Registered operations are kept.
+ * Counters are exchanged with zero, so that records done concurrently with the reset are either
+ * discarded or kept, although a record may be kept for some counters and discarded for others.
+ */
+void improc::Metrics::Reset()
+{
+    IMPROC_CORECV_LOGGER_TRACE("Resetting metrics...");
+    std::lock_guard<std::mutex> lock {this->mutex_};
+    std::vector<improc::Metrics::Shard*> shards (this->shards_.begin(),this->shards_.end());
+    shards.push_back(this->retired_shard_);
+    for (improc::Metrics::Shard* shard : shards)
+    {
+        for (std::atomic<improc::Metrics::OperationCounters*>& operation : shard->operations)
+        {
+            improc::Metrics::OperationCounters* counters = operation.load(std::memory_order_acquire);
+            if (counters == nullptr)
+            {
+                continue;
+            }
+            counters->calls.exchange(0,std::memory_order_relaxed);
+            counters->bytes_in.exchange(0,std::memory_order_relaxed);
+            counters->bytes_out.exchange(0,std::memory_order_relaxed);
+            counters->pixels.exchange(0,std::memory_order_relaxed);
+            counters->total_ns.exchange(0,std::memory_order_relaxed);
+            counters->max_ns.exchange(0,std::memory_order_relaxed);
+            for (std::atomic<uint64_t>& bucket : counters->buckets)
+            {
+                bucket.exchange(0,std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Obtain histogram bucket of latency. Latencies below 16 ns have their own bucket and
+ * each power of two above is split in 8 buckets, so that the relative bucket width is below 12.5%.
+ *
+ * @param latency_ns - latency in nanoseconds
+ */
+size_t improc::Metrics::GetLatencyBucket(uint64_t latency_ns)
+{
+    if (latency_ns < improc::Metrics::kNumberExactBuckets)
+    {
+        return static_cast<size_t>(latency_ns);
+    }
+    int most_significant_bit = 63;
+    while ((latency_ns >> most_significant_bit) == 0)
+    {
+        --most_significant_bit;
+    }
+    const size_t kSubBucket = static_cast<size_t>((latency_ns >> (most_significant_bit - 3)) & (improc::Metrics::kNumberSubBuckets - 1));
+    return improc::Metrics::kNumberExactBuckets + (most_significant_bit - 4) * improc::Metrics::kNumberSubBuckets + kSubBucket;
+}
+
+/**
+ * @brief Obtain largest latency in nanoseconds of histogram bucket
+ *
+ * @param bucket - histogram bucket
+ */
+uint64_t improc::Metrics::GetLatencyBucketUpperBound(size_t bucket)
+{
+    if (bucket < improc::Metrics::kNumberExactBuckets)
+    {
+        return static_cast<uint64_t>(bucket);
+    }
+    const size_t   kMostSignificantBit = (bucket - improc::Metrics::kNumberExactBuckets) / improc::Metrics::kNumberSubBuckets + 4;
+    const uint64_t kSubBucket          = (bucket - improc::Metrics::kNumberExactBuckets) % improc::Metrics::kNumberSubBuckets;
+    const uint64_t kBucketWidth        = uint64_t(1) << (kMostSignificantBit - 3);
+    return (improc::Metrics::kNumberSubBuckets + kSubBucket) * kBucketWidth + (kBucketWidth - 1);
+}
+
+/**
+ * @brief Construct a new improc::Metrics::ScopedRecord object and start measuring latency
+ *
+ * @param operation_id - operation identifier obtained from registration
+ */
+improc::Metrics::ScopedRecord::ScopedRecord(size_t operation_id) : operation_id_(operation_id)
+                                                                 , start_(std::chrono::steady_clock::now())
+                                                                 , bytes_in_(0)
+                                                                 , bytes_out_(0)
+                                                                 , pixels_(0) {}
+
+/**
+ * @brief Destroy the improc::Metrics::ScopedRecord object and record the operation call.
+ * Errors while recording are discarded, so that metrics never fail the recorded operation.
+ */
+improc::Metrics::ScopedRecord::~ScopedRecord() noexcept
+{
+    try
+    {
+        const std::chrono::nanoseconds kLatency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - this->start_);
+        improc::Metrics::get().Record(this->operation_id_,kLatency,this->bytes_in_,this->bytes_out_,this->pixels_);
+    }
+    catch (...) {}
+}
+
+/**
+ * @brief Set images processed by the operation
+ *
+ * @param input - image read by the operation
+ * @param output - image written by the operation
+ */
+void improc::Metrics::ScopedRecord::SetImages(const cv::Mat& input, const cv::Mat& output)
+{
+    this->bytes_in_  = static_cast<uint64_t>(input.total()  * input.elemSize());
+    this->bytes_out_ = static_cast<uint64_t>(output.total() * output.elemSize());
+    this->pixels_    = static_cast<uint64_t>(input.total());
+}
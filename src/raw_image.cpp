@@ -0,0 +1,392 @@
+#include <improc/corecv/raw_image.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <memory>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    static constexpr size_t kMagicOffset        = 0;
+    static constexpr size_t kVersionOffset      = 8;
+    static constexpr size_t kRowsOffset         = 12;
+    static constexpr size_t kColsOffset         = 16;
+    static constexpr size_t kTypeOffset         = 20;
+    static constexpr size_t kColorSpaceOffset   = 24;
+    static constexpr size_t kRowStepOffset      = 32;
+    static constexpr size_t kDataOffsetOffset   = 40;
+    static constexpr int32_t kNoColorSpace      = -1;
+    static constexpr size_t kStagingSize        = 1 << 20;
+
+    template <typename DataType>
+    void WriteLittleEndian(uchar* data, DataType value)
+    {
+        const uint64_t kValue = static_cast<uint64_t>(value);
+        for (size_t byte_idx = 0; byte_idx < sizeof(DataType); ++byte_idx)
+        {
+            data[byte_idx] = static_cast<uchar>(kValue >> (8 * byte_idx));
+        }
+    }
+
+    template <typename DataType>
+    DataType ReadLittleEndian(const uchar* data)
+    {
+        uint64_t value = 0;
+        for (size_t byte_idx = 0; byte_idx < sizeof(DataType); ++byte_idx)
+        {
+            value |= static_cast<uint64_t>(data[byte_idx]) << (8 * byte_idx);
+        }
+        return static_cast<DataType>(value);
+    }
+
+    struct MappedFile
+    {
+        uchar*  data;
+        size_t  size;
+    };
+
+    /**
+     * @brief Map file with private copy-on-write pages
+     */
+    MappedFile MapFile(const std::string& filepath)
+    {
+        MappedFile mapped_file {nullptr,0};
+        #ifdef _WIN32
+        HANDLE file = CreateFileA(filepath.c_str(),GENERIC_READ,FILE_SHARE_READ,nullptr,OPEN_EXISTING,FILE_ATTRIBUTE_NORMAL,nullptr);
+        if (file != INVALID_HANDLE_VALUE)
+        {
+            LARGE_INTEGER file_size {};
+            if (GetFileSizeEx(file,&file_size) != 0 && file_size.QuadPart >= static_cast<LONGLONG>(improc::RawImage::kHeaderSize))
+            {
+                HANDLE mapping = CreateFileMappingA(file,nullptr,PAGE_WRITECOPY,0,0,nullptr);
+                if (mapping != nullptr)
+                {
+                    mapped_file.data = static_cast<uchar*>(MapViewOfFile(mapping,FILE_MAP_COPY,0,0,0));
+                    mapped_file.size = mapped_file.data != nullptr ? static_cast<size_t>(file_size.QuadPart) : 0;
+                    CloseHandle(mapping);
+                }
+            }
+            CloseHandle(file);
+        }
+        #else
+        const int kFile = open(filepath.c_str(),O_RDONLY);
+        if (kFile >= 0)
+        {
+            struct stat file_status {};
+            if (fstat(kFile,&file_status) == 0 && static_cast<size_t>(file_status.st_size) >= improc::RawImage::kHeaderSize)
+            {
+                void* data = mmap(nullptr,static_cast<size_t>(file_status.st_size),PROT_READ | PROT_WRITE,MAP_PRIVATE,kFile,0);
+                if (data != MAP_FAILED)
+                {
+                    mapped_file.data = static_cast<uchar*>(data);
+                    mapped_file.size = static_cast<size_t>(file_status.st_size);
+                }
+            }
+            close(kFile);
+        }
+        #endif
+
+        if (mapped_file.data == nullptr)
+        {
+            std::string error_message = fmt::format("Cannot map raw image file {}.",filepath);
+            IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+            throw improc::file_processing_error(std::move(error_message));
+        }
+        return mapped_file;
+    }
+
+    void UnmapFile(uchar* data, size_t size)
+    {
+        #ifdef _WIN32
+        UnmapViewOfFile(data);
+        #else
+        munmap(data,size);
+        #endif
+    }
+
+    /**
+     * @brief Allocator of image data backed by a file mapping. The mapping is released with the image data.
+     */
+    class MappedFileAllocator final : public cv::MatAllocator
+    {
+        public:
+            cv::UMatData* allocate( int dims, const int* sizes, int type, void* data, size_t* step
+                                  , cv::AccessFlag flags, cv::UMatUsageFlags usage_flags ) const override
+            {
+                return cv::Mat::getStdAllocator()->allocate(dims,sizes,type,data,step,flags,usage_flags);
+            }
+
+            bool allocate(cv::UMatData* data, cv::AccessFlag, cv::UMatUsageFlags) const override
+            {
+                return data != nullptr;
+            }
+
+            void deallocate(cv::UMatData* data) const override
+            {
+                if (data == nullptr)
+                {
+                    return;
+                }
+                UnmapFile(data->origdata,data->size);
+                delete data;
+            }
+    };
+
+    const MappedFileAllocator& GetMappedFileAllocator()
+    {
+        // Allocator is never destroyed, since images released during static destruction still release their mapping with it.
+        static const MappedFileAllocator* allocator = new MappedFileAllocator();
+        return *allocator;
+    }
+
+    void ThrowInvalidHeader(const std::string& reason)
+    {
+        std::string error_message = fmt::format("Invalid raw image header. {}",reason);
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    void Write(const std::string& filepath, const cv::Mat& image_data, const std::optional<improc::ColorSpace>& color_space)
+    {
+        IMPROC_CORECV_LOGGER_TRACE("Writing raw image {}...",filepath);
+        if (image_data.empty() == true || image_data.dims != 2)
+        {
+            std::string error_message = "Invalid image data for raw image. Image data should be a non-empty two-dimensional image.";
+            IMPROC_CORECV_LOGGER_ERROR("ERROR_03: " + error_message);
+            throw improc::value_error(std::move(error_message));
+        }
+
+        const size_t kRowSize = image_data.cols * image_data.elemSize();
+        const size_t kRowStep = cv::alignSize(kRowSize,static_cast<int>(improc::RawImage::kRowAlignment));
+        std::ofstream raw_file {filepath,std::ios::binary | std::ios::trunc};
+        if (raw_file.is_open() == false)
+        {
+            std::string error_message = fmt::format("Cannot open raw image file {} for writing.",filepath);
+            IMPROC_CORECV_LOGGER_ERROR("ERROR_04: " + error_message);
+            throw improc::file_processing_error(std::move(error_message));
+        }
+
+        // Rows are copied to an aligned staging buffer with their padding and written in large blocks
+        const size_t kNumberStagingRows = std::max<size_t>(1,kStagingSize / kRowStep);
+        const size_t kStagingBytes      = std::max(improc::RawImage::kDataAlignment,kNumberStagingRows * kRowStep);
+        std::unique_ptr<uchar,void(*)(void*)> staging_buffer { static_cast<uchar*>(cv::fastMalloc(kStagingBytes)),cv::fastFree };
+
+        uchar* header = staging_buffer.get();
+        std::memset(header,0,improc::RawImage::kDataAlignment);
+        std::memcpy(header + kMagicOffset,improc::RawImage::kMagic,sizeof(improc::RawImage::kMagic));
+        WriteLittleEndian<uint32_t>(header + kVersionOffset   ,improc::RawImage::kVersion);
+        WriteLittleEndian<int32_t> (header + kRowsOffset      ,image_data.rows);
+        WriteLittleEndian<int32_t> (header + kColsOffset      ,image_data.cols);
+        WriteLittleEndian<int32_t> (header + kTypeOffset      ,image_data.type());
+        WriteLittleEndian<int32_t> (header + kColorSpaceOffset,color_space.has_value() == true ? static_cast<int32_t>(color_space.value()) : kNoColorSpace);
+        WriteLittleEndian<uint64_t>(header + kRowStepOffset   ,kRowStep);
+        WriteLittleEndian<uint64_t>(header + kDataOffsetOffset,improc::RawImage::kDataAlignment);
+        raw_file.write(reinterpret_cast<const char*>(header),static_cast<std::streamsize>(improc::RawImage::kDataAlignment));
+
+        for (int row_start = 0; row_start < image_data.rows; row_start += static_cast<int>(kNumberStagingRows))
+        {
+            const int kRowEnd = std::min(image_data.rows,row_start + static_cast<int>(kNumberStagingRows));
+            uchar* staging_row = staging_buffer.get();
+            for (int row = row_start; row < kRowEnd; ++row, staging_row += kRowStep)
+            {
+                std::memcpy(staging_row,image_data.ptr<uchar>(row),kRowSize);
+                std::memset(staging_row + kRowSize,0,kRowStep - kRowSize);
+            }
+            raw_file.write(reinterpret_cast<const char*>(staging_buffer.get()),static_cast<std::streamsize>((kRowEnd - row_start) * kRowStep));
+        }
+
+        raw_file.flush();
+        if (raw_file.good() == false)
+        {
+            std::string error_message = fmt::format("Cannot write raw image file {}.",filepath);
+            IMPROC_CORECV_LOGGER_ERROR("ERROR_05: " + error_message);
+            throw improc::file_processing_error(std::move(error_message));
+        }
+    }
+}
+
+/**
+ * @brief Check if data starts with a raw image header
+ *
+ * @param data - file data
+ * @param size - number of bytes of file data
+ */
+bool improc::RawImage::IsRawImage(const uchar* data, size_t size)
+{
+    return data != nullptr && size >= improc::RawImage::kHeaderSize
+        && std::memcmp(data + kMagicOffset,improc::RawImage::kMagic,sizeof(improc::RawImage::kMagic)) == 0;
+}
+
+/**
+ * @brief Read raw image header
+ *
+ * @param data - file data starting at the header
+ * @param size - number of bytes of file data
+ */
+improc::RawImage::Header improc::RawImage::ReadHeader(const uchar* data, size_t size)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Reading raw image header...");
+    if (improc::RawImage::IsRawImage(data,size) == false)
+    {
+        ThrowInvalidHeader("File is not a raw image.");
+    }
+    if (ReadLittleEndian<uint32_t>(data + kVersionOffset) != improc::RawImage::kVersion)
+    {
+        ThrowInvalidHeader(fmt::format("Version {} not supported.",ReadLittleEndian<uint32_t>(data + kVersionOffset)));
+    }
+
+    improc::RawImage::Header header {};
+    header.image_size  = cv::Size(ReadLittleEndian<int32_t>(data + kColsOffset),ReadLittleEndian<int32_t>(data + kRowsOffset));
+    header.type        = ReadLittleEndian<int32_t>(data + kTypeOffset);
+    header.row_step    = static_cast<size_t>(ReadLittleEndian<uint64_t>(data + kRowStepOffset));
+    header.data_offset = static_cast<size_t>(ReadLittleEndian<uint64_t>(data + kDataOffsetOffset));
+    if ( header.image_size.width <= 0 || header.image_size.height <= 0 || header.type < 0 || header.type >= CV_MAKETYPE(CV_DEPTH_MAX,CV_CN_MAX)
+      || header.row_step < static_cast<size_t>(header.image_size.width) * CV_ELEM_SIZE(header.type)
+      || header.row_step % CV_ELEM_SIZE1(header.type) != 0 || header.data_offset < improc::RawImage::kHeaderSize )
+    {
+        ThrowInvalidHeader(fmt::format("Image size {}x{}, type {} or layout not valid.",header.image_size.width,header.image_size.height,header.type));
+    }
+
+    const int32_t kColorSpace = ReadLittleEndian<int32_t>(data + kColorSpaceOffset);
+    if (kColorSpace != kNoColorSpace)
+    {
+        header.color_space = improc::ColorSpace::TryFromValue(static_cast<std::underlying_type_t<improc::ColorSpace::Value>>(kColorSpace));
+        if (header.color_space.has_value() == false)
+        {
+            ThrowInvalidHeader(fmt::format("Color space {} not valid.",kColorSpace));
+        }
+        if (header.color_space.value().GetNumberChannels() != static_cast<unsigned int>(CV_MAT_CN(header.type)))
+        {
+            ThrowInvalidHeader(fmt::format("Color space {} does not match image type {}.",header.color_space.value().ToString(),header.type));
+        }
+    }
+    return header;
+}
+
+/**
+ * @brief Read raw image header from file
+ *
+ * @param filepath - raw image filepath
+ */
+improc::RawImage::Header improc::RawImage::ReadHeader(const std::string& filepath)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Reading raw image header from {}...",filepath);
+    std::ifstream raw_file {filepath,std::ios::binary};
+    uchar header[improc::RawImage::kHeaderSize] {};
+    if (raw_file.read(reinterpret_cast<char*>(header),sizeof(header)).good() == false)
+    {
+        std::string error_message = fmt::format("Cannot read raw image header from file {}.",filepath);
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_06: " + error_message);
+        throw improc::file_processing_error(std::move(error_message));
+    }
+    return improc::RawImage::ReadHeader(header,sizeof(header));
+}
+
+/**
+ * @brief Map raw image file and wrap its rows without copying them
+ *
+ * @param filepath - raw image filepath
+ */
+cv::Mat improc::RawImage::ReadData(const std::string& filepath)
+{
+    improc::RawImage::Header header {};
+    return improc::RawImage::ReadData(filepath,header);
+}
+
+/**
+ * @brief Map raw image file and wrap its rows without copying them
+ *
+ * @param filepath - raw image filepath
+ * @param header - destination for the raw image header read from the mapping
+ */
+cv::Mat improc::RawImage::ReadData(const std::string& filepath, improc::RawImage::Header& header)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Reading raw image data from {}...",filepath);
+    const MappedFile kMappedFile = MapFile(filepath);
+    try
+    {
+        header = improc::RawImage::ReadHeader(kMappedFile.data,kMappedFile.size);
+        // Terms are compared with the file size before multiplying, so that crafted headers cannot overflow the check
+        if ( header.data_offset > kMappedFile.size
+          || header.row_step > (kMappedFile.size - header.data_offset) / static_cast<size_t>(header.image_size.height) )
+        {
+            ThrowInvalidHeader(fmt::format("File {} is truncated.",filepath));
+        }
+
+        // Mapping is owned by the image data only once the allocator data is attached, which cannot throw
+        cv::Mat image_data {header.image_size,header.type,kMappedFile.data + header.data_offset,header.row_step};
+        cv::UMatData* mat_data = new cv::UMatData(&GetMappedFileAllocator());
+        mat_data->origdata = kMappedFile.data;
+        mat_data->data     = image_data.data;
+        mat_data->size     = kMappedFile.size;
+        mat_data->refcount = 1;
+        image_data.u = mat_data;
+        return image_data;
+    }
+    catch (...)
+    {
+        UnmapFile(kMappedFile.data,kMappedFile.size);
+        throw;
+    }
+}
+
+/**
+ * @brief Map raw image file into an image without copying its rows
+ *
+ * @param filepath - raw image filepath
+ */
+improc::Image improc::RawImage::Read(const std::string& filepath)
+{
+    return improc::Image(improc::RawImage::ReadData(filepath));
+}
+
+/**
+ * @brief Map raw image file into a color space image without copying its rows
+ *
+ * @param filepath - raw image filepath. Header should have a color space.
+ */
+improc::ColorSpaceImage improc::RawImage::ReadColorSpaceImage(const std::string& filepath)
+{
+    improc::RawImage::Header header {};
+    cv::Mat image_data = improc::RawImage::ReadData(filepath,header);
+    if (header.color_space.has_value() == false)
+    {
+        std::string error_message = fmt::format("Raw image file {} does not have a color space.",filepath);
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_07: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    return improc::ColorSpaceImage(std::move(image_data),header.color_space.value());
+}
+
+/**
+ * @brief Write image data as raw image file
+ *
+ * @param filepath - raw image filepath
+ * @param image_data - image data
+ */
+void improc::RawImage::Write(const std::string& filepath, const cv::Mat& image_data)
+{
+    ::Write(filepath,image_data,std::nullopt);
+}
+
+/**
+ * @brief Write color space image as raw image file
+ *
+ * @param filepath - raw image filepath
+ * @param image - color space image
+ */
+void improc::RawImage::Write(const std::string& filepath, const improc::ColorSpaceImage& image)
+{
+    ::Write(filepath,image.get_data(),image.get_color_space());
+}
\ No newline at end of file
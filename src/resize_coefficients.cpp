@@ -0,0 +1,425 @@
+#include <improc/corecv/structures/resize_coefficients.hpp>
+#include <improc/corecv/image_allocator.hpp>
+
+#include <algorithm>
+
+namespace
+{
+    /**
+     * @brief Compute source index and fixed-point weights of the two neighbors for each target index
+     */
+    void ComputeLinearCoefficients( int from_size, int to_size
+                                  , std::vector<int>& offsets, std::vector<short>& coefficients )
+    {
+        const double kScale = 1.0 / (static_cast<double>(to_size) / from_size);
+        offsets.resize(to_size);
+        coefficients.resize(2 * to_size);
+        for (int to_idx = 0; to_idx < to_size; ++to_idx)
+        {
+            float position = static_cast<float>((to_idx + 0.5) * kScale - 0.5);
+            int   from_idx = cvFloor(position);
+            position -= from_idx;
+            if (from_idx < 0)
+            {
+                position = 0.0f;
+                from_idx = 0;
+            }
+            if (from_idx >= from_size - 1)
+            {
+                position = 0.0f;
+                from_idx = from_size - 1;
+            }
+            offsets[to_idx]              = from_idx;
+            coefficients[2 * to_idx]     = cv::saturate_cast<short>((1.0f - position) * improc::ResizeCoefficients::kCoefficientScale);
+            coefficients[2 * to_idx + 1] = cv::saturate_cast<short>(position * improc::ResizeCoefficients::kCoefficientScale);
+        }
+    }
+
+    /**
+     * @brief Compute nearest source index for each target index
+     */
+    void ComputeNearestOffsets(int from_size, int to_size, std::vector<int>& offsets)
+    {
+        const double kScale = 1.0 / (static_cast<double>(to_size) / from_size);
+        offsets.resize(to_size);
+        for (int to_idx = 0; to_idx < to_size; ++to_idx)
+        {
+            offsets[to_idx] = std::min(cvFloor(to_idx * kScale),from_size - 1);
+        }
+    }
+
+    /**
+     * @brief Source indices and weights of consecutive target indices. Source indices are moved by the first
+     * source index of the image region, so that regions use the coefficients of the whole image without copies.
+     */
+    struct AxisCoefficients
+    {
+        const int*                  offsets;
+        const short*                coefficients;
+        int                         size;
+        int                         from_start;
+
+        int GetOffset(int to_idx) const
+        {
+            return this->offsets[to_idx] - this->from_start;
+        }
+    };
+
+    template <int kChannels>
+    void ResizeNearestRow(const uchar* image_row, uchar* resized_row, const AxisCoefficients& x_axis)
+    {
+        for (int to_col = 0; to_col < x_axis.size; ++to_col)
+        {
+            const uchar* image_pixel = image_row + x_axis.GetOffset(to_col) * kChannels;
+            for (int channel = 0; channel < kChannels; ++channel)
+            {
+                resized_row[to_col * kChannels + channel] = image_pixel[channel];
+            }
+        }
+    }
+
+    /**
+     * @brief Interpolate source row horizontally. Weighted row is scaled by kCoefficientScale.
+     */
+    template <int kChannels>
+    void ResizeLinearRow(const uchar* image_row, int* weighted_row, int from_cols, const AxisCoefficients& x_axis)
+    {
+        for (int to_col = 0; to_col < x_axis.size; ++to_col)
+        {
+            const int    kFromCol         = x_axis.GetOffset(to_col);
+            const uchar* image_pixel      = image_row + kFromCol * kChannels;
+            const uchar* image_next_pixel = image_row + std::min(kFromCol + 1,from_cols - 1) * kChannels;
+            const int kAlpha0 = x_axis.coefficients[2 * to_col];
+            const int kAlpha1 = x_axis.coefficients[2 * to_col + 1];
+            for (int channel = 0; channel < kChannels; ++channel)
+            {
+                weighted_row[to_col * kChannels + channel] = image_pixel[channel] * kAlpha0 + image_next_pixel[channel] * kAlpha1;
+            }
+        }
+    }
+
+    /**
+     * @brief Obtain horizontally interpolated rows of the calling thread with at least the number of elements.
+     * Rows only grow, so that steady-state resizing does not allocate.
+     */
+    int* GetThreadWeightedRows(size_t number_elements)
+    {
+        thread_local std::vector<int> weighted_rows {};
+        if (weighted_rows.size() < number_elements)
+        {
+            weighted_rows.resize(number_elements);
+        }
+        return weighted_rows.data();
+    }
+
+    template <int kChannels>
+    void ResizeNearest(const cv::Mat& image, cv::Mat& resized_image, const AxisCoefficients& x_axis, const AxisCoefficients& y_axis)
+    {
+        cv::parallel_for_( cv::Range(0,resized_image.rows)
+                         , [&image,&resized_image,&x_axis,&y_axis] (const cv::Range& range) -> void
+                           {
+                               for (int to_row = range.start; to_row < range.end; ++to_row)
+                               {
+                                   ResizeNearestRow<kChannels>(image.ptr<uchar>(y_axis.GetOffset(to_row)),resized_image.ptr<uchar>(to_row),x_axis);
+                               }
+                           } );
+    }
+
+    template <int kChannels>
+    void ResizeLinear(const cv::Mat& image, cv::Mat& resized_image, const AxisCoefficients& x_axis, const AxisCoefficients& y_axis)
+    {
+        static constexpr int kRoundingShift = 2 * improc::ResizeCoefficients::kCoefficientBits;
+        cv::parallel_for_( cv::Range(0,resized_image.rows)
+                         , [&] (const cv::Range& range) -> void
+                           {
+                               // Horizontally interpolated source rows are kept while consecutive target rows use them
+                               const size_t kRowElements = static_cast<size_t>(resized_image.cols) * kChannels;
+                               int* weighted_rows       = GetThreadWeightedRows(2 * kRowElements);
+                               int  weighted_row_idx[2] = {-1,-1};
+                               for (int to_row = range.start; to_row < range.end; ++to_row)
+                               {
+                                   const int kFromRow     = y_axis.GetOffset(to_row);
+                                   const int kFromRows[2] = {kFromRow,std::min(kFromRow + 1,image.rows - 1)};
+                                   int       slots[2]     = {-1,-1};
+                                   for (int neighbor = 0; neighbor < 2; ++neighbor)
+                                   {
+                                       for (int slot = 0; slot < 2; ++slot)
+                                       {
+                                           if (weighted_row_idx[slot] == kFromRows[neighbor])
+                                           {
+                                               slots[neighbor] = slot;
+                                           }
+                                       }
+                                   }
+                                   for (int neighbor = 0; neighbor < 2; ++neighbor)
+                                   {
+                                       if (slots[neighbor] == -1)
+                                       {
+                                           // Overwrite slot that does not hold the other neighbor row
+                                           const int kSlot = slots[1 - neighbor] == -1 ? neighbor : 1 - slots[1 - neighbor];
+                                           weighted_row_idx[kSlot] = kFromRows[neighbor];
+                                           ResizeLinearRow<kChannels>( image.ptr<uchar>(kFromRows[neighbor]),weighted_rows + kSlot * kRowElements
+                                                                     , image.cols,x_axis );
+                                           slots[neighbor] = kSlot;
+                                           if (kFromRows[1 - neighbor] == kFromRows[neighbor])
+                                           {
+                                               slots[1 - neighbor] = kSlot;
+                                           }
+                                       }
+                                   }
+                                   const int* rows[2] = {weighted_rows + slots[0] * kRowElements,weighted_rows + slots[1] * kRowElements};
+
+                                   const int kBeta0 = y_axis.coefficients[2 * to_row];
+                                   const int kBeta1 = y_axis.coefficients[2 * to_row + 1];
+                                   uchar* resized_row = resized_image.ptr<uchar>(to_row);
+                                   for (size_t elem = 0; elem < kRowElements; ++elem)
+                                   {
+                                       resized_row[elem] = cv::saturate_cast<uchar>( (rows[0][elem] * kBeta0 + rows[1][elem] * kBeta1 
+                                                                                     + (1 << (kRoundingShift - 1))) >> kRoundingShift );
+                                   }
+                               }
+                           } );
+    }
+
+    /**
+     * @brief Resize image into destination with the size of the axes, dispatching on the number of channels
+     */
+    void Resize( const cv::Mat& image, cv::Mat& resized_image, const improc::InterpolationType& interpolation
+               , const AxisCoefficients& x_axis, const AxisCoefficients& y_axis )
+    {
+        if (interpolation == improc::InterpolationType::Value::kNearest)
+        {
+            switch (image.channels())
+            {
+                case 1: ResizeNearest<1>(image,resized_image,x_axis,y_axis);   break;
+                case 2: ResizeNearest<2>(image,resized_image,x_axis,y_axis);   break;
+                case 3: ResizeNearest<3>(image,resized_image,x_axis,y_axis);   break;
+                case 4: ResizeNearest<4>(image,resized_image,x_axis,y_axis);   break;
+            }
+        }
+        else
+        {
+            switch (image.channels())
+            {
+                case 1: ResizeLinear<1>(image,resized_image,x_axis,y_axis);    break;
+                case 2: ResizeLinear<2>(image,resized_image,x_axis,y_axis);    break;
+                case 3: ResizeLinear<3>(image,resized_image,x_axis,y_axis);    break;
+                case 4: ResizeLinear<4>(image,resized_image,x_axis,y_axis);    break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Construct a new improc::ResizeCoefficients object
+ */
+improc::ResizeCoefficients::ResizeCoefficients() : from_image_size_(cv::Size())
+                                                 , to_image_size_(cv::Size())
+                                                 , interpolation_(improc::InterpolationType::kLinear)
+                                                 , x_offsets_(std::vector<int>())
+                                                 , x_coefficients_(std::vector<short>())
+                                                 , y_offsets_(std::vector<int>())
+                                                 , y_coefficients_(std::vector<short>()) {}
+
+/**
+ * @brief Construct a new improc::ResizeCoefficients object
+ *
+ * @param from_image_size - source image size
+ * @param to_image_size - target image size
+ * @param interpolation - interpolation type. Only linear and nearest interpolation are supported.
+ */
+improc::ResizeCoefficients::ResizeCoefficients( const cv::Size& from_image_size, const cv::Size& to_image_size
+                                              , const improc::InterpolationType& interpolation ) : ResizeCoefficients()
+{
+    IMPROC_CORECV_LOGGER_TRACE  ( "Computing {} resize coefficients from {}x{} to {}x{}..."
+                                , interpolation.ToString(), from_image_size.width, from_image_size.height
+                                , to_image_size.width, to_image_size.height );
+    if (from_image_size.empty() == true || to_image_size.empty() == true)
+    {
+        std::string error_message = fmt::format ( "Invalid image sizes for resize coefficients. Source size is {}x{} and target size is {}x{}."
+                                                , from_image_size.width, from_image_size.height, to_image_size.width, to_image_size.height );
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    this->from_image_size_ = from_image_size;
+    this->to_image_size_   = to_image_size;
+    this->interpolation_   = interpolation;
+    switch (interpolation)
+    {
+        case improc::InterpolationType::Value::kLinear:
+            ComputeLinearCoefficients(from_image_size.width ,to_image_size.width ,this->x_offsets_,this->x_coefficients_);
+            ComputeLinearCoefficients(from_image_size.height,to_image_size.height,this->y_offsets_,this->y_coefficients_);
+            break;
+        case improc::InterpolationType::Value::kNearest:
+            ComputeNearestOffsets(from_image_size.width ,to_image_size.width ,this->x_offsets_);
+            ComputeNearestOffsets(from_image_size.height,to_image_size.height,this->y_offsets_);
+            break;
+        default:
+            std::string error_message = fmt::format("Resize coefficients not defined for {} interpolation.",interpolation.ToString());
+            IMPROC_CORECV_LOGGER_ERROR("ERROR_02: " + error_message);
+            throw improc::value_error(std::move(error_message));
+    }
+}
+
+/**
+ * @brief Check if images with type can be resized with precomputed coefficients
+ *
+ * @param interpolation - interpolation type
+ * @param image_type - image OpenCV type
+ */
+bool improc::ResizeCoefficients::IsSupported(const improc::InterpolationType& interpolation, int image_type)
+{
+    return (interpolation == improc::InterpolationType::Value::kLinear || interpolation == improc::InterpolationType::Value::kNearest)
+        && CV_MAT_DEPTH(image_type) == CV_8U && CV_MAT_CN(image_type) <= 4;
+}
+
+/**
+ * @brief Obtain source image size
+ */
+cv::Size improc::ResizeCoefficients::get_from_image_size() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining source image size...");
+    return this->from_image_size_;
+}
+
+/**
+ * @brief Obtain target image size
+ */
+cv::Size improc::ResizeCoefficients::get_to_image_size() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining target image size...");
+    return this->to_image_size_;
+}
+
+/**
+ * @brief Obtain interpolation type
+ */
+improc::InterpolationType improc::ResizeCoefficients::get_interpolation() const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining interpolation type...");
+    return this->interpolation_;
+}
+
+/**
+ * @brief Obtain source column of each target column. Linear interpolation also uses the next source column.
+ */
+const std::vector<int>& improc::ResizeCoefficients::get_x_offsets() const
+{
+    return this->x_offsets_;
+}
+
+/**
+ * @brief Obtain fixed-point weights of the two source columns of each target column. Empty for nearest interpolation.
+ */
+const std::vector<short>& improc::ResizeCoefficients::get_x_coefficients() const
+{
+    return this->x_coefficients_;
+}
+
+/**
+ * @brief Obtain source row of each target row. Linear interpolation also uses the next source row.
+ */
+const std::vector<int>& improc::ResizeCoefficients::get_y_offsets() const
+{
+    return this->y_offsets_;
+}
+
+/**
+ * @brief Obtain fixed-point weights of the two source rows of each target row. Empty for nearest interpolation.
+ */
+const std::vector<short>& improc::ResizeCoefficients::get_y_coefficients() const
+{
+    return this->y_coefficients_;
+}
+
+/**
+ * @brief Resize image with precomputed coefficients
+ *
+ * @param image - image data with source image size
+ * @param resized_image - destination for resized image. Buffer is reused when it already has the target size and type.
+ */
+void improc::ResizeCoefficients::Apply(const cv::Mat& image, cv::Mat& resized_image) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Resizing image with precomputed coefficients...");
+    if (image.size() != this->from_image_size_ || improc::ResizeCoefficients::IsSupported(this->interpolation_,image.type()) == false)
+    {
+        std::string error_message = fmt::format ( "Invalid image for resize coefficients. Expected 8-bit image with size {}x{} received type {} with size {}x{}."
+                                                , this->from_image_size_.width, this->from_image_size_.height
+                                                , image.type(), image.cols, image.rows );
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_03: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    // Resize cannot be performed in-place, since source rows are read after target rows are written
+    cv::Mat resized_image_buffer = resized_image.data != nullptr && resized_image.data == image.data ? improc::ImageAllocator::get().CreateMat()
+                                                                                                   : resized_image;
+    resized_image_buffer.create(this->to_image_size_,image.type());
+    const AxisCoefficients kXAxis {this->x_offsets_.data(),this->x_coefficients_.data(),this->to_image_size_.width ,0};
+    const AxisCoefficients kYAxis {this->y_offsets_.data(),this->y_coefficients_.data(),this->to_image_size_.height,0};
+    Resize(image,resized_image_buffer,this->interpolation_,kXAxis,kYAxis);
+    resized_image = std::move(resized_image_buffer);
+}
+
+/**
+ * @brief Obtain source region read to compute a target region
+ *
+ * @param to_region - region of the target image
+ */
+cv::Rect improc::ResizeCoefficients::GetSourceRegion(const cv::Rect& to_region) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Obtaining source region for target region...");
+    if (to_region.empty() == true || (to_region & cv::Rect(cv::Point(),this->to_image_size_)) != to_region)
+    {
+        std::string error_message = fmt::format ( "Invalid target region ({},{}) {}x{} for resize coefficients with target size {}x{}."
+                                                , to_region.x, to_region.y, to_region.width, to_region.height
+                                                , this->to_image_size_.width, this->to_image_size_.height );
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_04: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    // Linear interpolation also reads the next source column and row, clamped to the image border
+    const int kNumberNeighbors = this->interpolation_ == improc::InterpolationType::Value::kLinear ? 1 : 0;
+    const int kFromCol    = this->x_offsets_[to_region.x];
+    const int kFromRow    = this->y_offsets_[to_region.y];
+    const int kFromColEnd = std::min(this->x_offsets_[to_region.x + to_region.width  - 1] + kNumberNeighbors,this->from_image_size_.width  - 1);
+    const int kFromRowEnd = std::min(this->y_offsets_[to_region.y + to_region.height - 1] + kNumberNeighbors,this->from_image_size_.height - 1);
+    return cv::Rect(kFromCol,kFromRow,kFromColEnd - kFromCol + 1,kFromRowEnd - kFromRow + 1);
+}
+
+/**
+ * @brief Resize region of image with precomputed coefficients. Tiles resized with this method give the same
+ * image as resizing the whole image.
+ *
+ * @param image_region - image data of the source region of the target region
+ * @param to_region - region of the target image
+ * @param resized_region - destination for resized region. Buffer is reused when it already has the region size and type.
+ */
+void improc::ResizeCoefficients::ApplyToRegion(const cv::Mat& image_region, const cv::Rect& to_region, cv::Mat& resized_region) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Resizing image region with precomputed coefficients...");
+    const cv::Rect kFromRegion = this->GetSourceRegion(to_region);
+    if (image_region.size() != kFromRegion.size() || improc::ResizeCoefficients::IsSupported(this->interpolation_,image_region.type()) == false)
+    {
+        std::string error_message = fmt::format ( "Invalid image region for resize coefficients. Expected 8-bit image with size {}x{} received type {} with size {}x{}."
+                                                , kFromRegion.width, kFromRegion.height, image_region.type(), image_region.cols, image_region.rows );
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_05: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    // Offsets are moved to the source region. Neighbors clamped to the region border are the ones clamped to the image border.
+    // Nearest interpolation has no coefficients, so their pointers are not used.
+    const bool kIsLinear = this->interpolation_ == improc::InterpolationType::Value::kLinear;
+    const AxisCoefficients kXAxis { this->x_offsets_.data() + to_region.x
+                                  , kIsLinear == true ? this->x_coefficients_.data() + 2 * to_region.x : nullptr
+                                  , to_region.width, kFromRegion.x };
+    const AxisCoefficients kYAxis { this->y_offsets_.data() + to_region.y
+                                  , kIsLinear == true ? this->y_coefficients_.data() + 2 * to_region.y : nullptr
+                                  , to_region.height, kFromRegion.y };
+
+    cv::Mat resized_region_buffer = resized_region.data != nullptr && resized_region.data == image_region.data ? improc::ImageAllocator::get().CreateMat()
+                                                                                                             : resized_region;
+    resized_region_buffer.create(to_region.size(),image_region.type());
+    Resize(image_region,resized_region_buffer,this->interpolation_,kXAxis,kYAxis);
+    resized_region = std::move(resized_region_buffer);
+}
\ No newline at end of file
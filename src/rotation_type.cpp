@@ -1,4 +1,124 @@
 #include <improc/corecv/structures/rotation_type.hpp>
+#include <improc/corecv/image_allocator.hpp>
+#include <improc/corecv/metrics.hpp>
+
+namespace
+{
+    /**
+     * @brief Three channel pixel used by the rotation kernels
+     */
+    struct Pixel3b
+    {
+        uchar                   channels[3];
+    };
+
+    /**
+     * @brief Rotate image by 90 or 270 degrees clockwise in a single pass.
+     * 
+     * Destination is written in square tiles, so that the source block read for a tile
+     * stays in cache while it is transposed.
+     * 
+     * @tparam PixelType - pixel data type
+     * @param image - image data to be rotated
+     * @param rotated_image - rotated image data with transposed size
+     * @param is_clockwise - rotate by 90 degrees clockwise if true and by 270 degrees otherwise
+     */
+    template <typename PixelType>
+    void RotateQuarterTiled(const cv::Mat& image, cv::Mat& rotated_image, bool is_clockwise)
+    {
+        static constexpr int kTileSize = sizeof(PixelType) == 1 ? 64 : 32;
+        const int kNumberTileRows = (rotated_image.rows + kTileSize - 1) / kTileSize;
+        cv::parallel_for_( cv::Range(0,kNumberTileRows)
+                         , [&image,&rotated_image,is_clockwise] (const cv::Range& range) -> void
+                           {
+                               for (int tile_row = range.start * kTileSize; tile_row < std::min(range.end * kTileSize,rotated_image.rows); tile_row += kTileSize)
+                               {
+                                   const int kTileRowEnd = std::min(tile_row + kTileSize,rotated_image.rows);
+                                   for (int tile_col = 0; tile_col < rotated_image.cols; tile_col += kTileSize)
+                                   {
+                                       const int kTileColEnd = std::min(tile_col + kTileSize,rotated_image.cols);
+                                       for (int row = tile_row; row < kTileRowEnd; ++row)
+                                       {
+                                           PixelType* rotated_row = rotated_image.ptr<PixelType>(row);
+                                           if (is_clockwise == true)
+                                           {
+                                               // rotated(row,col) = image(rows - 1 - col, row)
+                                               for (int col = tile_col; col < kTileColEnd; ++col)
+                                               {
+                                                   rotated_row[col] = image.ptr<PixelType>(image.rows - 1 - col)[row];
+                                               }
+                                           }
+                                           else
+                                           {
+                                               // rotated(row,col) = image(col, cols - 1 - row)
+                                               const int kImageCol = image.cols - 1 - row;
+                                               for (int col = tile_col; col < kTileColEnd; ++col)
+                                               {
+                                                   rotated_row[col] = image.ptr<PixelType>(col)[kImageCol];
+                                               }
+                                           }
+                                       }
+                                   }
+                               }
+                           } );
+    }
+
+    /**
+     * @brief Rotate image by a clockwise rotation into the destination buffer
+     * 
+     * @param image - image data to be rotated
+     * @param rotated_image - destination buffer. It is reused when it already has the rotated size and type.
+     * @param rotation - clockwise rotation
+     */
+    void Rotate(const cv::Mat& image, cv::Mat& rotated_image, improc::RotationType::Value rotation)
+    {
+        if (rotated_image.data != nullptr && rotated_image.data == image.data)
+        {
+            // Rotation cannot be performed in-place. Rotate into a new buffer and replace destination.
+            cv::Mat rotated_image_buffer = improc::ImageAllocator::get().CreateMat();
+            Rotate(image,rotated_image_buffer,rotation);
+            rotated_image = std::move(rotated_image_buffer);
+            return;
+        }
+
+        if (rotation == improc::RotationType::Value::k90Deg || rotation == improc::RotationType::Value::k270Deg)
+        {
+            const bool kIsClockwise = rotation == improc::RotationType::Value::k90Deg;
+            rotated_image.create(image.cols,image.rows,image.type());
+            switch (image.type())
+            {
+                case CV_8UC1: RotateQuarterTiled<uchar>   (image,rotated_image,kIsClockwise);   break;
+                case CV_8UC3: RotateQuarterTiled<Pixel3b> (image,rotated_image,kIsClockwise);   break;
+                case CV_8UC4: RotateQuarterTiled<uint32_t>(image,rotated_image,kIsClockwise);   break;
+                default:
+                    cv::transpose(image,rotated_image);
+                    cv::flip(rotated_image,rotated_image,kIsClockwise == true ? +1 : 0); // Flip around y-axis or x-axis
+                    break;
+            }
+        }
+        else if (rotation == improc::RotationType::Value::k180Deg)
+        {
+            cv::flip(image,rotated_image,-1); // Flip around x- and y-axis
+        }
+        else
+        {
+            image.copyTo(rotated_image);
+        }
+    }
+
+    /**
+     * @brief Obtain clockwise rotation that reverts rotation
+     */
+    improc::RotationType::Value GetInverseRotation(improc::RotationType::Value rotation)
+    {
+        switch (rotation)
+        {
+            case improc::RotationType::Value::k90Deg : return improc::RotationType::Value::k270Deg;  break;
+            case improc::RotationType::Value::k270Deg: return improc::RotationType::Value::k90Deg;   break;
+            default:                                   return rotation;
+        }
+    }
+}
 
 /**
  * @brief Construct a new improc::RotationType object
@@ -10,75 +130,76 @@ improc::RotationType::RotationType() : value_(improc::RotationType::k0Deg) {};
  * 
  * @param rotation_type_str - rotation type description as string
  */
-improc::RotationType::RotationType(const std::string& rotation_type_str)
+improc::RotationType::RotationType(std::string_view rotation_type_str)
 {
     IMPROC_CORECV_LOGGER_TRACE("Obtaining rotation type from string {}...",rotation_type_str);
-    static const std::unordered_map<std::string,RotationType::Value> kToElemType = { {"0-deg"  ,RotationType::Value::k0Deg  }
-                                                                                   , {"90-deg" ,RotationType::Value::k90Deg }
-                                                                                   , {"180-deg",RotationType::Value::k180Deg}
-                                                                                   , {"270-deg",RotationType::Value::k270Deg}
-                                                                                   };
-    this->value_ = kToElemType.at(improc::String::ToLower(std::move(rotation_type_str)));
+    this->value_ = improc::RotationType::kEnumTable.Parse(rotation_type_str);
 }
 
 /**
  * @brief Apply rotation to image
  * 
  * @param image - image data to be rotated
- * @return cv::Mat - rotated image
+ * @return cv::Mat - rotated image. For 0 degrees the image data is shared with the input.
  */
 cv::Mat improc::RotationType::Apply(const cv::Mat& image) const
 {
     IMPROC_CORECV_LOGGER_TRACE("Applying rotation...");
-    cv::Mat rotated_image {};
-    if (this->value_ == improc::RotationType::Value::k90Deg)
-    {
-        cv::transpose(image,rotated_image);
-        cv::flip(rotated_image,rotated_image,+1); // Flip around y-axis
-    }
-    else if (this->value_ == improc::RotationType::Value::k270Deg)
+    IMPROC_CORECV_METRICS_SCOPE(metrics_record,"RotationType::Apply");
+    if (this->value_ == improc::RotationType::Value::k0Deg)
     {
-        cv::transpose(image,rotated_image);
-        cv::flip(rotated_image,rotated_image,0); // Flip around x-axis
-    }
-    else if (this->value_ == improc::RotationType::Value::k180Deg)
-    {
-        cv::flip(image,rotated_image,-1); // Flip around x- and y-axis
-    }
-    else
-    {
-        rotated_image = image;
+        return image;
     }
+    cv::Mat rotated_image = improc::ImageAllocator::get().CreateMat();
+    Rotate(image,rotated_image,this->value_);
+    IMPROC_CORECV_METRICS_SET_IMAGES(metrics_record,image,rotated_image);
     return rotated_image;
 }
 
+/**
+ * @brief Apply rotation to image
+ * 
+ * @param image - image data to be rotated
+ * @param rotated_image - destination for rotated image. Buffer is reused when it already has the rotated size and type.
+ */
+void improc::RotationType::Apply(const cv::Mat& image, cv::Mat& rotated_image) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Applying rotation to destination...");
+    IMPROC_CORECV_METRICS_SCOPE(metrics_record,"RotationType::Apply");
+    Rotate(image,rotated_image,this->value_);
+    IMPROC_CORECV_METRICS_SET_IMAGES(metrics_record,image,rotated_image);
+}
+
 /**
  * @brief Apply inverse rotation to image
  * 
  * @param rotated_image - image data to be rotated
- * @return cv::Mat - rotated image
+ * @return cv::Mat - rotated image. For 0 degrees the image data is shared with the input.
  */
 cv::Mat improc::RotationType::ApplyInverse(const cv::Mat& rotated_image) const
 {
     IMPROC_CORECV_LOGGER_TRACE("Applying inverse rotation...");
-    cv::Mat image {};
-    if (this->value_ == improc::RotationType::Value::k90Deg)
-    {
-        cv::transpose(rotated_image,image);
-        cv::flip(image,image,0); // Flip around x-axis
-    }
-    else if (this->value_ == improc::RotationType::Value::k270Deg)
-    {
-        cv::transpose(rotated_image,image);
-        cv::flip(image,image,+1); // Flip around y-axis
-    }
-    else if (this->value_ == improc::RotationType::Value::k180Deg)
+    IMPROC_CORECV_METRICS_SCOPE(metrics_record,"RotationType::ApplyInverse");
+    if (this->value_ == improc::RotationType::Value::k0Deg)
     {
-        cv::flip(rotated_image,image,-1); // Flip around x- and y-axis
-    }
-    else
-    {
-        image = rotated_image;
+        return rotated_image;
     }
+    cv::Mat image = improc::ImageAllocator::get().CreateMat();
+    Rotate(rotated_image,image,GetInverseRotation(this->value_));
+    IMPROC_CORECV_METRICS_SET_IMAGES(metrics_record,rotated_image,image);
     return image;
 }
+
+/**
+ * @brief Apply inverse rotation to image
+ * 
+ * @param rotated_image - image data to be rotated
+ * @param image - destination for rotated image. Buffer is reused when it already has the rotated size and type.
+ */
+void improc::RotationType::ApplyInverse(const cv::Mat& rotated_image, cv::Mat& image) const
+{
+    IMPROC_CORECV_LOGGER_TRACE("Applying inverse rotation to destination...");
+    IMPROC_CORECV_METRICS_SCOPE(metrics_record,"RotationType::ApplyInverse");
+    Rotate(rotated_image,image,GetInverseRotation(this->value_));
+    IMPROC_CORECV_METRICS_SET_IMAGES(metrics_record,rotated_image,image);
+}
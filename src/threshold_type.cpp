@@ -10,11 +10,8 @@ improc::ThresholdType::ThresholdType() : value_(improc::ThresholdType::kOtsu) {}
  * 
  * @param threshold_type_str - threshold type description as string
  */
-improc::ThresholdType::ThresholdType(const std::string& threshold_type_str)
+improc::ThresholdType::ThresholdType(std::string_view threshold_type_str)
 {
     IMPROC_CORECV_LOGGER_TRACE("Creating threshold type from string {}...", threshold_type_str);
-    static const std::unordered_map<std::string,ThresholdType::Value> kToElemType = { {"otsu"  ,ThresholdType::Value::kOtsu  }
-                                                                                    , {"binary",ThresholdType::Value::kBinary} 
-                                                                                    };
-    this->value_ = kToElemType.at(improc::String::ToLower(std::move(threshold_type_str)));
+    this->value_ = improc::ThresholdType::kEnumTable.Parse(threshold_type_str);
 }
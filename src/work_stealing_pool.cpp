@@ -0,0 +1,163 @@
+#include <improc/corecv/work_stealing_pool.hpp>
+
+namespace
+{
+    // Pool and worker of the current thread, so that tasks submitted from a worker stay on its queue
+    thread_local const improc::WorkStealingPool*    current_pool    = nullptr;
+    thread_local size_t                             current_worker  = 0;
+}
+
+/**
+ * @brief Construct a new improc::WorkStealingPool object and start the workers
+ *
+ * @param number_threads - number of worker threads
+ */
+improc::WorkStealingPool::WorkStealingPool(size_t number_threads) : workers_(std::vector<std::unique_ptr<Worker>>())
+                                                                  , threads_(std::vector<std::thread>())
+                                                                  , number_pending_(0)
+                                                                  , is_running_(true)
+                                                                  , next_worker_(0)
+                                                                  , number_steals_(0)
+{
+    IMPROC_CORECV_LOGGER_TRACE("Creating work stealing pool with {} threads...",number_threads);
+    if (number_threads == 0)
+    {
+        std::string error_message = "Invalid number of threads. Pool should have at least one thread.";
+        IMPROC_CORECV_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    for (size_t worker_idx = 0; worker_idx < number_threads; ++worker_idx)
+    {
+        this->workers_.push_back(std::make_unique<Worker>());
+    }
+    for (size_t worker_idx = 0; worker_idx < number_threads; ++worker_idx)
+    {
+        this->threads_.emplace_back([this,worker_idx] () -> void {this->Work(worker_idx);});
+    }
+}
+
+/**
+ * @brief Destroy the improc::WorkStealingPool object. Submitted tasks are run before the workers stop.
+ */
+improc::WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::lock_guard<std::mutex> lock {this->sleep_mutex_};
+        this->is_running_ = false;
+    }
+    this->sleep_condition_.notify_all();
+    for (std::thread& thread : this->threads_)
+    {
+        thread.join();
+    }
+}
+
+/**
+ * @brief Queue task to be run by one of the workers
+ *
+ * @param task - task to be run. Exceptions thrown by the task are logged and discarded.
+ */
+void improc::WorkStealingPool::Submit(improc::WorkStealingPool::Task task)
+{
+    const size_t kWorkerIdx = current_pool == this ? current_worker
+                                                   : this->next_worker_.fetch_add(1,std::memory_order_relaxed) % this->workers_.size();
+    // Pending count is increased before the task is queued, so that a worker taking it cannot decrease the count below zero
+    {
+        std::lock_guard<std::mutex> lock {this->sleep_mutex_};
+        ++this->number_pending_;
+    }
+    {
+        std::lock_guard<std::mutex> lock {this->workers_[kWorkerIdx]->mutex};
+        this->workers_[kWorkerIdx]->tasks.push_back(std::move(task));
+    }
+    this->sleep_condition_.notify_one();
+}
+
+/**
+ * @brief Obtain number of worker threads
+ */
+size_t improc::WorkStealingPool::get_number_threads() const
+{
+    return this->threads_.size();
+}
+
+/**
+ * @brief Obtain number of tasks taken from the queue of another worker
+ */
+size_t improc::WorkStealingPool::get_number_steals() const
+{
+    return this->number_steals_.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Take newest task of the worker or, if it has none, oldest task of another worker
+ */
+bool improc::WorkStealingPool::TryTake(size_t worker_idx, improc::WorkStealingPool::Task& task)
+{
+    {
+        Worker& worker = *this->workers_[worker_idx];
+        std::lock_guard<std::mutex> lock {worker.mutex};
+        if (worker.tasks.empty() == false)
+        {
+            task = std::move(worker.tasks.back());
+            worker.tasks.pop_back();
+            return true;
+        }
+    }
+    for (size_t victim_offset = 1; victim_offset < this->workers_.size(); ++victim_offset)
+    {
+        Worker& victim = *this->workers_[(worker_idx + victim_offset) % this->workers_.size()];
+        std::lock_guard<std::mutex> lock {victim.mutex};
+        if (victim.tasks.empty() == false)
+        {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            this->number_steals_.fetch_add(1,std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Run tasks until the pool is destroyed and no tasks are pending
+ */
+void improc::WorkStealingPool::Work(size_t worker_idx)
+{
+    current_pool   = this;
+    current_worker = worker_idx;
+    improc::WorkStealingPool::Task task {};
+    while (true)
+    {
+        if (this->TryTake(worker_idx,task) == true)
+        {
+            {
+                std::lock_guard<std::mutex> lock {this->sleep_mutex_};
+                --this->number_pending_;
+            }
+            try
+            {
+                task();
+            }
+            catch (const std::exception& exception)
+            {
+                IMPROC_CORECV_LOGGER_ERROR("ERROR_02: Task of work stealing pool failed. {}",exception.what());
+            }
+            catch (...)
+            {
+                IMPROC_CORECV_LOGGER_ERROR("ERROR_02: Task of work stealing pool failed.");
+            }
+            task = nullptr;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock {this->sleep_mutex_};
+        this->sleep_condition_.wait(lock,[this] () -> bool {return this->is_running_ == false || this->number_pending_ > 0;});
+        if (this->is_running_ == false && this->number_pending_ == 0)
+        {
+            break;
+        }
+    }
+    current_pool = nullptr;
+}
\ No newline at end of file
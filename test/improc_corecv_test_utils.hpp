@@ -0,0 +1,19 @@
+#ifndef IMPROC_CORECV_TEST_UTILS_HPP
+#define IMPROC_CORECV_TEST_UTILS_HPP
+
+#include <opencv2/core.hpp>
+
+namespace improc::test
+{
+    /**
+     * @brief Creates an image with uniformly distributed random values in [0,256)
+     */
+    inline cv::Mat CreateRandomImage(const cv::Size& image_size, int image_type)
+    {
+        cv::Mat image {image_size,image_type};
+        cv::randu(image,cv::Scalar::all(0),cv::Scalar::all(256));
+        return image;
+    }
+}
+
+#endif
\ No newline at end of file
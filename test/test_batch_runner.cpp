@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <improc/services/batch_runner.hpp>
+#include <improc/services/convert_color_space.hpp>
+#include <improc_corecv_test_config.hpp>
+
+TEST(BatchRunner,TestEmptyBatch) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_sequence_color_conversion_with_from.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousConvertColorSpace convert {};
+    convert.Load(json_content);
+
+    std::vector<improc::StringKeyHeterogeneousContext> cntxts {};
+    EXPECT_NO_THROW(improc::RunBatch(convert,cntxts));
+}
+
+TEST(BatchRunner,TestSameResultAsSingleImage) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_sequence_color_conversion_with_from.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousConvertColorSpace convert {};
+    convert.Load(json_content);
+
+    std::vector<improc::StringKeyHeterogeneousContext> cntxts (32);
+    std::vector<improc::StringKeyHeterogeneousContext> single_cntxts (32);
+    for (size_t cntxt_idx = 0; cntxt_idx < cntxts.size(); ++cntxt_idx)
+    {
+        cv::Mat image_data (8 + static_cast<int>(cntxt_idx),5,CV_8UC3);
+        cv::randu(image_data,0,256);
+        cntxts[cntxt_idx].Add("image",image_data);
+        single_cntxts[cntxt_idx].Add("image",image_data.clone());
+    }
+
+    improc::RunBatch(convert,cntxts);
+    for (size_t cntxt_idx = 0; cntxt_idx < cntxts.size(); ++cntxt_idx)
+    {
+        convert.Run(single_cntxts[cntxt_idx]);
+        improc::ColorSpaceImage image        = std::any_cast<improc::ColorSpaceImage>(cntxts[cntxt_idx].Get("image"));
+        improc::ColorSpaceImage single_image = std::any_cast<improc::ColorSpaceImage>(single_cntxts[cntxt_idx].Get("image"));
+        EXPECT_EQ(image.get_color_space(),single_image.get_color_space());
+        EXPECT_EQ(cv::norm(image.get_data(),single_image.get_data(),cv::NORM_L1),0);
+    }
+}
+
+TEST(BatchRunner,TestRethrowServiceError) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_color_conversion_without_from.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousConvertColorSpace convert {};
+    convert.Load(json_content);
+
+    std::vector<improc::StringKeyHeterogeneousContext> cntxts (4);
+    for (size_t cntxt_idx = 0; cntxt_idx < cntxts.size(); ++cntxt_idx)
+    {
+        cntxts[cntxt_idx].Add("image",cv::Mat(cv::Mat::ones(10,5,CV_8UC3)));
+        if (cntxt_idx != 2)
+        {
+            cntxts[cntxt_idx].Add("from_color_space",improc::ColorSpace(improc::ColorSpace::kRGB));
+        }
+    }
+    EXPECT_THROW(improc::RunBatch(convert,cntxts),improc::key_error);
+    improc::ColorSpaceImage image = std::any_cast<improc::ColorSpaceImage>(cntxts[0].Get("image"));
+    EXPECT_EQ(image.get_color_space(),improc::ColorSpace::kGray);
+}
\ No newline at end of file
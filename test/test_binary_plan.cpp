@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include <improc/corecv/parsers/binary_plan.hpp>
+#include <improc/corecv/structures/color_space.hpp>
+#include <improc/corecv/structures/interpolation_type.hpp>
+#include <improc_corecv_test_config.hpp>
+
+#include <cstdio>
+
+TEST(BinaryPlan,TestReadWrittenValues) {
+    improc::PlanWriter plan_writer {};
+    plan_writer.WriteService("Service");
+    plan_writer.WriteBool(true);
+    plan_writer.WriteUInt32(4000000000u);
+    plan_writer.WriteInt32(-12);
+    plan_writer.WriteDouble(0.25);
+    plan_writer.WriteString("image");
+    plan_writer.WriteSize(cv::Size(40,30));
+    plan_writer.WriteSize(cv::Size2d(0.5,2.0));
+    plan_writer.WriteEnum(improc::ColorSpace(improc::ColorSpace::Value::kGray));
+    plan_writer.WriteKeys(std::vector<std::string>({"image","mask"}));
+
+    improc::PlanReader plan_reader {plan_writer.get_data()};
+    EXPECT_EQ(plan_reader.PeekService(),"Service");
+    plan_reader.ReadService("Service");
+    EXPECT_TRUE (plan_reader.ReadBool());
+    EXPECT_EQ(plan_reader.ReadUInt32(),4000000000u);
+    EXPECT_EQ(plan_reader.ReadInt32(),-12);
+    EXPECT_DOUBLE_EQ(plan_reader.ReadDouble(),0.25);
+    EXPECT_EQ(plan_reader.ReadString(),"image");
+    EXPECT_EQ(plan_reader.ReadSize(),cv::Size(40,30));
+    EXPECT_EQ(plan_reader.ReadSize2d(),cv::Size2d(0.5,2.0));
+    EXPECT_EQ(plan_reader.ReadEnum<improc::ColorSpace>(),improc::ColorSpace::Value::kGray);
+    EXPECT_EQ(plan_reader.ReadKeys<std::string>(),std::vector<std::string>({"image","mask"}));
+    EXPECT_TRUE (plan_reader.IsEnd());
+}
+
+TEST(BinaryPlan,TestReadInvalidMagic) {
+    std::vector<uchar> plan_data = improc::PlanWriter().get_data();
+    plan_data[0] = 'X';
+    EXPECT_THROW(improc::PlanReader {plan_data},improc::file_processing_error);
+    EXPECT_THROW(improc::PlanReader {std::vector<uchar>()},improc::file_processing_error);
+}
+
+TEST(BinaryPlan,TestReadInvalidVersion) {
+    std::vector<uchar> plan_data = improc::PlanWriter().get_data();
+    plan_data[sizeof(improc::PlanWriter::kMagic)] += 1;
+    EXPECT_THROW(improc::PlanReader {plan_data},improc::file_processing_error);
+}
+
+TEST(BinaryPlan,TestReadTruncatedData) {
+    improc::PlanWriter plan_writer {};
+    plan_writer.WriteString("image");
+    std::vector<uchar> plan_data = plan_writer.get_data();
+    plan_data.pop_back();
+
+    improc::PlanReader plan_reader {plan_data};
+    EXPECT_THROW(plan_reader.ReadString(),improc::file_processing_error);
+}
+
+TEST(BinaryPlan,TestReadOtherService) {
+    improc::PlanWriter plan_writer {};
+    plan_writer.WriteService("Resize");
+
+    improc::PlanReader plan_reader {plan_writer.get_data()};
+    EXPECT_THROW(plan_reader.ReadService("Morphology"),improc::file_processing_error);
+}
+
+TEST(BinaryPlan,TestReadInvalidEnum) {
+    improc::PlanWriter plan_writer {};
+    plan_writer.WriteInt32(1000);
+
+    improc::PlanReader plan_reader {plan_writer.get_data()};
+    EXPECT_THROW(plan_reader.ReadEnum<improc::InterpolationType>(),improc::file_processing_error);
+}
+
+TEST(BinaryPlan,TestSaveAndRead) {
+    const std::string kFilepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_binary_plan.plan";
+    improc::PlanWriter plan_writer {};
+    plan_writer.WriteService("Resize");
+    plan_writer.WriteEnum(improc::InterpolationType(improc::InterpolationType::Value::kNearest));
+    plan_writer.Save(kFilepath);
+
+    improc::PlanReader plan_reader {kFilepath};
+    std::remove(kFilepath.c_str());
+    plan_reader.ReadService("Resize");
+    EXPECT_EQ(plan_reader.ReadEnum<improc::InterpolationType>(),improc::InterpolationType::Value::kNearest);
+    EXPECT_TRUE (plan_reader.IsEnd());
+}
+
+TEST(BinaryPlan,TestReadMissingFile) {
+    EXPECT_THROW(improc::PlanReader {std::string("missing.plan")},improc::file_processing_error);
+}
\ No newline at end of file
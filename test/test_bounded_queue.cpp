@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <improc/corecv/bounded_queue.hpp>
+
+#include <thread>
+#include <vector>
+
+TEST(BoundedQueue,TestInvalidCapacity) {
+    EXPECT_THROW(improc::BoundedQueue<int> (0),improc::value_error);
+    EXPECT_THROW(improc::BoundedQueue<int> (6),improc::value_error);
+}
+
+TEST(BoundedQueue,TestFirstInFirstOut) {
+    improc::BoundedQueue<int> queue {4};
+    for (int item = 0; item < 4; ++item)
+    {
+        EXPECT_TRUE(queue.TryPush(item));
+    }
+    int item = 4;
+    EXPECT_FALSE(queue.TryPush(item));
+    for (int expected_item = 0; expected_item < 4; ++expected_item)
+    {
+        EXPECT_EQ(queue.TryPop().value(),expected_item);
+    }
+    EXPECT_FALSE(queue.TryPop().has_value());
+    EXPECT_EQ(queue.get_capacity(),4);
+}
+
+TEST(BoundedQueue,TestDropOldest) {
+    improc::BoundedQueue<int> queue {2,improc::BackpressurePolicy::kDropOldest};
+    for (int item = 0; item < 5; ++item)
+    {
+        EXPECT_TRUE(queue.Push(item));
+    }
+    EXPECT_EQ(queue.TryPop().value(),3);
+    EXPECT_EQ(queue.TryPop().value(),4);
+
+    const improc::BoundedQueue<int>::Statistics kStatistics = queue.GetStatistics();
+    EXPECT_EQ(kStatistics.pushed,5);
+    EXPECT_EQ(kStatistics.popped,2);
+    EXPECT_EQ(kStatistics.dropped,3);
+    EXPECT_EQ(kStatistics.max_occupancy,2);
+}
+
+TEST(BoundedQueue,TestClose) {
+    improc::BoundedQueue<int> queue {2};
+    int item = 1;
+    queue.Push(item);
+    queue.Close();
+    EXPECT_TRUE (queue.IsClosed());
+    EXPECT_FALSE(queue.Push(item));
+    EXPECT_EQ(queue.Pop().value(),1);
+    EXPECT_FALSE(queue.Pop().has_value());
+}
+
+TEST(BoundedQueue,TestBlockUntilConsumed) {
+    improc::BoundedQueue<int> queue {2};
+    std::thread producer {[&queue] () -> void
+                          {
+                              for (int item = 0; item < 1000; ++item)
+                              {
+                                  queue.Push(item);
+                              }
+                              queue.Close();
+                          }};
+
+    std::vector<int> items {};
+    for (std::optional<int> item = queue.Pop(); item.has_value() == true; item = queue.Pop())
+    {
+        items.push_back(item.value());
+    }
+    producer.join();
+
+    ASSERT_EQ(items.size(),1000);
+    for (size_t item_idx = 0; item_idx < items.size(); ++item_idx)
+    {
+        EXPECT_EQ(items[item_idx],static_cast<int>(item_idx));
+    }
+    EXPECT_EQ(queue.GetStatistics().dropped,0);
+    EXPECT_LE(queue.GetStatistics().max_occupancy,2);
+}
\ No newline at end of file
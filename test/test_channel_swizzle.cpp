@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <improc/corecv/image.hpp>
+#include <improc/corecv/kernels/channel_swizzle.hpp>
+
+namespace
+{
+    const std::vector<improc::ColorSpace::Value> kColorSpaces { improc::ColorSpace::Value::kRGBA
+                                                              , improc::ColorSpace::Value::kBGRA
+                                                              , improc::ColorSpace::Value::kRGB
+                                                              , improc::ColorSpace::Value::kBGR
+                                                              , improc::ColorSpace::Value::kGray };
+
+    const std::vector<improc::ChannelSwizzle::InstructionSet> kInstructionSets { improc::ChannelSwizzle::InstructionSet::kScalar
+                                                                               , improc::ChannelSwizzle::InstructionSet::kSSE41
+                                                                               , improc::ChannelSwizzle::InstructionSet::kAVX2
+                                                                               , improc::ChannelSwizzle::InstructionSet::kAVX512BW };
+}
+
+TEST(ChannelSwizzle,TestIsSwizzle) {
+    EXPECT_TRUE (improc::ChannelSwizzle::IsSwizzle(improc::ColorSpace(improc::ColorSpace::kRGB) ,improc::ColorSpace(improc::ColorSpace::kBGR)));
+    EXPECT_TRUE (improc::ChannelSwizzle::IsSwizzle(improc::ColorSpace(improc::ColorSpace::kRGBA),improc::ColorSpace(improc::ColorSpace::kBGRA)));
+    EXPECT_TRUE (improc::ChannelSwizzle::IsSwizzle(improc::ColorSpace(improc::ColorSpace::kRGB) ,improc::ColorSpace(improc::ColorSpace::kBGRA)));
+    EXPECT_TRUE (improc::ChannelSwizzle::IsSwizzle(improc::ColorSpace(improc::ColorSpace::kBGRA),improc::ColorSpace(improc::ColorSpace::kRGB)));
+    EXPECT_TRUE (improc::ChannelSwizzle::IsSwizzle(improc::ColorSpace(improc::ColorSpace::kGray),improc::ColorSpace(improc::ColorSpace::kRGBA)));
+    EXPECT_FALSE(improc::ChannelSwizzle::IsSwizzle(improc::ColorSpace(improc::ColorSpace::kRGB) ,improc::ColorSpace(improc::ColorSpace::kGray)));
+    EXPECT_FALSE(improc::ChannelSwizzle::IsSwizzle(improc::ColorSpace(improc::ColorSpace::kRGB) ,improc::ColorSpace(improc::ColorSpace::kRGB)));
+}
+
+TEST(ChannelSwizzle,TestInvalidSwizzleConstructor) {
+    EXPECT_THROW(improc::ChannelSwizzle( improc::ColorSpace(improc::ColorSpace::kBGRA)
+                                       , improc::ColorSpace(improc::ColorSpace::kGray) ),improc::value_error);
+}
+
+TEST(ChannelSwizzle,TestScalarAlwaysSupported) {
+    EXPECT_TRUE(improc::ChannelSwizzle::IsInstructionSetSupported(improc::ChannelSwizzle::InstructionSet::kScalar));
+    EXPECT_TRUE(improc::ChannelSwizzle::IsInstructionSetSupported(improc::ChannelSwizzle::GetInstructionSet()));
+}
+
+TEST(ChannelSwizzle,TestInvalidImageChannels) {
+    improc::ChannelSwizzle swizzle {improc::ColorSpace(improc::ColorSpace::kRGB),improc::ColorSpace(improc::ColorSpace::kBGR)};
+    cv::Mat image {4,4,CV_8UC4};
+    cv::Mat swizzled_image {};
+    EXPECT_THROW(swizzle.Apply(image,swizzled_image),improc::value_error);
+}
+
+TEST(ChannelSwizzle,TestMatchesOpenCV) {
+    for (improc::ColorSpace::Value from_color_space : kColorSpaces)
+    {
+        for (improc::ColorSpace::Value to_color_space : kColorSpaces)
+        {
+            if (improc::ChannelSwizzle::IsSwizzle(improc::ColorSpace(from_color_space),improc::ColorSpace(to_color_space)) == false)
+            {
+                continue;
+            }
+            improc::ChannelSwizzle swizzle {improc::ColorSpace(from_color_space),improc::ColorSpace(to_color_space)};
+            cv::Mat image {37,203,CV_8UC(improc::ColorSpace(from_color_space).GetNumberChannels())};
+            cv::randu(image,cv::Scalar::all(0),cv::Scalar::all(255));
+            cv::Mat expected_image {};
+            cv::cvtColor(image,expected_image,improc::ColorSpace(from_color_space).GetColorConversionCode(to_color_space));
+            for (improc::ChannelSwizzle::InstructionSet instruction_set : kInstructionSets)
+            {
+                if (improc::ChannelSwizzle::IsInstructionSetSupported(instruction_set) == false)
+                {
+                    continue;
+                }
+                cv::Mat swizzled_image {};
+                swizzle.Apply(image,swizzled_image,instruction_set);
+                EXPECT_EQ(swizzled_image.size(),expected_image.size());
+                EXPECT_EQ(swizzled_image.type(),expected_image.type());
+                EXPECT_EQ(cv::norm(swizzled_image,expected_image,cv::NORM_INF),0);
+            }
+        }
+    }
+}
+
+TEST(ChannelSwizzle,TestNonContinuousImage) {
+    improc::ChannelSwizzle swizzle {improc::ColorSpace(improc::ColorSpace::kRGB),improc::ColorSpace(improc::ColorSpace::kBGRA)};
+    cv::Mat image {64,64,CV_8UC3};
+    cv::randu(image,cv::Scalar::all(0),cv::Scalar::all(255));
+    cv::Mat image_roi = image(cv::Rect(3,5,41,17));
+    cv::Mat expected_image {};
+    cv::cvtColor(image_roi,expected_image,cv::COLOR_RGB2BGRA);
+    cv::Mat swizzled_image {};
+    swizzle.Apply(image_roi,swizzled_image);
+    EXPECT_EQ(cv::norm(swizzled_image,expected_image,cv::NORM_INF),0);
+}
+
+TEST(ChannelSwizzle,TestConvertToColorSpaceWithOpenCV) {
+    cv::Mat image_data {15,33,CV_8UC3};
+    cv::randu(image_data,cv::Scalar::all(0),cv::Scalar::all(255));
+    improc::ColorSpaceImage swizzled_image {image_data,improc::ColorSpace::kRGB};
+    improc::ColorSpaceImage opencv_image   {image_data,improc::ColorSpace::kRGB};
+    swizzled_image.ConvertToColorSpace(improc::ColorSpace(improc::ColorSpace::kBGRA));
+    improc::ChannelSwizzle::Disable();
+    EXPECT_FALSE(improc::ChannelSwizzle::IsEnabled());
+    opencv_image.ConvertToColorSpace(improc::ColorSpace(improc::ColorSpace::kBGRA));
+    improc::ChannelSwizzle::Enable();
+    EXPECT_TRUE(improc::ChannelSwizzle::IsEnabled());
+    EXPECT_EQ(swizzled_image.get_color_space(),improc::ColorSpace::kBGRA);
+    EXPECT_EQ(cv::norm(swizzled_image.get_data(),opencv_image.get_data(),cv::NORM_INF),0);
+}
\ No newline at end of file
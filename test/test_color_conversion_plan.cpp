@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include <improc/corecv/structures/color_conversion_plan.hpp>
+
+TEST(ColorConversionPlan,TestEmptyConstructor) {
+    improc::ColorConversionPlan plan {};
+    EXPECT_EQ(plan.get_from_color_space(),improc::ColorSpace::kRGB);
+    EXPECT_EQ(plan.get_to_color_space()  ,improc::ColorSpace::kRGB);
+    EXPECT_TRUE(plan.IsIdentity());
+}
+
+TEST(ColorConversionPlan,TestSingleConversion) {
+    improc::ColorConversionPlan plan {improc::ColorSpace(improc::ColorSpace::kRGB),{improc::ColorSpace(improc::ColorSpace::kBGR)}};
+    EXPECT_EQ(plan.get_from_color_space(),improc::ColorSpace::kRGB);
+    EXPECT_EQ(plan.get_to_color_space()  ,improc::ColorSpace::kBGR);
+    ASSERT_EQ(plan.get_conversions().size(),1);
+    EXPECT_EQ(plan.get_conversions()[0],improc::ColorSpace::kBGR);
+}
+
+TEST(ColorConversionPlan,TestDropSameColorSpace) {
+    improc::ColorConversionPlan plan {improc::ColorSpace(improc::ColorSpace::kBGR),{ improc::ColorSpace(improc::ColorSpace::kBGR)
+                                                                                   , improc::ColorSpace(improc::ColorSpace::kBGR) }};
+    EXPECT_EQ(plan.get_to_color_space(),improc::ColorSpace::kBGR);
+    EXPECT_TRUE(plan.IsIdentity());
+}
+
+TEST(ColorConversionPlan,TestCollapseChannelPermutations) {
+    improc::ColorConversionPlan plan {improc::ColorSpace(improc::ColorSpace::kRGB),{ improc::ColorSpace(improc::ColorSpace::kBGR)
+                                                                                   , improc::ColorSpace(improc::ColorSpace::kGray) }};
+    EXPECT_EQ(plan.get_to_color_space(),improc::ColorSpace::kGray);
+    ASSERT_EQ(plan.get_conversions().size(),1);
+    EXPECT_EQ(plan.get_conversions()[0],improc::ColorSpace::kGray);
+}
+
+TEST(ColorConversionPlan,TestCollapseToIdentity) {
+    improc::ColorConversionPlan plan {improc::ColorSpace(improc::ColorSpace::kRGBA),{ improc::ColorSpace(improc::ColorSpace::kBGRA)
+                                                                                    , improc::ColorSpace(improc::ColorSpace::kRGBA) }};
+    EXPECT_EQ(plan.get_to_color_space(),improc::ColorSpace::kRGBA);
+    EXPECT_TRUE(plan.IsIdentity());
+}
+
+TEST(ColorConversionPlan,TestCollapseGrayRoundTrip) {
+    improc::ColorConversionPlan plan {improc::ColorSpace(improc::ColorSpace::kGray),{ improc::ColorSpace(improc::ColorSpace::kBGR)
+                                                                                    , improc::ColorSpace(improc::ColorSpace::kGray) }};
+    EXPECT_EQ(plan.get_to_color_space(),improc::ColorSpace::kGray);
+    EXPECT_TRUE(plan.IsIdentity());
+}
+
+TEST(ColorConversionPlan,TestKeepLossyConversionToGray) {
+    improc::ColorConversionPlan plan {improc::ColorSpace(improc::ColorSpace::kRGB),{ improc::ColorSpace(improc::ColorSpace::kGray)
+                                                                                   , improc::ColorSpace(improc::ColorSpace::kBGR) }};
+    EXPECT_EQ(plan.get_to_color_space(),improc::ColorSpace::kBGR);
+    ASSERT_EQ(plan.get_conversions().size(),2);
+    EXPECT_EQ(plan.get_conversions()[0],improc::ColorSpace::kGray);
+    EXPECT_EQ(plan.get_conversions()[1],improc::ColorSpace::kBGR);
+}
+
+TEST(ColorConversionPlan,TestKeepLossyConversionDroppingAlpha) {
+    improc::ColorConversionPlan plan {improc::ColorSpace(improc::ColorSpace::kRGBA),{ improc::ColorSpace(improc::ColorSpace::kRGB)
+                                                                                    , improc::ColorSpace(improc::ColorSpace::kBGRA) }};
+    EXPECT_EQ(plan.get_to_color_space(),improc::ColorSpace::kBGRA);
+    ASSERT_EQ(plan.get_conversions().size(),2);
+    EXPECT_EQ(plan.get_conversions()[0],improc::ColorSpace::kRGB);
+    EXPECT_EQ(plan.get_conversions()[1],improc::ColorSpace::kBGRA);
+}
+
+TEST(ColorConversionPlan,TestCollapseAfterLossyConversion) {
+    improc::ColorConversionPlan plan {improc::ColorSpace(improc::ColorSpace::kRGBA),{ improc::ColorSpace(improc::ColorSpace::kGray)
+                                                                                    , improc::ColorSpace(improc::ColorSpace::kRGB)
+                                                                                    , improc::ColorSpace(improc::ColorSpace::kBGRA) }};
+    EXPECT_EQ(plan.get_to_color_space(),improc::ColorSpace::kBGRA);
+    ASSERT_EQ(plan.get_conversions().size(),2);
+    EXPECT_EQ(plan.get_conversions()[0],improc::ColorSpace::kGray);
+    EXPECT_EQ(plan.get_conversions()[1],improc::ColorSpace::kBGRA);
+}
+
+
+TEST(ColorConversionPlan,TestKeepConversionFromYUV) {
+    improc::ColorConversionPlan plan {improc::ColorSpace(improc::ColorSpace::kNV12),{ improc::ColorSpace(improc::ColorSpace::kBGR)
+                                                                                    , improc::ColorSpace(improc::ColorSpace::kI420) }};
+    EXPECT_EQ(plan.get_to_color_space(),improc::ColorSpace::kI420);
+    ASSERT_EQ(plan.get_conversions().size(),2);
+    EXPECT_EQ(plan.get_conversions()[0],improc::ColorSpace::kBGR);
+    EXPECT_EQ(plan.get_conversions()[1],improc::ColorSpace::kI420);
+}
+
+TEST(ColorConversionPlan,TestKeepConversionFromYUVToGray) {
+    improc::ColorConversionPlan plan {improc::ColorSpace(improc::ColorSpace::kNV12),{ improc::ColorSpace(improc::ColorSpace::kBGR)
+                                                                                    , improc::ColorSpace(improc::ColorSpace::kGray) }};
+    EXPECT_EQ(plan.get_to_color_space(),improc::ColorSpace::kGray);
+    ASSERT_EQ(plan.get_conversions().size(),2);
+    EXPECT_EQ(plan.get_conversions()[0],improc::ColorSpace::kBGR);
+    EXPECT_EQ(plan.get_conversions()[1],improc::ColorSpace::kGray);
+}
+
+TEST(ColorConversionPlan,TestKeepRoundTripFromYUV) {
+    improc::ColorConversionPlan plan {improc::ColorSpace(improc::ColorSpace::kI420),{ improc::ColorSpace(improc::ColorSpace::kBGR)
+                                                                                    , improc::ColorSpace(improc::ColorSpace::kI420) }};
+    EXPECT_EQ(plan.get_to_color_space(),improc::ColorSpace::kI420);
+    ASSERT_EQ(plan.get_conversions().size(),2);
+    EXPECT_EQ(plan.get_conversions()[0],improc::ColorSpace::kBGR);
+    EXPECT_EQ(plan.get_conversions()[1],improc::ColorSpace::kI420);
+}
+
+TEST(ColorConversionPlan,TestCollapseChannelSwizzleFromYUV) {
+    improc::ColorConversionPlan plan {improc::ColorSpace(improc::ColorSpace::kYUYV),{ improc::ColorSpace(improc::ColorSpace::kBGR)
+                                                                                    , improc::ColorSpace(improc::ColorSpace::kRGBA) }};
+    EXPECT_EQ(plan.get_to_color_space(),improc::ColorSpace::kRGBA);
+    ASSERT_EQ(plan.get_conversions().size(),1);
+    EXPECT_EQ(plan.get_conversions()[0],improc::ColorSpace::kRGBA);
+}
+
+TEST(ColorConversionPlan,TestKeepLossyConversionToYUV) {
+    improc::ColorConversionPlan plan {improc::ColorSpace(improc::ColorSpace::kBGR),{ improc::ColorSpace(improc::ColorSpace::kI420)
+                                                                                   , improc::ColorSpace(improc::ColorSpace::kRGB) }};
+    EXPECT_EQ(plan.get_to_color_space(),improc::ColorSpace::kRGB);
+    ASSERT_EQ(plan.get_conversions().size(),2);
+    EXPECT_EQ(plan.get_conversions()[0],improc::ColorSpace::kI420);
+    EXPECT_EQ(plan.get_conversions()[1],improc::ColorSpace::kRGB);
+}
+
+TEST(ColorConversionPlan,TestKeepRoundTripThroughHSV) {
+    improc::ColorConversionPlan plan {improc::ColorSpace(improc::ColorSpace::kBGR),{ improc::ColorSpace(improc::ColorSpace::kHSV)
+                                                                                   , improc::ColorSpace(improc::ColorSpace::kBGR) }};
+    EXPECT_EQ(plan.get_to_color_space(),improc::ColorSpace::kBGR);
+    ASSERT_EQ(plan.get_conversions().size(),2);
+    EXPECT_EQ(plan.get_conversions()[0],improc::ColorSpace::kHSV);
+}
+
+TEST(ColorConversionPlan,TestKeepConversionWithoutDirectCode) {
+    improc::ColorConversionPlan plan {improc::ColorSpace(improc::ColorSpace::kHSV),{ improc::ColorSpace(improc::ColorSpace::kRGB)
+                                                                                   , improc::ColorSpace(improc::ColorSpace::kLab) }};
+    EXPECT_EQ(plan.get_to_color_space(),improc::ColorSpace::kLab);
+    ASSERT_EQ(plan.get_conversions().size(),2);
+    EXPECT_EQ(plan.get_conversions()[0],improc::ColorSpace::kRGB);
+    EXPECT_EQ(plan.get_conversions()[1],improc::ColorSpace::kLab);
+}
+
+TEST(ColorConversionPlan,TestKeepConversionToHSV) {
+    improc::ColorConversionPlan plan {improc::ColorSpace(improc::ColorSpace::kRGB),{ improc::ColorSpace(improc::ColorSpace::kBGR)
+                                                                                   , improc::ColorSpace(improc::ColorSpace::kHSV) }};
+    EXPECT_EQ(plan.get_to_color_space(),improc::ColorSpace::kHSV);
+    ASSERT_EQ(plan.get_conversions().size(),2);
+    EXPECT_EQ(plan.get_conversions()[0],improc::ColorSpace::kBGR);
+    EXPECT_EQ(plan.get_conversions()[1],improc::ColorSpace::kHSV);
+}
+
+TEST(ColorConversionPlan,TestKeepRoundTripFromHSV) {
+    improc::ColorConversionPlan plan {improc::ColorSpace(improc::ColorSpace::kHSV),{ improc::ColorSpace(improc::ColorSpace::kBGR)
+                                                                                   , improc::ColorSpace(improc::ColorSpace::kHSV) }};
+    EXPECT_EQ(plan.get_to_color_space(),improc::ColorSpace::kHSV);
+    ASSERT_EQ(plan.get_conversions().size(),2);
+    EXPECT_EQ(plan.get_conversions()[0],improc::ColorSpace::kBGR);
+    EXPECT_EQ(plan.get_conversions()[1],improc::ColorSpace::kHSV);
+}
+
+TEST(ColorConversionPlan,TestKeepRoundTripFromLab) {
+    improc::ColorConversionPlan plan {improc::ColorSpace(improc::ColorSpace::kLab),{ improc::ColorSpace(improc::ColorSpace::kRGB)
+                                                                                   , improc::ColorSpace(improc::ColorSpace::kLab) }};
+    EXPECT_EQ(plan.get_to_color_space(),improc::ColorSpace::kLab);
+    ASSERT_EQ(plan.get_conversions().size(),2);
+    EXPECT_EQ(plan.get_conversions()[0],improc::ColorSpace::kRGB);
+    EXPECT_EQ(plan.get_conversions()[1],improc::ColorSpace::kLab);
+}
\ No newline at end of file
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include <improc/corecv/kernels/color_lookup_table.hpp>
+#include <improc/corecv/image.hpp>
+#include <improc_corecv_test_utils.hpp>
+
+#include <opencv2/imgproc.hpp>
+
+#include <thread>
+
+namespace
+{
+    cv::Mat ConvertWithOpenCV(const cv::Mat& image, const improc::ColorSpace& from_color_space, const improc::ColorSpace& to_color_space)
+    {
+        cv::Mat converted_image {};
+        cv::cvtColor(image,converted_image,from_color_space.GetColorConversionCode(to_color_space));
+        return converted_image;
+    }
+
+    /**
+     * @brief Maximum absolute difference of channel between images. For HSV images, hue differences are measured
+     * along the shortest arc and pixels with expected saturation or value below minimum_saturation_value are skipped.
+     */
+    int GetMaximumError(const cv::Mat& image, const cv::Mat& expected_image, int channel, bool is_hsv = false, int minimum_saturation_value = 0)
+    {
+        int maximum_error = 0;
+        for (int row = 0; row < image.rows; ++row)
+        {
+            for (int col = 0; col < image.cols; ++col)
+            {
+                const cv::Vec3b& kExpectedPixel = expected_image.at<cv::Vec3b>(row,col);
+                if (is_hsv == true && std::min(kExpectedPixel[1],kExpectedPixel[2]) < minimum_saturation_value)
+                {
+                    continue;
+                }
+                int error = std::abs(image.at<cv::Vec3b>(row,col)[channel] - kExpectedPixel[channel]);
+                if (is_hsv == true && channel == 0)
+                {
+                    error = std::min(error,180 - error);
+                }
+                maximum_error = std::max(maximum_error,error);
+            }
+        }
+        return maximum_error;
+    }
+}
+
+TEST(ColorLookupTable,TestIsSupported) {
+    EXPECT_TRUE (improc::ColorLookupTable::IsSupported(improc::ColorSpace(improc::ColorSpace::kBGR),improc::ColorSpace(improc::ColorSpace::kHSV)));
+    EXPECT_TRUE (improc::ColorLookupTable::IsSupported(improc::ColorSpace(improc::ColorSpace::kRGB),improc::ColorSpace(improc::ColorSpace::kLab)));
+    EXPECT_FALSE(improc::ColorLookupTable::IsSupported(improc::ColorSpace(improc::ColorSpace::kLab),improc::ColorSpace(improc::ColorSpace::kBGR)));
+    EXPECT_FALSE(improc::ColorLookupTable::IsSupported(improc::ColorSpace(improc::ColorSpace::kBGR),improc::ColorSpace(improc::ColorSpace::kRGB)));
+    EXPECT_FALSE(improc::ColorLookupTable::IsSupported(improc::ColorSpace(improc::ColorSpace::kHSV),improc::ColorSpace(improc::ColorSpace::kLab)));
+    EXPECT_FALSE(improc::ColorLookupTable::IsSupported(improc::ColorSpace(improc::ColorSpace::kBGRA),improc::ColorSpace(improc::ColorSpace::kHSV)));
+    EXPECT_FALSE(improc::ColorLookupTable::IsSupported(improc::ColorSpace(improc::ColorSpace::kGray),improc::ColorSpace(improc::ColorSpace::kLab)));
+}
+
+TEST(ColorLookupTable,TestInvalidTable) {
+    EXPECT_THROW(improc::ColorLookupTable::Get( improc::ColorSpace(improc::ColorSpace::kBGR),improc::ColorSpace(improc::ColorSpace::kRGB)
+                                              , improc::ColorLookupTable::Mode::kTrilinear ),improc::value_error);
+    EXPECT_THROW(improc::ColorLookupTable::Get( improc::ColorSpace(improc::ColorSpace::kBGR),improc::ColorSpace(improc::ColorSpace::kHSV)
+                                              , improc::ColorLookupTable::Mode::kDisabled ),improc::value_error);
+}
+
+TEST(ColorLookupTable,TestApplyInvalidImage) {
+    const improc::ColorLookupTable& kTable = improc::ColorLookupTable::Get( improc::ColorSpace(improc::ColorSpace::kBGR),improc::ColorSpace(improc::ColorSpace::kLab)
+                                                                          , improc::ColorLookupTable::Mode::kTrilinear );
+    cv::Mat converted_image {};
+    EXPECT_THROW(kTable.Apply(cv::Mat::zeros(10,10,CV_8UC4),converted_image),improc::value_error);
+    EXPECT_THROW(kTable.Apply(cv::Mat::zeros(10,10,CV_32FC3),converted_image),improc::value_error);
+}
+
+TEST(ColorLookupTable,TestTableIsSharedBetweenThreads) {
+    std::vector<const improc::ColorLookupTable*> tables (4,nullptr);
+    std::vector<std::thread> threads {};
+    for (size_t thread_idx = 0; thread_idx < tables.size(); ++thread_idx)
+    {
+        threads.emplace_back([&tables,thread_idx] ()
+        {
+            tables[thread_idx] = &improc::ColorLookupTable::Get( improc::ColorSpace(improc::ColorSpace::kRGB),improc::ColorSpace(improc::ColorSpace::kHSV)
+                                                               , improc::ColorLookupTable::Mode::kTrilinear );
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    for (const improc::ColorLookupTable* table : tables)
+    {
+        EXPECT_EQ(table,tables[0]);
+    }
+    EXPECT_EQ(tables[0]->get_from_color_space(),improc::ColorSpace::kRGB);
+    EXPECT_EQ(tables[0]->get_to_color_space()  ,improc::ColorSpace::kHSV);
+    EXPECT_EQ(tables[0]->get_mode()            ,improc::ColorLookupTable::Mode::kTrilinear);
+}
+
+TEST(ColorLookupTable,TestFullTableMatchesOpenCV) {
+    const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(97,61),CV_8UC3);
+    const improc::ColorSpace kBGR {improc::ColorSpace::kBGR};
+    const improc::ColorSpace kHSV {improc::ColorSpace::kHSV};
+    cv::Mat converted_image {};
+    improc::ColorLookupTable::Get(kBGR,kHSV,improc::ColorLookupTable::Mode::kFull).Apply(kImage,converted_image);
+    EXPECT_EQ(cv::norm(converted_image,ConvertWithOpenCV(kImage,kBGR,kHSV),cv::NORM_INF),0);
+}
+
+TEST(ColorLookupTable,TestTrilinearAccuracy) {
+    // Lab is smooth and interpolates within one level. HSV value is the maximum channel, which bends inside
+    // grid cells. Hue is undefined and saturation is steep for dark and gray colors, so both are only
+    // accurate for colors with saturation and value of at least 64.
+    const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(256,256),CV_8UC3);
+    const improc::ColorSpace kBGR {improc::ColorSpace::kBGR};
+    const improc::ColorSpace kHSV {improc::ColorSpace::kHSV};
+    const improc::ColorSpace kLab {improc::ColorSpace::kLab};
+    cv::Mat converted_image {};
+
+    improc::ColorLookupTable::Get(kBGR,kLab,improc::ColorLookupTable::Mode::kTrilinear).Apply(kImage,converted_image);
+    const cv::Mat kExpectedLab = ConvertWithOpenCV(kImage,kBGR,kLab);
+    EXPECT_LE(GetMaximumError(converted_image,kExpectedLab,0),2);
+    EXPECT_LE(GetMaximumError(converted_image,kExpectedLab,1),2);
+    EXPECT_LE(GetMaximumError(converted_image,kExpectedLab,2),2);
+
+    improc::ColorLookupTable::Get(kBGR,kHSV,improc::ColorLookupTable::Mode::kTrilinear).Apply(kImage,converted_image);
+    const cv::Mat kExpectedHSV = ConvertWithOpenCV(kImage,kBGR,kHSV);
+    EXPECT_LE(GetMaximumError(converted_image,kExpectedHSV,0,true,64),2);
+    EXPECT_LE(GetMaximumError(converted_image,kExpectedHSV,1,true,64),8);
+    EXPECT_LE(GetMaximumError(converted_image,kExpectedHSV,2,true),2);
+}
+
+TEST(ColorLookupTable,TestColorSpaceImageUsesMode) {
+    const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(97,61),CV_8UC3);
+    EXPECT_EQ(improc::ColorLookupTable::GetMode(),improc::ColorLookupTable::Mode::kDisabled);
+    improc::ColorLookupTable::SetMode(improc::ColorLookupTable::Mode::kFull);
+    improc::ColorSpaceImage image {kImage,improc::ColorSpace::kBGR};
+    image.ConvertToColorSpace(improc::ColorSpace::kHSV);
+    improc::TypedColorSpaceImage<improc::ColorSpace::kHSV> typed_image = improc::TypedColorSpaceImage<improc::ColorSpace::kBGR>(kImage).ConvertToColorSpace<improc::ColorSpace::kHSV>();
+    improc::ColorLookupTable::SetMode(improc::ColorLookupTable::Mode::kDisabled);
+
+    const cv::Mat kExpectedImage = ConvertWithOpenCV(kImage,improc::ColorSpace(improc::ColorSpace::kBGR),improc::ColorSpace(improc::ColorSpace::kHSV));
+    EXPECT_EQ(image.get_color_space(),improc::ColorSpace::kHSV);
+    EXPECT_EQ(cv::norm(image.get_data(),kExpectedImage,cv::NORM_INF),0);
+    EXPECT_EQ(cv::norm(typed_image.get_data(),kExpectedImage,cv::NORM_INF),0);
+}
\ No newline at end of file
@@ -32,6 +32,20 @@ TEST(ColorSpace,TestInvalidStringConstructor) {
     EXPECT_THROW(improc::ColorSpace color_space {"invalid"},std::out_of_range);
 }
 
+TEST(ColorSpace,TestTryParse) {
+    static_assert(improc::ColorSpace::TryParse("Gray").value() == improc::ColorSpace::Value::kGray);
+    EXPECT_EQ(improc::ColorSpace::TryParse(std::string("gray")).value(),improc::ColorSpace::Value::kGray);
+    EXPECT_FALSE(improc::ColorSpace::TryParse("invalid").has_value());
+    EXPECT_FALSE(improc::ColorSpace::TryParse("").has_value());
+}
+
+TEST(ColorSpace,TestTryFromValue) {
+    static_assert(improc::ColorSpace::TryFromValue(improc::ColorSpace::Value::kLab).value() == improc::ColorSpace::Value::kLab);
+    EXPECT_EQ(improc::ColorSpace::TryFromValue(4).value(),improc::ColorSpace::Value::kGray);
+    EXPECT_FALSE(improc::ColorSpace::TryFromValue(10).has_value());
+    EXPECT_FALSE(improc::ColorSpace::TryFromValue(42).has_value());
+}
+
 TEST(ColorSpace,TestConstructorFromClass) {
     EXPECT_EQ(improc::ColorSpace::kBGR ,improc::ColorSpace::Value::kBGR);
     EXPECT_EQ(improc::ColorSpace::kRGB ,improc::ColorSpace::Value::kRGB);
@@ -130,3 +144,86 @@ TEST(ColorSpace,TestGetColorConversionCodeGray) {
     EXPECT_EQ(color_space_gray.GetColorConversionCode(color_space_rgba),cv::COLOR_GRAY2RGBA);
     EXPECT_THROW(color_space_gray.GetColorConversionCode(color_space_gray),improc::value_error);
 }
+
+
+TEST(ColorSpace,TestYUVConstructorFromString) {
+    EXPECT_EQ(improc::ColorSpace("nv12"),improc::ColorSpace::Value::kNV12);
+    EXPECT_EQ(improc::ColorSpace("I420"),improc::ColorSpace::Value::kI420);
+    EXPECT_EQ(improc::ColorSpace("yuyv"),improc::ColorSpace::Value::kYUYV);
+    EXPECT_EQ(improc::ColorSpace(improc::ColorSpace::kNV12).ToString(),"NV12");
+    EXPECT_EQ(improc::ColorSpace(improc::ColorSpace::kI420).ToString(),"I420");
+    EXPECT_EQ(improc::ColorSpace(improc::ColorSpace::kYUYV).ToString(),"YUYV");
+}
+
+TEST(ColorSpace,TestYUVNumberChannels) {
+    static_assert(improc::ColorSpace(improc::ColorSpace::kYUYV).IsYUV() == true);
+    EXPECT_EQ(improc::ColorSpace(improc::ColorSpace::kNV12).GetNumberChannels(),1);
+    EXPECT_EQ(improc::ColorSpace(improc::ColorSpace::kI420).GetNumberChannels(),1);
+    EXPECT_EQ(improc::ColorSpace(improc::ColorSpace::kYUYV).GetNumberChannels(),2);
+    EXPECT_TRUE (improc::ColorSpace(improc::ColorSpace::kNV12).IsYUV());
+    EXPECT_TRUE (improc::ColorSpace(improc::ColorSpace::kI420).IsYUV());
+    EXPECT_FALSE(improc::ColorSpace(improc::ColorSpace::kBGR).IsYUV());
+    EXPECT_FALSE(improc::ColorSpace(improc::ColorSpace::kGray).IsYUV());
+}
+
+TEST(ColorSpace,TestYUVDataSize) {
+    improc::ColorSpace color_space_nv12 {"nv12"};
+    improc::ColorSpace color_space_yuyv {"yuyv"};
+    improc::ColorSpace color_space_bgr  {"bgr"};
+    EXPECT_EQ(color_space_nv12.GetDataSize(cv::Size(40,30)) ,cv::Size(40,45));
+    EXPECT_EQ(color_space_nv12.GetImageSize(cv::Size(40,45)),cv::Size(40,30));
+    EXPECT_EQ(color_space_yuyv.GetDataSize(cv::Size(40,30)) ,cv::Size(40,30));
+    EXPECT_EQ(color_space_bgr.GetDataSize(cv::Size(41,31))  ,cv::Size(41,31));
+    EXPECT_TRUE (color_space_nv12.IsValidDataSize(cv::Size(40,45)));
+    EXPECT_FALSE(color_space_nv12.IsValidDataSize(cv::Size(40,44)));
+    EXPECT_FALSE(color_space_nv12.IsValidDataSize(cv::Size(41,45)));
+    EXPECT_TRUE (color_space_yuyv.IsValidDataSize(cv::Size(40,31)));
+    EXPECT_FALSE(color_space_yuyv.IsValidDataSize(cv::Size(41,30)));
+    EXPECT_TRUE (color_space_bgr.IsValidDataSize(cv::Size(41,31)));
+}
+
+TEST(ColorSpace,TestGetColorConversionCodeYUV) {
+    improc::ColorSpace color_space_bgr {"bgr"};
+    improc::ColorSpace color_space_rgba{"rgba"};
+    improc::ColorSpace color_space_gray{"gray"};
+    improc::ColorSpace color_space_nv12{"nv12"};
+    improc::ColorSpace color_space_i420{"i420"};
+    improc::ColorSpace color_space_yuyv{"yuyv"};
+    EXPECT_EQ(color_space_nv12.GetColorConversionCode(color_space_bgr) ,cv::COLOR_YUV2BGR_NV12);
+    EXPECT_EQ(color_space_i420.GetColorConversionCode(color_space_rgba),cv::COLOR_YUV2RGBA_I420);
+    EXPECT_EQ(color_space_yuyv.GetColorConversionCode(color_space_gray),cv::COLOR_YUV2GRAY_YUYV);
+    EXPECT_EQ(color_space_bgr.GetColorConversionCode(color_space_i420) ,cv::COLOR_BGR2YUV_I420);
+    EXPECT_THROW(color_space_nv12.GetColorConversionCode(color_space_nv12),improc::value_error);
+    EXPECT_THROW(color_space_nv12.GetColorConversionCode(color_space_i420),improc::key_error);
+    EXPECT_THROW(color_space_gray.GetColorConversionCode(color_space_i420),improc::key_error);
+    EXPECT_THROW(color_space_bgr.GetColorConversionCode(color_space_nv12) ,improc::key_error);
+}
+
+TEST(ColorSpace,TestHasColorConversionCode) {
+    static_assert(improc::ColorSpace(improc::ColorSpace::kBGR).HasColorConversionCode(improc::ColorSpace::kGray));
+    EXPECT_TRUE (improc::ColorSpace(improc::ColorSpace::kNV12).HasColorConversionCode(improc::ColorSpace(improc::ColorSpace::kRGB)));
+    EXPECT_FALSE(improc::ColorSpace(improc::ColorSpace::kBGR).HasColorConversionCode(improc::ColorSpace::kBGR));
+    EXPECT_FALSE(improc::ColorSpace(improc::ColorSpace::kGray).HasColorConversionCode(improc::ColorSpace::kI420));
+    EXPECT_FALSE(improc::ColorSpace(improc::ColorSpace::kHSV).HasColorConversionCode(improc::ColorSpace::kLab));
+}
+
+TEST(ColorSpace,TestHSVAndLab) {
+    improc::ColorSpace color_space_bgr {"bgr"};
+    improc::ColorSpace color_space_rgb {"rgb"};
+    improc::ColorSpace color_space_gray{"gray"};
+    improc::ColorSpace color_space_hsv {"hsv"};
+    improc::ColorSpace color_space_lab {"LAB"};
+    EXPECT_EQ(color_space_hsv,improc::ColorSpace::Value::kHSV);
+    EXPECT_EQ(color_space_lab,improc::ColorSpace::Value::kLab);
+    EXPECT_EQ(color_space_hsv.ToString(),"HSV");
+    EXPECT_EQ(color_space_lab.ToString(),"Lab");
+    EXPECT_EQ(color_space_hsv.GetNumberChannels(),3);
+    EXPECT_EQ(color_space_lab.GetNumberChannels(),3);
+    EXPECT_EQ(color_space_bgr.GetColorConversionCode(color_space_hsv),cv::COLOR_BGR2HSV);
+    EXPECT_EQ(color_space_rgb.GetColorConversionCode(color_space_lab),cv::COLOR_RGB2Lab);
+    EXPECT_EQ(color_space_hsv.GetColorConversionCode(color_space_rgb),cv::COLOR_HSV2RGB);
+    EXPECT_EQ(color_space_lab.GetColorConversionCode(color_space_bgr),cv::COLOR_Lab2BGR);
+    EXPECT_THROW(color_space_hsv.GetColorConversionCode(color_space_hsv) ,improc::value_error);
+    EXPECT_THROW(color_space_hsv.GetColorConversionCode(color_space_lab) ,improc::key_error);
+    EXPECT_THROW(color_space_gray.GetColorConversionCode(color_space_hsv),improc::key_error);
+}
\ No newline at end of file
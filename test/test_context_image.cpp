@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include <improc/corecv/context_image.hpp>
+
+TEST(ContextImage,TestGetDataFromImageData) {
+    const std::any kContextValue {cv::Mat(cv::Mat::ones(4,6,CV_8UC3))};
+    const cv::Mat& image_data = improc::ContextImage::GetData(kContextValue);
+    EXPECT_EQ(image_data.data,std::any_cast<const cv::Mat&>(kContextValue).data);
+    EXPECT_FALSE(improc::ContextImage::GetColorSpace(kContextValue).has_value());
+}
+
+TEST(ContextImage,TestGetDataFromImage) {
+    const std::any kContextValue {improc::Image(cv::Mat::ones(4,6,CV_8UC3))};
+    EXPECT_EQ(&improc::ContextImage::GetData(kContextValue),&std::any_cast<const improc::Image&>(kContextValue).get_data());
+    EXPECT_FALSE(improc::ContextImage::GetColorSpace(kContextValue).has_value());
+}
+
+TEST(ContextImage,TestGetDataFromColorSpaceImage) {
+    const std::any kContextValue {improc::ColorSpaceImage(cv::Mat::ones(4,6,CV_8UC3),improc::ColorSpace::Value::kBGR)};
+    EXPECT_EQ(&improc::ContextImage::GetData(kContextValue),&std::any_cast<const improc::ColorSpaceImage&>(kContextValue).get_data());
+    ASSERT_TRUE(improc::ContextImage::GetColorSpace(kContextValue).has_value());
+    EXPECT_EQ(improc::ContextImage::GetColorSpace(kContextValue).value(),improc::ColorSpace::Value::kBGR);
+}
+
+TEST(ContextImage,TestGetDataFromInvalidType) {
+    EXPECT_THROW(improc::ContextImage::GetData(std::any(1.0)),improc::not_supported_data_type);
+}
+
+TEST(ContextImage,TestSetReusesStoredImage) {
+    std::any context_value {improc::Image(cv::Mat::zeros(4,6,CV_8UC1))};
+    const improc::Image* kStoredImage = std::any_cast<improc::Image>(&context_value);
+
+    cv::Mat image_data = cv::Mat::ones(8,8,CV_8UC1);
+    const uchar* kData = image_data.data;
+    improc::ContextImage::Set(context_value,improc::Image(std::move(image_data)));
+    EXPECT_EQ(std::any_cast<improc::Image>(&context_value),kStoredImage);
+    EXPECT_EQ(kStoredImage->get_data().data,kData);
+    EXPECT_TRUE(image_data.empty());
+}
+
+TEST(ContextImage,TestSetData) {
+    std::any context_value {cv::Mat(cv::Mat::zeros(4,6,CV_8UC1))};
+    improc::ContextImage::SetData(context_value,cv::Mat::ones(4,6,CV_8UC3));
+    EXPECT_EQ(context_value.type(),typeid(improc::Image));
+
+    improc::ContextImage::SetData(context_value,cv::Mat::ones(4,6,CV_8UC1),improc::ColorSpace(improc::ColorSpace::Value::kGray));
+    ASSERT_EQ(context_value.type(),typeid(improc::ColorSpaceImage));
+    EXPECT_EQ(std::any_cast<const improc::ColorSpaceImage&>(context_value).get_color_space(),improc::ColorSpace::Value::kGray);
+}
+
+TEST(ContextImage,TestSetDataWithInvalidColorSpace) {
+    std::any context_value {};
+    EXPECT_THROW(improc::ContextImage::SetData(context_value,cv::Mat::ones(4,6,CV_8UC3),improc::ColorSpace(improc::ColorSpace::Value::kGray)),improc::value_error);
+}
\ No newline at end of file
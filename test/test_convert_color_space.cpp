@@ -57,6 +57,25 @@ TEST(ConvertColorSpace,TestWithoutFromColorSpaceInContext) {
     EXPECT_THROW(convert.Run(cntxt),improc::key_error);
 }
 
+TEST(ConvertColorSpace,TestWithoutFromColorSpaceWithColorSpaceImage) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_color_conversion_without_from.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousConvertColorSpace convert {};
+    convert.Load(json_content);
+
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",improc::ColorSpaceImage(cv::Mat::ones(10,5,CV_8UC3),improc::ColorSpace::kRGB));
+    const improc::ColorSpaceImage* kStoredImage = std::any_cast<improc::ColorSpaceImage>(&cntxt["image"]);
+
+    convert.Run(cntxt);
+
+    EXPECT_EQ(std::any_cast<improc::ColorSpaceImage>(&cntxt["image"]),kStoredImage);
+    EXPECT_EQ(kStoredImage->get_color_space(),improc::ColorSpace::kGray);
+    EXPECT_EQ(kStoredImage->get_data().channels(),1);
+}
+
 TEST(ConvertColorSpace,TestWithFromColorSpaceSingleConversion) {
     std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_single_color_conversion_with_from.json";
     improc::JsonFile json_file {filepath};
@@ -94,3 +113,48 @@ TEST(ConvertColorSpace,TestWithFromColorSpaceSequenceConversion) {
     EXPECT_EQ(image.get_color_space(),improc::ColorSpace::kGray);
     EXPECT_EQ(image.get_data().channels(),1);    
 }
+
+TEST(ConvertColorSpace,TestWithFromColorSpaceIdentitySequence) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_identity_color_conversion_with_from.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousConvertColorSpace convert {};
+    convert.Load(json_content);
+
+    cv::Mat             image_data       = cv::Mat::ones(10,5,CV_8UC3);
+    image_data.at<cv::Vec3b>(0,0)        = cv::Vec3b(1,2,3);
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",image_data);
+
+    convert.Run(cntxt);    
+
+    improc::ColorSpaceImage image = std::any_cast<improc::ColorSpaceImage>(cntxt.Get("image"));
+    EXPECT_EQ(image.get_color_space(),improc::ColorSpace::kRGB);
+    EXPECT_EQ(image.get_data().channels(),3);
+    EXPECT_EQ(cv::norm(image.get_data(),image_data,cv::NORM_L1),0);
+}
+
+TEST(ConvertColorSpace,TestLoadFromPlan) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_sequence_color_conversion_with_from.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousConvertColorSpace convert {};
+    convert.Load(json_content);
+    improc::PlanWriter plan_writer {};
+    convert.Save(plan_writer);
+
+    improc::PlanReader plan_reader {plan_writer.get_data()};
+    improc::StringKeyHeterogeneousConvertColorSpace plan_convert {};
+    plan_convert.Load(plan_reader);
+    EXPECT_TRUE(plan_reader.IsEnd());
+
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",cv::Mat(cv::Mat::ones(10,5,CV_8UC3)));
+    plan_convert.Run(cntxt);
+
+    improc::ColorSpaceImage image = std::any_cast<improc::ColorSpaceImage>(cntxt.Get("image"));
+    EXPECT_EQ(image.get_color_space(),improc::ColorSpace::kGray);
+    EXPECT_EQ(image.get_data().channels(),1);
+}
\ No newline at end of file
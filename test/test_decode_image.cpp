@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+
+#include <improc/services/decode_image.hpp>
+#include <improc/services/resize_image.hpp>
+#include <improc_corecv_test_config.hpp>
+
+namespace
+{
+    std::vector<uchar> Encode(const std::string& extension, const cv::Mat& image_data)
+    {
+        std::vector<uchar> encoded_data {};
+        cv::imencode(extension,image_data,encoded_data);
+        return encoded_data;
+    }
+
+    std::vector<uchar> AddExifOrientation(std::vector<uchar> encoded_data, uchar orientation)
+    {
+        // APP1 segment with a big-endian TIFF header and a single orientation entry
+        const std::vector<uchar> kExifSegment { 0xFF,0xE1,0x00,0x22,'E','x','i','f',0x00,0x00
+                                              , 'M','M',0x00,0x2A,0x00,0x00,0x00,0x08
+                                              , 0x00,0x01,0x01,0x12,0x00,0x03,0x00,0x00,0x00,0x01,0x00,orientation,0x00,0x00
+                                              , 0x00,0x00,0x00,0x00 };
+        encoded_data.insert(encoded_data.begin() + 2,kExifSegment.begin(),kExifSegment.end());
+        return encoded_data;
+    }
+}
+
+TEST(Decode,TestLoadInvalidColorSpace) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_decode_invalid_color_space.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousDecode decode {};
+    EXPECT_THROW(decode.Load(json_content),improc::json_error);
+}
+
+TEST(Decode,TestLoadWithSizeAndScale) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_decode_with_size_and_scale.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousDecode decode {};
+    EXPECT_THROW(decode.Load(json_content),improc::json_error);
+}
+
+TEST(Decode,TestDecode) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_decode.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousDecode decode {};
+    decode.Load(json_content);
+
+    const cv::Mat kImageData {60,80,CV_8UC3,cv::Scalar(10,20,30)};
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("encoded_image",Encode(".png",kImageData));
+    decode.Run(cntxt);
+
+    improc::Image image = std::any_cast<improc::Image>(cntxt["image"]);
+    EXPECT_EQ(image.get_data().size(),kImageData.size());
+    EXPECT_EQ(image.get_data().type(),CV_8UC3);
+    EXPECT_EQ(cv::norm(image.get_data(),kImageData,cv::NORM_INF),0);
+}
+
+TEST(Decode,TestDecodeFromImageData) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_decode.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousDecode decode {};
+    decode.Load(json_content);
+
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("encoded_image",cv::Mat(Encode(".png",cv::Mat::zeros(60,80,CV_8UC1))).clone());
+    decode.Run(cntxt);
+
+    improc::Image image = std::any_cast<improc::Image>(cntxt["image"]);
+    EXPECT_EQ(image.get_data().size(),cv::Size(80,60));
+    EXPECT_EQ(image.get_data().type(),CV_8UC3);
+}
+
+TEST(Decode,TestReducedDecodeWithSize) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_decode_with_size.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousDecode decode {};
+    decode.Load(json_content);
+
+    const cv::Mat kImageData {60,80,CV_8UC3,cv::Scalar(128,128,128)};
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("encoded_image",Encode(".jpg",kImageData));
+    decode.Run(cntxt);
+
+    improc::Image image = std::any_cast<improc::Image>(cntxt["image"]);
+    EXPECT_EQ(image.get_data().size(),cv::Size(20,15));
+    EXPECT_LE(cv::norm(image.get_data(),cv::Mat(15,20,CV_8UC3,cv::Scalar(128,128,128)),cv::NORM_INF),2);
+
+    improc::StringKeyHeterogeneousContext odd_size_cntxt {};
+    odd_size_cntxt.Add("encoded_image",Encode(".jpg",cv::Mat::zeros(60,79,CV_8UC3)));
+    decode.Run(odd_size_cntxt);
+    image = std::any_cast<improc::Image>(odd_size_cntxt["image"]);
+    EXPECT_EQ(image.get_data().size(),cv::Size(20,15));
+}
+
+TEST(Decode,TestReducedDecodeIgnoresExifOrientation) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_decode_with_size.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousDecode decode {};
+    decode.Load(json_content);
+
+    // Left half is black and right half is white. A rotation of 90 degrees would make them the top and bottom halves.
+    cv::Mat image_data {60,80,CV_8UC3,cv::Scalar::all(0)};
+    image_data(cv::Rect(40,0,40,60)).setTo(cv::Scalar::all(255));
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("encoded_image",AddExifOrientation(Encode(".jpg",image_data),6));
+    decode.Run(cntxt);
+
+    improc::Image image = std::any_cast<improc::Image>(cntxt["image"]);
+    ASSERT_EQ(image.get_data().size(),cv::Size(20,15));
+    EXPECT_LE(cv::norm(image.get_data()(cv::Rect(0 ,0,8,15)),cv::Mat(15,8,CV_8UC3,cv::Scalar::all(0))  ,cv::NORM_INF),8);
+    EXPECT_LE(cv::norm(image.get_data()(cv::Rect(12,0,8,15)),cv::Mat(15,8,CV_8UC3,cv::Scalar::all(255)),cv::NORM_INF),8);
+}
+
+TEST(Decode,TestReducedDecodeGrayWithScale) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_decode_gray_with_scale.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousDecode decode {};
+    decode.Load(json_content);
+
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("encoded_image",Encode(".jpg",cv::Mat::zeros(60,80,CV_8UC3)));
+    decode.Run(cntxt);
+
+    improc::Image image = std::any_cast<improc::Image>(cntxt["image"]);
+    EXPECT_EQ(image.get_data().size(),cv::Size(32,24));
+    EXPECT_EQ(image.get_data().type(),CV_8UC1);
+}
+
+TEST(Decode,TestFullDecodeAndResizeForPNG) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_decode_with_size.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousDecode decode {};
+    decode.Load(json_content);
+
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("encoded_image",Encode(".png",cv::Mat::zeros(60,80,CV_8UC3)));
+    decode.Run(cntxt);
+
+    improc::Image image = std::any_cast<improc::Image>(cntxt["image"]);
+    EXPECT_EQ(image.get_data().size(),cv::Size(20,15));
+}
+
+TEST(Decode,TestDecodeInvalidData) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_decode.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousDecode decode {};
+    decode.Load(json_content);
+
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("encoded_image",std::vector<uchar>());
+    EXPECT_THROW(decode.Run(cntxt),improc::value_error);
+    improc::StringKeyHeterogeneousContext invalid_cntxt {};
+    invalid_cntxt.Add("encoded_image",std::vector<uchar>(16,0));
+    EXPECT_THROW(decode.Run(invalid_cntxt),improc::value_error);
+}
+
+TEST(Decode,TestLoadFromPlan) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_decode_with_size.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousDecode decode {};
+    decode.Load(json_content);
+    improc::PlanWriter plan_writer {};
+    decode.Save(plan_writer);
+
+    improc::PlanReader plan_reader {plan_writer.get_data()};
+    improc::StringKeyHeterogeneousDecode plan_decode {};
+    plan_decode.Load(plan_reader);
+
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("encoded_image",Encode(".jpg",cv::Mat(60,80,CV_8UC3,cv::Scalar(128,128,128))));
+    plan_decode.Run(cntxt);
+    EXPECT_EQ(std::any_cast<improc::Image>(cntxt["image"]).get_data().size(),cv::Size(20,15));
+}
+
+TEST(Decode,TestDecodeWithScaleFollowedByResize) {
+    // Decoded image has the size given by the scale, so that the following resize is applied to it
+    improc::StringKeyHeterogeneousDecode decode {};
+    decode.Load(improc::JsonFile(std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_decode_gray_with_scale.json").Read());
+    improc::StringKeyHeterogeneousResize resize {};
+    resize.Load(improc::JsonFile(std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_resize_with_scale.json").Read());
+
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("encoded_image",Encode(".jpg",cv::Mat::zeros(60,80,CV_8UC3)));
+    decode.Run(cntxt);
+    resize.Run(cntxt);
+
+    improc::Image image = std::any_cast<improc::Image>(cntxt["image"]);
+    EXPECT_EQ(image.get_data().size(),cv::Size(16,48));
+}
\ No newline at end of file
@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+
+#include <improc/corecv/deferred_image.hpp>
+#include <improc/corecv/structures/resize_coefficients.hpp>
+#include <improc_corecv_test_utils.hpp>
+
+#include <opencv2/imgproc.hpp>
+
+namespace
+{
+    cv::Mat ConvertWithOpenCV(const cv::Mat& image, improc::ColorSpace::Value from_color_space, improc::ColorSpace::Value to_color_space)
+    {
+        cv::Mat converted_image {};
+        cv::cvtColor(image,converted_image,improc::ColorSpace(from_color_space).GetColorConversionCode(to_color_space));
+        return converted_image;
+    }
+
+    cv::Mat ResizeWithCoefficients(const cv::Mat& image, const cv::Size& to_image_size, improc::InterpolationType::Value interpolation)
+    {
+        cv::Mat resized_image {};
+        improc::ResizeCoefficients(image.size(),to_image_size,improc::InterpolationType(interpolation)).Apply(image,resized_image);
+        return resized_image;
+    }
+}
+
+TEST(DeferredImage,TestEmptyConstructor) {
+    improc::DeferredImage image {};
+    EXPECT_TRUE(image.get_image_size().empty());
+    EXPECT_EQ(image.get_color_space(),improc::ColorSpace::kRGB);
+    EXPECT_TRUE(image.get_operations().empty());
+}
+
+TEST(DeferredImage,TestInvalidConstructor) {
+    EXPECT_THROW(improc::DeferredImage(improc::ColorSpaceImage(cv::Mat::zeros(90,80,CV_8UC1),improc::ColorSpace::kNV12)),improc::value_error);
+    EXPECT_THROW(improc::DeferredImage(improc::ColorSpaceImage(cv::Mat(),improc::ColorSpace::kGray)),improc::value_error);
+}
+
+TEST(DeferredImage,TestRecordOperations) {
+    improc::DeferredImage image {improc::ColorSpaceImage(cv::Mat::zeros(60,80,CV_8UC3),improc::ColorSpace::kBGR)};
+    image.Crop(cv::Rect(10,5,40,30));
+    image.Rotate(improc::RotationType(improc::RotationType::k90Deg));
+    image.Resize(cv::Size2d(0.5,0.5),improc::InterpolationType(improc::InterpolationType::kLinear));
+    image.ConvertToColorSpace(improc::ColorSpace(improc::ColorSpace::kGray));
+    EXPECT_EQ(image.get_image_size(),cv::Size(15,20));
+    EXPECT_EQ(image.get_color_space(),improc::ColorSpace::kGray);
+    ASSERT_EQ(image.get_operations().size(),4);
+    EXPECT_EQ(image.get_operations()[0].type,improc::DeferredImage::OperationType::kCrop);
+    EXPECT_EQ(image.get_operations()[1].type,improc::DeferredImage::OperationType::kRotation);
+    EXPECT_EQ(image.get_operations()[2].type,improc::DeferredImage::OperationType::kResize);
+    EXPECT_EQ(image.get_operations()[2].image_size,cv::Size(15,20));
+    EXPECT_EQ(image.get_operations()[3].type,improc::DeferredImage::OperationType::kColorConversion);
+
+    // Operations that do not change the image are not recorded
+    image.Crop(cv::Rect(0,0,15,20));
+    image.Rotate(improc::RotationType(improc::RotationType::k0Deg));
+    image.Resize(cv::Size(15,20),improc::InterpolationType(improc::InterpolationType::kLinear));
+    image.ConvertToColorSpace(improc::ColorSpace(improc::ColorSpace::kGray));
+    EXPECT_EQ(image.get_operations().size(),4);
+}
+
+TEST(DeferredImage,TestRecordInvalidOperations) {
+    improc::DeferredImage image {improc::ColorSpaceImage(cv::Mat::zeros(60,80,CV_8UC1),improc::ColorSpace::kGray)};
+    EXPECT_THROW(image.Crop(cv::Rect(70,0,20,10)),improc::value_error);
+    EXPECT_THROW(image.Crop(cv::Rect(0,0,0,10)),improc::value_error);
+    EXPECT_THROW(image.Resize(cv::Size(0,10),improc::InterpolationType(improc::InterpolationType::kLinear)),improc::value_error);
+    EXPECT_THROW(image.ConvertToColorSpace(improc::ColorSpace(improc::ColorSpace::kNV12)),improc::value_error);
+    EXPECT_THROW(image.ConvertToColorSpace(improc::ColorSpace(improc::ColorSpace::kHSV)),improc::value_error);
+    EXPECT_TRUE(image.get_operations().empty());
+}
+
+TEST(DeferredImage,TestCropSharesImageData) {
+    const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(150,97),CV_8UC3);
+    improc::DeferredImage image {improc::ColorSpaceImage(kImage,improc::ColorSpace::kBGR)};
+    image.Crop(cv::Rect(20,10,100,80));
+    image.ConvertToColorSpace(improc::ColorSpace(improc::ColorSpace::kRGB));
+    image.Crop(cv::Rect(5,5,50,40));
+    image.ConvertToColorSpace(improc::ColorSpace(improc::ColorSpace::kBGR));
+    const improc::ColorSpaceImage kMaterializedImage = image.Materialize();
+    EXPECT_EQ(kMaterializedImage.get_color_space(),improc::ColorSpace::kBGR);
+    EXPECT_EQ(kMaterializedImage.get_data().data,kImage(cv::Rect(25,15,50,40)).data);
+    EXPECT_TRUE(image.get_operations().empty());
+}
+
+TEST(DeferredImage,TestMaterializeWithoutResize) {
+    const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(150,97),CV_8UC3);
+    improc::DeferredImage image {improc::ColorSpaceImage(kImage,improc::ColorSpace::kBGR)};
+    image.Crop(cv::Rect(7,3,130,90));
+    image.Rotate(improc::RotationType(improc::RotationType::k90Deg));
+    image.ConvertToColorSpace(improc::ColorSpace(improc::ColorSpace::kLab));
+    image.Crop(cv::Rect(11,2,70,100));
+    image.Rotate(improc::RotationType(improc::RotationType::k180Deg));
+
+    cv::Mat expected_image = improc::RotationType(improc::RotationType::k90Deg).Apply(kImage(cv::Rect(7,3,130,90)));
+    expected_image = ConvertWithOpenCV(expected_image,improc::ColorSpace::kBGR,improc::ColorSpace::kLab);
+    expected_image = improc::RotationType(improc::RotationType::k180Deg).Apply(expected_image(cv::Rect(11,2,70,100)));
+
+    const improc::ColorSpaceImage kMaterializedImage = image.Materialize();
+    EXPECT_EQ(kMaterializedImage.get_color_space(),improc::ColorSpace::kLab);
+    ASSERT_EQ(kMaterializedImage.get_data().size(),expected_image.size());
+    EXPECT_EQ(cv::norm(kMaterializedImage.get_data(),expected_image,cv::NORM_INF),0);
+}
+
+TEST(DeferredImage,TestMaterializeDownscale) {
+    // Conversions are moved after downscales when the result does not change
+    const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(211,157),CV_8UC4);
+    for (const improc::InterpolationType::Value interpolation : {improc::InterpolationType::kLinear,improc::InterpolationType::kNearest})
+    {
+        improc::DeferredImage image {improc::ColorSpaceImage(kImage,improc::ColorSpace::kBGRA)};
+        image.Crop(cv::Rect(9,13,180,140));
+        image.ConvertToColorSpace(improc::ColorSpace(improc::ColorSpace::kRGB));
+        image.Rotate(improc::RotationType(improc::RotationType::k270Deg));
+        image.Resize(cv::Size(61,83),improc::InterpolationType(interpolation));
+        image.Rotate(improc::RotationType(improc::RotationType::k90Deg));
+        image.ConvertToColorSpace(improc::ColorSpace(improc::ColorSpace::kHSV));
+
+        cv::Mat expected_image = ConvertWithOpenCV(kImage(cv::Rect(9,13,180,140)),improc::ColorSpace::kBGRA,improc::ColorSpace::kRGB);
+        expected_image = improc::RotationType(improc::RotationType::k270Deg).Apply(expected_image);
+        expected_image = ResizeWithCoefficients(expected_image,cv::Size(61,83),interpolation);
+        expected_image = improc::RotationType(improc::RotationType::k90Deg).Apply(expected_image);
+        expected_image = ConvertWithOpenCV(expected_image,improc::ColorSpace::kRGB,improc::ColorSpace::kHSV);
+
+        const improc::ColorSpaceImage kMaterializedImage = image.Materialize();
+        EXPECT_EQ(kMaterializedImage.get_color_space(),improc::ColorSpace::kHSV);
+        ASSERT_EQ(kMaterializedImage.get_data().size(),cv::Size(83,61));
+        EXPECT_EQ(cv::norm(kMaterializedImage.get_data(),expected_image,cv::NORM_INF),0);
+    }
+}
+
+TEST(DeferredImage,TestMaterializeUpscale) {
+    const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(53,41),CV_8UC1);
+    improc::DeferredImage image {improc::ColorSpaceImage(kImage,improc::ColorSpace::kGray)};
+    image.Resize(cv::Size2d(3.0,2.5),improc::InterpolationType(improc::InterpolationType::kLinear));
+    image.ConvertToColorSpace(improc::ColorSpace(improc::ColorSpace::kBGR));
+    image.ConvertToColorSpace(improc::ColorSpace(improc::ColorSpace::kLab));
+    image.Crop(cv::Rect(17,30,120,70));
+
+    cv::Mat expected_image = ResizeWithCoefficients(kImage,cv::Size(159,103),improc::InterpolationType::kLinear);
+    expected_image = ConvertWithOpenCV(expected_image,improc::ColorSpace::kGray,improc::ColorSpace::kBGR);
+    expected_image = ConvertWithOpenCV(expected_image,improc::ColorSpace::kBGR,improc::ColorSpace::kLab);
+    expected_image = expected_image(cv::Rect(17,30,120,70));
+
+    const improc::ColorSpaceImage kMaterializedImage = image.Materialize();
+    EXPECT_EQ(kMaterializedImage.get_color_space(),improc::ColorSpace::kLab);
+    EXPECT_EQ(cv::norm(kMaterializedImage.get_data(),expected_image,cv::NORM_INF),0);
+}
+
+TEST(DeferredImage,TestMaterializeUpscaleDroppingChannels) {
+    const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(37,29),CV_8UC4);
+    improc::DeferredImage image {improc::ColorSpaceImage(kImage,improc::ColorSpace::kBGRA)};
+    image.Resize(cv::Size(100,70),improc::InterpolationType(improc::InterpolationType::kLinear));
+    image.ConvertToColorSpace(improc::ColorSpace(improc::ColorSpace::kRGB));
+
+    cv::Mat expected_image = ResizeWithCoefficients(kImage,cv::Size(100,70),improc::InterpolationType::kLinear);
+    expected_image = ConvertWithOpenCV(expected_image,improc::ColorSpace::kBGRA,improc::ColorSpace::kRGB);
+
+    const improc::ColorSpaceImage kMaterializedImage = image.Materialize();
+    EXPECT_EQ(kMaterializedImage.get_color_space(),improc::ColorSpace::kRGB);
+    EXPECT_EQ(cv::norm(kMaterializedImage.get_data(),expected_image,cv::NORM_INF),0);
+}
+
+TEST(DeferredImage,TestMaterializeSeveralResizes) {
+    const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(160,120),CV_8UC3);
+    improc::DeferredImage image {improc::ColorSpaceImage(kImage,improc::ColorSpace::kRGB)};
+    image.Resize(cv::Size(100,75),improc::InterpolationType(improc::InterpolationType::kLinear));
+    image.ConvertToColorSpace(improc::ColorSpace(improc::ColorSpace::kGray));
+    image.Resize(cv::Size(50,40),improc::InterpolationType(improc::InterpolationType::kCubic));
+    image.Rotate(improc::RotationType(improc::RotationType::k90Deg));
+    image.Resize(cv::Size(20,25),improc::InterpolationType(improc::InterpolationType::kNearest));
+    image.Resize(cv::Size(30,30),improc::InterpolationType(improc::InterpolationType::kLinear));
+
+    cv::Mat expected_image = ResizeWithCoefficients(kImage,cv::Size(100,75),improc::InterpolationType::kLinear);
+    expected_image = ConvertWithOpenCV(expected_image,improc::ColorSpace::kRGB,improc::ColorSpace::kGray);
+    cv::resize(expected_image,expected_image,cv::Size(50,40),0,0,cv::INTER_CUBIC);
+    expected_image = improc::RotationType(improc::RotationType::k90Deg).Apply(expected_image);
+    expected_image = ResizeWithCoefficients(expected_image,cv::Size(20,25),improc::InterpolationType::kNearest);
+    expected_image = ResizeWithCoefficients(expected_image,cv::Size(30,30),improc::InterpolationType::kLinear);
+
+    const improc::ColorSpaceImage kMaterializedImage = image.Materialize();
+    EXPECT_EQ(kMaterializedImage.get_color_space(),improc::ColorSpace::kGray);
+    EXPECT_EQ(cv::norm(kMaterializedImage.get_data(),expected_image,cv::NORM_INF),0);
+}
+
+TEST(DeferredImage,TestMaterializeKeepsResult) {
+    const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(80,60),CV_8UC3);
+    improc::DeferredImage image {improc::ColorSpaceImage(kImage,improc::ColorSpace::kBGR)};
+    image.Rotate(improc::RotationType(improc::RotationType::k90Deg));
+    const improc::ColorSpaceImage kMaterializedImage = image.Materialize();
+    EXPECT_TRUE(image.get_operations().empty());
+    EXPECT_EQ(image.get_image_size(),cv::Size(60,80));
+    EXPECT_EQ(image.Materialize().get_data().data,kMaterializedImage.get_data().data);
+
+    image.Rotate(improc::RotationType(improc::RotationType::k270Deg));
+    EXPECT_EQ(cv::norm(image.Materialize().get_data(),kImage,cv::NORM_INF),0);
+}
\ No newline at end of file
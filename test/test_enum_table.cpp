@@ -0,0 +1,31 @@
+#include <gtest/gtest.h>
+
+#include <improc/corecv/structures/enum_table.hpp>
+
+namespace
+{
+    enum class Fruit {kApple,kPear};
+    static constexpr improc::EnumTable<Fruit,2> kFruitTable {{ {"apple",Fruit::kApple}
+                                                              , {"pear" ,Fruit::kPear }
+                                                              }};
+}
+
+TEST(EnumTable,TestTryParseAtCompileTime) {
+    static_assert(kFruitTable.TryParse("apple").value() == Fruit::kApple);
+    static_assert(kFruitTable.TryParse("PeAr").value()  == Fruit::kPear);
+    static_assert(kFruitTable.TryParse("pears").has_value() == false);
+    static_assert(kFruitTable.Parse("APPLE") == Fruit::kApple);
+}
+
+TEST(EnumTable,TestTryParse) {
+    const std::string kDescription = "Pear";
+    EXPECT_EQ(kFruitTable.TryParse(kDescription).value(),Fruit::kPear);
+    EXPECT_FALSE(kFruitTable.TryParse("").has_value());
+    EXPECT_FALSE(kFruitTable.TryParse("pea").has_value());
+    EXPECT_FALSE(kFruitTable.TryParse(std::string_view("pear\0",5)).has_value());
+}
+
+TEST(EnumTable,TestParse) {
+    EXPECT_EQ(kFruitTable.Parse("APPLE"),Fruit::kApple);
+    EXPECT_THROW(kFruitTable.Parse("banana"),std::out_of_range);
+}
\ No newline at end of file
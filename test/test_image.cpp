@@ -112,3 +112,132 @@ TEST(ColorSpaceImage,TestConvertToDifferentColorSpace) {
     EXPECT_EQ(image.get_data().channels(),1);
     EXPECT_EQ(image.get_color_space(),improc::ColorSpace::kGray);
 }
+
+TEST(ColorSpaceImage,TestYUVImageData) {
+    improc::ColorSpaceImage image {cv::Mat::zeros(45,40,CV_8UC1),improc::ColorSpace::kNV12};
+    EXPECT_EQ(image.get_color_space(),improc::ColorSpace::kNV12);
+    image.ConvertToColorSpace(improc::ColorSpace::kBGR);
+    EXPECT_EQ(image.get_data().size(),cv::Size(40,30));
+    EXPECT_EQ(image.get_data().channels(),3);
+}
+
+TEST(ColorSpaceImage,TestSetInvalidYUVImageSize) {
+    improc::ColorSpaceImage image {};
+    image.set_data(cv::Mat::zeros(44,40,CV_8UC1));
+    EXPECT_THROW(image.set_color_space(improc::ColorSpace::kNV12),improc::value_error);
+    image.set_data(cv::Mat::zeros(30,41,CV_8UC2));
+    EXPECT_THROW(image.set_color_space(improc::ColorSpace::kYUYV),improc::value_error);
+}
+
+TEST(ColorSpaceImage,TestSetInvalidYUVImageData) {
+    improc::ColorSpaceImage image {cv::Mat::zeros(45,40,CV_8UC1),improc::ColorSpace::kNV12};
+    EXPECT_THROW(image.set_data(cv::Mat::zeros(44,40,CV_8UC1)),improc::value_error);
+    EXPECT_THROW(image.set_data(cv::Mat::zeros(45,40,CV_8UC3)),improc::value_error);
+    EXPECT_EQ(image.get_data().size(),cv::Size(40,45));
+    image.set_data(cv::Mat::zeros(30,20,CV_8UC1));
+    EXPECT_EQ(image.get_data().size(),cv::Size(20,30));
+}
+
+TEST(ColorSpaceImage,TestResizeYUVImage) {
+    improc::ColorSpaceImage image {cv::Mat::zeros(45,40,CV_8UC1),improc::ColorSpace::kI420};
+    EXPECT_THROW(image.Resize(cv::Size(20,15),improc::InterpolationType(improc::InterpolationType::kLinear)),improc::value_error);
+    EXPECT_THROW(image.Resize(cv::Size2d(0.5,0.5),improc::InterpolationType(improc::InterpolationType::kLinear)),improc::value_error);
+    EXPECT_EQ(image.get_data().size(),cv::Size(40,45));
+
+    improc::ColorSpaceImage bgr_image {cv::Mat::zeros(30,40,CV_8UC3),improc::ColorSpace::kBGR};
+    bgr_image.Resize(cv::Size(20,15),improc::InterpolationType(improc::InterpolationType::kLinear));
+    EXPECT_EQ(bgr_image.get_data().size(),cv::Size(20,15));
+}
+
+
+TEST(TypedColorSpaceImage,TestEmptyImageConstructor) {
+    improc::TypedColorSpaceImage<improc::ColorSpace::kBGR> image_empty {};
+    EXPECT_TRUE(image_empty.get_data().empty());
+    EXPECT_EQ(image_empty.get_color_space(),improc::ColorSpace::kBGR);
+    EXPECT_EQ(improc::TypedColorSpaceImage<improc::ColorSpace::kBGR>::kNumberChannels,3);
+}
+
+TEST(TypedColorSpaceImage,TestImageDataConstructor) {
+    cv::Mat image_data = cv::Mat::ones(3,5,CV_8UC4);
+    improc::TypedColorSpaceImage<improc::ColorSpace::kRGBA> image {image_data};
+    image_data.at<cv::Vec4b>(0,0)[0] = 20;
+    EXPECT_EQ(image.get_data().at<cv::Vec4b>(0,0)[0],20);
+}
+
+TEST(TypedColorSpaceImage,TestSetInvalidImage) {
+    improc::TypedColorSpaceImage<improc::ColorSpace::kBGR> image {};
+    EXPECT_THROW(image.set_data(cv::Mat::zeros(10,10,CV_8UC1)),improc::value_error);
+    EXPECT_THROW(image.set_data(cv::Mat::zeros(10,10,CV_MAKETYPE(CV_16S,3))),improc::value_error);
+    EXPECT_THROW(improc::TypedColorSpaceImage<improc::ColorSpace::kGray>(cv::Mat::zeros(10,10,CV_8UC3)),improc::value_error);
+}
+
+TEST(TypedColorSpaceImage,TestSetInvalidYUVImage) {
+    EXPECT_NO_THROW(improc::TypedColorSpaceImage<improc::ColorSpace::kNV12>(cv::Mat::zeros(45,40,CV_8UC1)));
+    EXPECT_THROW(improc::TypedColorSpaceImage<improc::ColorSpace::kNV12>(cv::Mat::zeros(44,40,CV_8UC1)),improc::value_error);
+    EXPECT_THROW(improc::TypedColorSpaceImage<improc::ColorSpace::kI420>(cv::Mat::zeros(45,41,CV_8UC1)),improc::value_error);
+    EXPECT_THROW(improc::TypedColorSpaceImage<improc::ColorSpace::kYUYV>(cv::Mat::zeros(30,41,CV_8UC2)),improc::value_error);
+}
+
+TEST(TypedColorSpaceImage,TestNotConvertibleToImage) {
+    // Image data set through a reference to Image would not be checked
+    EXPECT_FALSE((std::is_convertible_v<improc::TypedColorSpaceImage<improc::ColorSpace::kBGR>&,improc::Image&>));
+}
+
+TEST(TypedColorSpaceImage,TestFromColorSpaceImage) {
+    improc::ColorSpaceImage color_space_image {cv::Mat::ones(3,5,CV_8UC3),improc::ColorSpace::kRGB};
+    improc::TypedColorSpaceImage<improc::ColorSpace::kRGB> image {color_space_image};
+    EXPECT_EQ(image.get_data().data,color_space_image.get_data().data);
+    EXPECT_THROW(improc::TypedColorSpaceImage<improc::ColorSpace::kBGR> {color_space_image},improc::value_error);
+}
+
+TEST(TypedColorSpaceImage,TestToColorSpaceImage) {
+    improc::TypedColorSpaceImage<improc::ColorSpace::kBGR> image {cv::Mat::ones(3,5,CV_8UC3)};
+    improc::ColorSpaceImage color_space_image = image.ToColorSpaceImage();
+    EXPECT_EQ(color_space_image.get_color_space(),improc::ColorSpace::kBGR);
+    EXPECT_EQ(color_space_image.get_data().data,image.get_data().data);
+}
+
+TEST(TypedColorSpaceImage,TestCloneImage) {
+    cv::Mat image_data = cv::Mat::ones(3,5,CV_8UC1);
+    improc::TypedColorSpaceImage<improc::ColorSpace::kGray> image {image_data};
+    improc::TypedColorSpaceImage<improc::ColorSpace::kGray> clone = image.Clone();
+    image_data.at<uint8_t>(0,0) = 20;
+    EXPECT_EQ(image.get_data().at<uint8_t>(0,0),20);
+    EXPECT_EQ(clone.get_data().at<uint8_t>(0,0),1);
+}
+
+TEST(TypedColorSpaceImage,TestConvertMatchesColorSpaceImage) {
+    cv::Mat image_data {31,17,CV_8UC3};
+    cv::randu(image_data,cv::Scalar::all(0),cv::Scalar::all(255));
+    improc::TypedColorSpaceImage<improc::ColorSpace::kBGR> image {image_data};
+
+    improc::TypedColorSpaceImage<improc::ColorSpace::kGray> gray_image = image.ConvertToColorSpace<improc::ColorSpace::kGray>();
+    improc::TypedColorSpaceImage<improc::ColorSpace::kRGBA> rgba_image = image.ConvertToColorSpace<improc::ColorSpace::kRGBA>();
+    for (const improc::ColorSpace& to_color_space : {improc::ColorSpace(improc::ColorSpace::kGray),improc::ColorSpace(improc::ColorSpace::kRGBA)})
+    {
+        improc::ColorSpaceImage expected_image {image_data,improc::ColorSpace::kBGR};
+        expected_image.ConvertToColorSpace(to_color_space);
+        const cv::Mat kImageData = to_color_space == improc::ColorSpace::kGray ? gray_image.get_data() : rgba_image.get_data();
+        EXPECT_EQ(kImageData.channels(),expected_image.get_data().channels());
+        EXPECT_EQ(cv::norm(kImageData,expected_image.get_data(),cv::NORM_INF),0);
+    }
+}
+
+TEST(Image,TestResizeToSize) {
+    improc::Image image {cv::Mat::ones(10,20,CV_8UC3)};
+    image.Resize(cv::Size(5,4),improc::InterpolationType(improc::InterpolationType::kLinear));
+    EXPECT_EQ(image.get_data().size(),cv::Size(5,4));
+}
+
+TEST(Image,TestResizeWithScale) {
+    improc::Image image {cv::Mat::ones(10,20,CV_8UC3)};
+    image.Resize(cv::Size2d(0.5,2.0),improc::InterpolationType(improc::InterpolationType::kNearest));
+    EXPECT_EQ(image.get_data().size(),cv::Size(10,20));
+}
+
+TEST(Image,TestResizeToSameSize) {
+    cv::Mat image_data = cv::Mat::ones(10,20,CV_8UC3);
+    improc::Image image {image_data};
+    image.Resize(cv::Size(20,10),improc::InterpolationType(improc::InterpolationType::kLinear));
+    EXPECT_EQ(image.get_data().data,image_data.data);
+}
\ No newline at end of file
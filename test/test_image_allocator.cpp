@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <improc/corecv/image.hpp>
+#include <improc/corecv/image_allocator.hpp>
+
+class ImageAllocatorTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            improc::ImageAllocator::get().Disable();
+            improc::ImageAllocator::get().ResetStatistics();
+        }
+
+        void TearDown() override {
+            improc::ImageAllocator::get().Disable();
+            improc::ImageAllocator::get().ResetStatistics();
+        }
+};
+
+TEST_F(ImageAllocatorTest,TestDisabledByDefault) {
+    EXPECT_FALSE(improc::ImageAllocator::get().IsEnabled());
+    cv::Mat image_data = improc::ImageAllocator::get().CreateMat(cv::Size(10,5),CV_8UC3);
+    EXPECT_EQ(image_data.allocator,nullptr);
+    EXPECT_EQ(improc::ImageAllocator::get().GetStatistics().misses,0);
+}
+
+TEST_F(ImageAllocatorTest,TestAlignedRows) {
+    improc::ImageAllocator::get().Enable();
+    cv::Mat image_data = improc::ImageAllocator::get().CreateMat(cv::Size(10,5),CV_8UC3);
+    EXPECT_EQ(image_data.rows,5);
+    EXPECT_EQ(image_data.cols,10);
+    EXPECT_EQ(image_data.step[0] % improc::ImageAllocator::kRowAlignment,0);
+    EXPECT_EQ(reinterpret_cast<size_t>(image_data.data) % improc::ImageAllocator::kRowAlignment,0);
+    EXPECT_EQ(reinterpret_cast<size_t>(image_data.ptr(1)) % improc::ImageAllocator::kRowAlignment,0);
+}
+
+TEST_F(ImageAllocatorTest,TestRecycleBuffers) {
+    improc::ImageAllocator::get().Enable();
+    uchar* buffer = nullptr;
+    {
+        cv::Mat image_data = improc::ImageAllocator::get().CreateMat(cv::Size(10,5),CV_8UC3);
+        buffer = image_data.data;
+    }
+    improc::ImageAllocator::Statistics statistics = improc::ImageAllocator::get().GetStatistics();
+    EXPECT_EQ(statistics.hits,0);
+    EXPECT_EQ(statistics.misses,1);
+    EXPECT_EQ(statistics.cached_buffers,1);
+
+    cv::Mat image_data = improc::ImageAllocator::get().CreateMat(cv::Size(10,5),CV_8UC3);
+    EXPECT_EQ(image_data.data,buffer);
+    statistics = improc::ImageAllocator::get().GetStatistics();
+    EXPECT_EQ(statistics.hits,1);
+    EXPECT_EQ(statistics.misses,1);
+    EXPECT_EQ(statistics.cached_buffers,0);
+}
+
+TEST_F(ImageAllocatorTest,TestRecycleOnLastImageRelease) {
+    improc::ImageAllocator::get().Enable();
+    cv::Mat image_data = improc::ImageAllocator::get().CreateMat(cv::Size(10,5),CV_8UC1);
+    improc::Image image {image_data};
+    image_data.release();
+    EXPECT_EQ(improc::ImageAllocator::get().GetStatistics().cached_buffers,0);
+    image = improc::Image();
+    EXPECT_EQ(improc::ImageAllocator::get().GetStatistics().cached_buffers,1);
+}
+
+TEST_F(ImageAllocatorTest,TestMaxCachedBytes) {
+    improc::ImageAllocator::get().Enable(0);
+    {
+        cv::Mat image_data = improc::ImageAllocator::get().CreateMat(cv::Size(10,5),CV_8UC1);
+    }
+    improc::ImageAllocator::Statistics statistics = improc::ImageAllocator::get().GetStatistics();
+    EXPECT_EQ(statistics.cached_buffers,0);
+    EXPECT_EQ(statistics.cached_bytes,0);
+}
+
+TEST_F(ImageAllocatorTest,TestSteadyStateClone) {
+    improc::ImageAllocator::get().Enable();
+    improc::Image image {cv::Mat::ones(10,20,CV_8UC3)};
+    for (int iteration = 0; iteration < 5; ++iteration)
+    {
+        improc::Image clone = image.Clone();
+        EXPECT_EQ(cv::norm(clone.get_data(),image.get_data(),cv::NORM_L1),0);
+    }
+    improc::ImageAllocator::Statistics statistics = improc::ImageAllocator::get().GetStatistics();
+    EXPECT_EQ(statistics.misses,1);
+    EXPECT_EQ(statistics.hits,4);
+}
+
+TEST_F(ImageAllocatorTest,TestClear) {
+    improc::ImageAllocator::get().Enable();
+    {
+        cv::Mat image_data = improc::ImageAllocator::get().CreateMat(cv::Size(10,5),CV_8UC1);
+    }
+    EXPECT_EQ(improc::ImageAllocator::get().GetStatistics().cached_buffers,1);
+    improc::ImageAllocator::get().Clear();
+    EXPECT_EQ(improc::ImageAllocator::get().GetStatistics().cached_buffers,0);
+    EXPECT_EQ(improc::ImageAllocator::get().GetStatistics().cached_bytes,0);
+}
\ No newline at end of file
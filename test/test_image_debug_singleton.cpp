@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <improc/corecv/image_debug_singleton.hpp>
+#include <improc/corecv/raw_image.hpp>
+#include <improc_corecv_test_config.hpp>
+
+#include <cstdio>
+#include <fstream>
+
+namespace
+{
+    std::string GetDebugFilepath(const std::string& filename)
+    {
+        return std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/" + filename;
+    }
+}
+
+TEST(ImageDebugSingleton,TestInvalidCapacity) {
+    EXPECT_THROW(improc::ImageDebugSingleton::get().Enable(0),improc::value_error);
+}
+
+TEST(ImageDebugSingleton,TestCaptureWhenDisabled) {
+    improc::ImageDebugSingleton::get().Disable();
+    improc::ImageDebugSingleton::get().ResetStatistics();
+    EXPECT_FALSE(improc::ImageDebugSingleton::get().IsEnabled());
+    EXPECT_FALSE(improc::ImageDebugSingleton::get().Capture(improc::Image(cv::Mat::zeros(4,4,CV_8UC3)),GetDebugFilepath("debug_disabled.png")));
+    EXPECT_EQ(improc::ImageDebugSingleton::get().GetStatistics().captured,0);
+}
+
+TEST(ImageDebugSingleton,TestCapture) {
+    const std::string kFilepath = GetDebugFilepath("debug_capture.png");
+    improc::ImageDebugSingleton::get().Enable();
+    improc::ImageDebugSingleton::get().ResetStatistics();
+    EXPECT_TRUE(improc::ImageDebugSingleton::get().IsEnabled());
+    EXPECT_TRUE(improc::ImageDebugSingleton::get().Capture(improc::Image(cv::Mat::zeros(4,4,CV_8UC3)),kFilepath,improc::ImageFormat(improc::ImageFormat::Value::kPNG)));
+    improc::ImageDebugSingleton::get().Flush();
+    improc::ImageDebugSingleton::get().Disable();
+
+    const improc::ImageDebugSingleton::Statistics kStatistics = improc::ImageDebugSingleton::get().GetStatistics();
+    EXPECT_EQ(kStatistics.captured,1);
+    EXPECT_EQ(kStatistics.written,1);
+    EXPECT_EQ(kStatistics.dropped,0);
+    EXPECT_EQ(kStatistics.failed,0);
+
+    std::ifstream debug_file {kFilepath,std::ios::binary | std::ios::ate};
+    EXPECT_TRUE(debug_file.is_open());
+    EXPECT_GT(debug_file.tellg(),0);
+    debug_file.close();
+    std::remove(kFilepath.c_str());
+}
+
+TEST(ImageDebugSingleton,TestCaptureRaw) {
+    const std::string kFilepath = GetDebugFilepath("debug_capture.raw");
+    improc::ImageDebugSingleton::get().Enable();
+    improc::ImageDebugSingleton::get().ResetStatistics();
+    EXPECT_TRUE(improc::ImageDebugSingleton::get().Capture(improc::Image(cv::Mat::ones(4,6,CV_8UC3)),kFilepath,improc::ImageFormat(improc::ImageFormat::Value::kRaw)));
+    improc::ImageDebugSingleton::get().Flush();
+    improc::ImageDebugSingleton::get().Disable();
+    EXPECT_EQ(improc::ImageDebugSingleton::get().GetStatistics().written,1);
+
+    const improc::Image kImage = improc::RawImage::Read(kFilepath);
+    EXPECT_EQ(kImage.get_data().size(),cv::Size(6,4));
+    EXPECT_EQ(kImage.get_data().at<cv::Vec3b>(3,5)[0],1);
+    std::remove(kFilepath.c_str());
+}
+
+TEST(ImageDebugSingleton,TestCaptureInvalidFilepath) {
+    improc::ImageDebugSingleton::get().Enable();
+    improc::ImageDebugSingleton::get().ResetStatistics();
+    EXPECT_TRUE(improc::ImageDebugSingleton::get().Capture(improc::Image(cv::Mat::zeros(4,4,CV_8UC3)),GetDebugFilepath("missing_folder/debug.png")));
+    improc::ImageDebugSingleton::get().Flush();
+    improc::ImageDebugSingleton::get().Disable();
+    EXPECT_EQ(improc::ImageDebugSingleton::get().GetStatistics().failed,1);
+}
+
+TEST(ImageDebugSingleton,TestBoundedQueue) {
+    const size_t kNumberCaptures = 100;
+    for (improc::ImageDebugSingleton::OverflowPolicy overflow_policy : { improc::ImageDebugSingleton::OverflowPolicy::kDropOldest
+                                                                       , improc::ImageDebugSingleton::OverflowPolicy::kDropNewest })
+    {
+        improc::ImageDebugSingleton::get().Enable(2,overflow_policy);
+        improc::ImageDebugSingleton::get().ResetStatistics();
+        const improc::Image kImage {cv::Mat::zeros(64,64,CV_8UC3)};
+        for (size_t capture_idx = 0; capture_idx < kNumberCaptures; ++capture_idx)
+        {
+            improc::ImageDebugSingleton::get().Capture(kImage,GetDebugFilepath("missing_folder/debug.png"));
+        }
+        improc::ImageDebugSingleton::get().Flush();
+        improc::ImageDebugSingleton::get().Disable();
+
+        const improc::ImageDebugSingleton::Statistics kStatistics = improc::ImageDebugSingleton::get().GetStatistics();
+        EXPECT_EQ(kStatistics.captured,kNumberCaptures);
+        EXPECT_EQ(kStatistics.written + kStatistics.failed + kStatistics.dropped,kNumberCaptures);
+    }
+}
\ No newline at end of file
@@ -16,9 +16,11 @@ TEST(ImageFormat,TestConstructorFromLowerString) {
     improc::ImageFormat image_format_png      {"png"};
     improc::ImageFormat image_format_jpeg     {"jpeg"};
     improc::ImageFormat image_format_jpeg2000 {"jpeg2000"};
+    improc::ImageFormat image_format_raw      {"raw"};
     EXPECT_EQ(image_format_png     ,improc::ImageFormat::Value::kPNG);
     EXPECT_EQ(image_format_jpeg    ,improc::ImageFormat::Value::kJPEG);
     EXPECT_EQ(image_format_jpeg2000,improc::ImageFormat::Value::kJPEG2000);
+    EXPECT_EQ(image_format_raw     ,improc::ImageFormat::Value::kRaw);
 }
 
 TEST(ImageFormat,TestConstructorFromUpperString) {
@@ -34,6 +36,13 @@ TEST(ImageFormat,TestInvalidImageFormatConstructor) {
     EXPECT_THROW(improc::ImageFormat image_format {"invalid"},std::out_of_range);
 }
 
+TEST(ImageFormat,TestTryParse) {
+    static_assert(improc::ImageFormat::TryParse("Jpeg2000").value() == improc::ImageFormat::Value::kJPEG2000);
+    EXPECT_EQ(improc::ImageFormat::TryParse(std::string("jpeg2000")).value(),improc::ImageFormat::Value::kJPEG2000);
+    EXPECT_FALSE(improc::ImageFormat::TryParse("invalid").has_value());
+    EXPECT_FALSE(improc::ImageFormat::TryParse("").has_value());
+}
+
 TEST(ImageFormat,TestConstructorFromClass) {
     EXPECT_EQ(improc::ImageFormat::kPNG     ,improc::ImageFormat::Value::kPNG);
     EXPECT_EQ(improc::ImageFormat::kJPEG    ,improc::ImageFormat::Value::kJPEG);
@@ -47,6 +56,7 @@ TEST(ImageFormat,TestToString) {
     EXPECT_EQ(image_format_png.ToString()     ,"PNG");
     EXPECT_EQ(image_format_jpeg.ToString()    ,"JPEG");
     EXPECT_EQ(image_format_jpeg2000.ToString(),"JPEG2000");
+    EXPECT_EQ(improc::ImageFormat(improc::ImageFormat::Value::kRaw).ToString(),"RAW");
 }
 
 TEST(ImageFormat,TestToOpenCV) {
@@ -56,4 +66,5 @@ TEST(ImageFormat,TestToOpenCV) {
     EXPECT_EQ(image_format_png.ToOpenCV()     ,".png");
     EXPECT_EQ(image_format_jpeg.ToOpenCV()    ,".jpg");
     EXPECT_EQ(image_format_jpeg2000.ToOpenCV(),".jp2");
+    EXPECT_THROW(improc::ImageFormat(improc::ImageFormat::Value::kRaw).ToOpenCV(),improc::key_error);
 }
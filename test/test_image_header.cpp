@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <improc/corecv/parsers/image_header.hpp>
+
+#include <opencv2/imgcodecs.hpp>
+
+TEST(ImageHeader,TestReadJPEG) {
+    std::vector<uchar> encoded_data {};
+    cv::imencode(".jpg",cv::Mat::zeros(30,40,CV_8UC3),encoded_data);
+    std::optional<improc::ImageHeader> image_header = improc::ImageHeader::Read(encoded_data.data(),encoded_data.size());
+    ASSERT_TRUE(image_header.has_value());
+    EXPECT_EQ(image_header.value().image_format,improc::ImageFormat::Value::kJPEG);
+    EXPECT_EQ(image_header.value().image_size,cv::Size(40,30));
+}
+
+TEST(ImageHeader,TestReadJPEGWithApplicationSegment) {
+    const std::vector<uchar> kEncodedData { 0xFF,0xD8
+                                          , 0xFF,0xE0,0x00,0x04,0x00,0x00
+                                          , 0xFF,0xFF,0xC2,0x00,0x0B,0x08,0x01,0x2C,0x01,0x90,0x01,0x01,0x11,0x00
+                                          , 0xFF,0xD9 };
+    std::optional<improc::ImageHeader> image_header = improc::ImageHeader::Read(kEncodedData.data(),kEncodedData.size());
+    ASSERT_TRUE(image_header.has_value());
+    EXPECT_EQ(image_header.value().image_format,improc::ImageFormat::Value::kJPEG);
+    EXPECT_EQ(image_header.value().image_size,cv::Size(400,300));
+}
+
+TEST(ImageHeader,TestReadPNG) {
+    std::vector<uchar> encoded_data {};
+    cv::imencode(".png",cv::Mat::zeros(30,40,CV_8UC1),encoded_data);
+    std::optional<improc::ImageHeader> image_header = improc::ImageHeader::Read(cv::Mat(encoded_data));
+    ASSERT_TRUE(image_header.has_value());
+    EXPECT_EQ(image_header.value().image_format,improc::ImageFormat::Value::kPNG);
+    EXPECT_EQ(image_header.value().image_size,cv::Size(40,30));
+}
+
+TEST(ImageHeader,TestReadJPEG2000Codestream) {
+    const std::vector<uchar> kEncodedData { 0xFF,0x4F,0xFF,0x51,0x00,0x29,0x00,0x00
+                                          , 0x00,0x00,0x01,0x90,0x00,0x00,0x01,0x2C
+                                          , 0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x0C };
+    std::optional<improc::ImageHeader> image_header = improc::ImageHeader::Read(kEncodedData.data(),kEncodedData.size());
+    ASSERT_TRUE(image_header.has_value());
+    EXPECT_EQ(image_header.value().image_format,improc::ImageFormat::Value::kJPEG2000);
+    EXPECT_EQ(image_header.value().image_size,cv::Size(390,288));
+}
+
+TEST(ImageHeader,TestReadJPEG2000File) {
+    const std::vector<uchar> kEncodedData { 0x00,0x00,0x00,0x0C,'j','P',' ',' ',0x0D,0x0A,0x87,0x0A
+                                          , 0x00,0x00,0x00,0x14,'f','t','y','p','j','p','2',' ',0x00,0x00,0x00,0x00,'j','p','2',' '
+                                          , 0x00,0x00,0x00,0x1E,'j','p','2','h'
+                                          , 0x00,0x00,0x00,0x16,'i','h','d','r',0x00,0x00,0x01,0x2C,0x00,0x00,0x01,0x90,0x00,0x03,0x07,0x07,0x00,0x00 };
+    std::optional<improc::ImageHeader> image_header = improc::ImageHeader::Read(kEncodedData.data(),kEncodedData.size());
+    ASSERT_TRUE(image_header.has_value());
+    EXPECT_EQ(image_header.value().image_format,improc::ImageFormat::Value::kJPEG2000);
+    EXPECT_EQ(image_header.value().image_size,cv::Size(400,300));
+}
+
+TEST(ImageHeader,TestReadInvalidData) {
+    const std::vector<uchar> kUnknownData   {0x00,0x01,0x02,0x03};
+    const std::vector<uchar> kTruncatedJPEG {0xFF,0xD8,0xFF,0xC0,0x00,0x11};
+    EXPECT_FALSE(improc::ImageHeader::Read(nullptr,0).has_value());
+    EXPECT_FALSE(improc::ImageHeader::Read(kUnknownData.data(),kUnknownData.size()).has_value());
+    EXPECT_FALSE(improc::ImageHeader::Read(kTruncatedJPEG.data(),kTruncatedJPEG.size()).has_value());
+    EXPECT_FALSE(improc::ImageHeader::Read(cv::Mat()).has_value());
+}
\ No newline at end of file
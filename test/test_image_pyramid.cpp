@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <improc/corecv/structures/image_pyramid.hpp>
+#include <improc_corecv_test_utils.hpp>
+
+#include <opencv2/imgproc.hpp>
+
+#include <thread>
+
+TEST(ImagePyramid,TestEmptyConstructor) {
+    improc::ImagePyramid pyramid {};
+    EXPECT_EQ(pyramid.get_number_levels(),0);
+    EXPECT_EQ(pyramid.get_downsampling(),improc::ImagePyramid::Downsampling::kGaussian);
+    EXPECT_FALSE(pyramid.get_color_space().has_value());
+    EXPECT_THROW(pyramid.GetLevelData(0),improc::value_error);
+}
+
+TEST(ImagePyramid,TestMaxNumberLevels) {
+    EXPECT_EQ(improc::ImagePyramid::GetMaxNumberLevels(cv::Size())     ,0);
+    EXPECT_EQ(improc::ImagePyramid::GetMaxNumberLevels(cv::Size(1,1))  ,1);
+    EXPECT_EQ(improc::ImagePyramid::GetMaxNumberLevels(cv::Size(2,1))  ,2);
+    EXPECT_EQ(improc::ImagePyramid::GetMaxNumberLevels(cv::Size(80,60)),8);
+}
+
+TEST(ImagePyramid,TestInvalidConstructor) {
+    EXPECT_THROW(improc::ImagePyramid(improc::Image(),2),improc::value_error);
+    EXPECT_THROW(improc::ImagePyramid(improc::Image(cv::Mat::zeros(60,80,CV_8UC1)),0),improc::value_error);
+    EXPECT_THROW(improc::ImagePyramid(improc::Image(cv::Mat::zeros(60,80,CV_8UC1)),9),improc::value_error);
+    EXPECT_THROW(improc::ImagePyramid(improc::ColorSpaceImage(cv::Mat::zeros(90,80,CV_8UC1),improc::ColorSpace::kNV12),2),improc::value_error);
+}
+
+TEST(ImagePyramid,TestLevelSizes) {
+    improc::ImagePyramid pyramid {improc::Image(cv::Mat::zeros(61,80,CV_8UC3)),4};
+    EXPECT_EQ(pyramid.get_number_levels(),4);
+    EXPECT_EQ(pyramid.GetLevelSize(0),cv::Size(80,61));
+    EXPECT_EQ(pyramid.GetLevelSize(1),cv::Size(40,31));
+    EXPECT_EQ(pyramid.GetLevelSize(3),cv::Size(10,8));
+    EXPECT_THROW(pyramid.GetLevelSize(4),improc::value_error);
+    EXPECT_FALSE(pyramid.IsLevelCached(3));
+}
+
+TEST(ImagePyramid,TestGaussianMatchesOpenCV) {
+    const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(80,61),CV_8UC3);
+    improc::ImagePyramid pyramid {improc::Image(kImage),4};
+    EXPECT_EQ(pyramid.GetLevelData(0).data,kImage.data);
+
+    // Computing the coarsest level caches the finer ones
+    const cv::Mat kLevelData = pyramid.GetLevelData(3);
+    EXPECT_TRUE(pyramid.IsLevelCached(1));
+    EXPECT_TRUE(pyramid.IsLevelCached(2));
+
+    cv::Mat expected_level_data = kImage;
+    for (size_t level_idx = 1; level_idx < pyramid.get_number_levels(); ++level_idx)
+    {
+        cv::pyrDown(expected_level_data,expected_level_data);
+        EXPECT_EQ(pyramid.GetLevelData(level_idx).size(),expected_level_data.size());
+        EXPECT_EQ(cv::norm(pyramid.GetLevelData(level_idx),expected_level_data,cv::NORM_INF),0);
+    }
+    EXPECT_EQ(pyramid.GetLevelData(3).data,kLevelData.data);
+}
+
+TEST(ImagePyramid,TestAreaMatchesOpenCV) {
+    const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(64,48),CV_8UC1);
+    improc::ImagePyramid pyramid {improc::Image(kImage),3,improc::ImagePyramid::Downsampling::kArea};
+    EXPECT_EQ(pyramid.get_downsampling(),improc::ImagePyramid::Downsampling::kArea);
+
+    cv::Mat expected_level_data = kImage;
+    for (size_t level_idx = 1; level_idx < pyramid.get_number_levels(); ++level_idx)
+    {
+        cv::resize(expected_level_data,expected_level_data,pyramid.GetLevelSize(level_idx),0,0,cv::INTER_AREA);
+        EXPECT_EQ(cv::norm(pyramid.GetLevel(level_idx).get_data(),expected_level_data,cv::NORM_INF),0);
+    }
+}
+
+TEST(ImagePyramid,TestColorSpaceLevels) {
+    improc::ImagePyramid pyramid {improc::ColorSpaceImage(cv::Mat::zeros(60,80,CV_8UC4),improc::ColorSpace::kBGRA),3};
+    EXPECT_EQ(pyramid.get_color_space().value(),improc::ColorSpace::kBGRA);
+    improc::ColorSpaceImage level = pyramid.GetColorSpaceLevel(2);
+    EXPECT_EQ(level.get_color_space(),improc::ColorSpace::kBGRA);
+    EXPECT_EQ(level.get_data().size(),cv::Size(20,15));
+
+    improc::ImagePyramid pyramid_without_color_space {improc::Image(cv::Mat::zeros(60,80,CV_8UC4)),3};
+    EXPECT_THROW(pyramid_without_color_space.GetColorSpaceLevel(1),improc::processing_flow_error);
+}
+
+TEST(ImagePyramid,TestMoveKeepsLevels) {
+    static_assert(std::is_copy_constructible_v<improc::ImagePyramid> == false);
+    static_assert(std::is_nothrow_move_constructible_v<improc::ImagePyramid> == true);
+    improc::ImagePyramid pyramid {improc::Image(improc::test::CreateRandomImage(cv::Size(80,60),CV_8UC1)),3};
+    const uchar* kLevelData = pyramid.GetLevelData(2).data;
+
+    improc::ImagePyramid moved_pyramid {std::move(pyramid)};
+    EXPECT_EQ(moved_pyramid.get_number_levels(),3);
+    EXPECT_TRUE(moved_pyramid.IsLevelCached(2));
+    EXPECT_EQ(moved_pyramid.GetLevelData(2).data,kLevelData);
+}
+
+TEST(ImagePyramid,TestConcurrentReaders) {
+    const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(320,240),CV_8UC3);
+    improc::ImagePyramid pyramid {improc::Image(kImage),5};
+    std::vector<const uchar*> level_data (8,nullptr);
+    std::vector<std::thread> threads {};
+    for (size_t thread_idx = 0; thread_idx < level_data.size(); ++thread_idx)
+    {
+        threads.emplace_back([&pyramid,&level_data,thread_idx] ()
+        {
+            level_data[thread_idx] = pyramid.GetLevelData(4 - thread_idx % 2).data;
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    for (size_t thread_idx = 0; thread_idx < level_data.size(); ++thread_idx)
+    {
+        EXPECT_EQ(level_data[thread_idx],pyramid.GetLevelData(4 - thread_idx % 2).data);
+    }
+}
\ No newline at end of file
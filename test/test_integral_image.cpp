@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <improc/corecv/structures/integral_image.hpp>
+#include <improc_corecv_test_utils.hpp>
+
+#include <opencv2/imgproc.hpp>
+
+#include <limits>
+
+TEST(IntegralImage,TestEmptyConstructor) {
+    improc::IntegralImage integral_image {};
+    EXPECT_EQ(integral_image.GetImageSize(),cv::Size());
+    EXPECT_FALSE(integral_image.HasSquareSum());
+}
+
+TEST(IntegralImage,TestIsSupported) {
+    EXPECT_TRUE (improc::IntegralImage::IsSupported(CV_8UC1));
+    EXPECT_FALSE(improc::IntegralImage::IsSupported(CV_8UC3));
+    EXPECT_FALSE(improc::IntegralImage::IsSupported(CV_32FC1));
+}
+
+TEST(IntegralImage,TestInvalidImage) {
+    EXPECT_THROW(improc::IntegralImage(cv::Mat()),improc::value_error);
+    EXPECT_THROW(improc::IntegralImage(cv::Mat::zeros(10,10,CV_8UC3)),improc::value_error);
+}
+
+TEST(IntegralImage,TestMatchesOpenCV) {
+    for (int number_threads : {1,4})
+    {
+        const int kPreviousNumberThreads = cv::getNumThreads();
+        cv::setNumThreads(number_threads);
+        const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(97,61),CV_8UC1);
+        improc::IntegralImage integral_image {kImage,true};
+        cv::setNumThreads(kPreviousNumberThreads);
+
+        cv::Mat expected_sum {};
+        cv::Mat expected_square_sum {};
+        cv::integral(kImage,expected_sum,expected_square_sum,CV_32S,CV_64F);
+        cv::Mat square_sum {};
+        integral_image.get_square_sum().convertTo(square_sum,CV_64F);
+        EXPECT_EQ(integral_image.GetImageSize(),kImage.size());
+        EXPECT_TRUE(integral_image.HasSquareSum());
+        EXPECT_EQ(cv::norm(integral_image.get_sum(),expected_sum,cv::NORM_INF),0);
+        EXPECT_EQ(cv::norm(square_sum,expected_square_sum,cv::NORM_INF),0);
+    }
+}
+
+TEST(IntegralImage,TestWindowSums) {
+    const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(64,48),CV_8UC1);
+    improc::IntegralImage integral_image {kImage,true};
+    const cv::Rect kWindow {5,7,20,13};
+    cv::Mat square_image {};
+    kImage(kWindow).convertTo(square_image,CV_64F);
+    EXPECT_EQ(integral_image.GetSum(kWindow),static_cast<uint32_t>(cv::sum(kImage(kWindow))[0]));
+    EXPECT_EQ(integral_image.GetSquareSum(kWindow),static_cast<uint32_t>(square_image.dot(square_image)));
+}
+
+TEST(IntegralImage,TestWindowSumsAfterOverflow) {
+    // Table entries wrap around, window sums stay exact
+    const cv::Mat kImage {cv::Size(4200,4200),CV_8UC1,cv::Scalar::all(255)};
+    improc::IntegralImage integral_image {kImage};
+    const cv::Rect kWindow = integral_image.GetCenteredWindow(4100,4100,cv::Size(15,15));
+    EXPECT_EQ(kWindow,cv::Rect(4093,4093,15,15));
+    EXPECT_EQ(integral_image.GetSum(kWindow),255u * 15 * 15);
+}
+
+TEST(IntegralImage,TestSquareSumAtMaxArea) {
+    const cv::Mat kImage {cv::Size(improc::IntegralImage::kMaxSquareSumArea,1),CV_8UC1,cv::Scalar::all(255)};
+    improc::IntegralImage integral_image {kImage,true};
+    EXPECT_EQ(integral_image.GetSquareSum(cv::Rect(0,0,kImage.cols,1)),255u * 255u * improc::IntegralImage::kMaxSquareSumArea);
+    EXPECT_GT(uint64_t(255) * 255 * (improc::IntegralImage::kMaxSquareSumArea + 1),std::numeric_limits<uint32_t>::max());
+    EXPECT_GT(uint64_t(255) * (uint64_t(improc::IntegralImage::kMaxSumArea) + 1),std::numeric_limits<uint32_t>::max());
+}
+
+TEST(IntegralImage,TestCenteredWindowIsClipped) {
+    improc::IntegralImage integral_image {cv::Mat::zeros(10,20,CV_8UC1)};
+    EXPECT_EQ(integral_image.GetCenteredWindow(5,10,cv::Size(5,3)),cv::Rect(8,4,5,3));
+    EXPECT_EQ(integral_image.GetCenteredWindow(0,0,cv::Size(5,3)) ,cv::Rect(0,0,3,2));
+    EXPECT_EQ(integral_image.GetCenteredWindow(9,19,cv::Size(5,3)),cv::Rect(17,8,3,2));
+}
+
+TEST(IntegralImage,TestBoxFilterMatchesOpenCV) {
+    const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(64,48),CV_8UC1);
+    improc::IntegralImage integral_image {kImage};
+    cv::Mat mean_image {};
+    integral_image.BoxFilter(cv::Size(7,5),mean_image);
+
+    cv::Mat expected_image {};
+    cv::blur(kImage,expected_image,cv::Size(7,5));
+    const cv::Rect kInterior {3,2,kImage.cols - 6,kImage.rows - 4};
+    EXPECT_EQ(mean_image.type(),CV_8UC1);
+    EXPECT_LE(cv::norm(mean_image(kInterior),expected_image(kInterior),cv::NORM_INF),1);
+}
+
+TEST(IntegralImage,TestBoxFilterErrors) {
+    cv::Mat mean_image {};
+    EXPECT_THROW(improc::IntegralImage().BoxFilter(cv::Size(3,3),mean_image),improc::processing_flow_error);
+    EXPECT_THROW(improc::IntegralImage(cv::Mat::zeros(10,10,CV_8UC1)).BoxFilter(cv::Size(0,3),mean_image),improc::value_error);
+    EXPECT_THROW(improc::IntegralImage(cv::Mat::zeros(10,10,CV_8UC1)).BoxFilter(cv::Size(4200,4200),mean_image),improc::value_error);
+}
\ No newline at end of file
@@ -34,6 +34,13 @@ TEST(InterpolationType,TestInvalidInterpolationConstructor) {
     EXPECT_THROW(improc::InterpolationType interpolation {"invalid"},std::out_of_range);
 }
 
+TEST(InterpolationType,TestTryParse) {
+    static_assert(improc::InterpolationType::TryParse("Cubic").value() == improc::InterpolationType::Value::kCubic);
+    EXPECT_EQ(improc::InterpolationType::TryParse(std::string("cubic")).value(),improc::InterpolationType::Value::kCubic);
+    EXPECT_FALSE(improc::InterpolationType::TryParse("invalid").has_value());
+    EXPECT_FALSE(improc::InterpolationType::TryParse("").has_value());
+}
+
 TEST(InterpolationType,TestConstructorFromClass) {
     EXPECT_EQ(improc::InterpolationType::kLinear ,improc::InterpolationType::Value::kLinear);
     EXPECT_EQ(improc::InterpolationType::kCubic  ,improc::InterpolationType::Value::kCubic);
@@ -30,6 +30,13 @@ TEST(KernelShape,TestInvalidThresholdConstructor) {
     EXPECT_THROW(improc::KernelShape kernel {"invalid"},std::out_of_range);
 }
 
+TEST(KernelShape,TestTryParse) {
+    static_assert(improc::KernelShape::TryParse("Ellipse").value() == improc::KernelShape::Value::kEllipse);
+    EXPECT_EQ(improc::KernelShape::TryParse(std::string("ellipse")).value(),improc::KernelShape::Value::kEllipse);
+    EXPECT_FALSE(improc::KernelShape::TryParse("invalid").has_value());
+    EXPECT_FALSE(improc::KernelShape::TryParse("").has_value());
+}
+
 TEST(KernelShape,TestConstructorFromClass) {
     EXPECT_EQ(improc::KernelShape::kRectangle,improc::KernelShape::Value::kRectangle);
     EXPECT_EQ(improc::KernelShape::kEllipse  ,improc::KernelShape::Value::kEllipse);
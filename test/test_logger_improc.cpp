@@ -1,6 +1,12 @@
 #include <gtest/gtest.h>
 
 #include <improc/corecv/logger_improc.hpp>
+#include <improc/corecv/async_ring_buffer_sink.hpp>
+
+#include <spdlog/sinks/ostream_sink.h>
+
+#include <sstream>
+#include <thread>
 
 TEST(LoggerCoreCv,TestLoggerLogging) {
     EXPECT_NE(improc::ImageProcLogger::get()->data(),nullptr);
@@ -11,3 +17,95 @@ TEST(LoggerCoreCv,TestLoggerLogging) {
     IMPROC_CORECV_LOGGER_WARN ("Test {} {}",5,6);
     IMPROC_CORECV_LOGGER_CRITICAL("Test {} {}",6,7);
 }
+
+
+TEST(LoggerCoreCv,TestThreadLogger) {
+    EXPECT_EQ(improc::ImageProcLogger::GetThreadLogger(),improc::ImageProcLogger::get()->data().get());
+    spdlog::logger* thread_logger = nullptr;
+    std::thread([&thread_logger] () -> void {thread_logger = improc::ImageProcLogger::GetThreadLogger();}).join();
+    EXPECT_EQ(thread_logger,improc::ImageProcLogger::get()->data().get());
+}
+
+TEST(LoggerCoreCv,TestReloadThreadLoggers) {
+    const spdlog::logger* kThreadLogger = improc::ImageProcLogger::GetThreadLogger();
+    improc::ImageProcLogger::ReloadThreadLoggers();
+    EXPECT_EQ(improc::ImageProcLogger::GetThreadLogger(),kThreadLogger);
+    EXPECT_EQ(improc::ImageProcLogger::GetThreadLogger(),improc::ImageProcLogger::get()->data().get());
+}
+
+TEST(LoggerCoreCv,TestArgumentsNotEvaluatedBelowLevel) {
+    const spdlog::level::level_enum kLevel = improc::ImageProcLogger::get()->data()->level();
+    improc::ImageProcLogger::get()->data()->set_level(spdlog::level::off);
+    int number_evaluations = 0;
+    IMPROC_CORECV_LOGGER_CRITICAL("Test {}",++number_evaluations);
+    EXPECT_EQ(number_evaluations,0);
+    improc::ImageProcLogger::get()->data()->set_level(kLevel);
+}
+
+TEST(AsyncRingBufferSink,TestInvalidCapacity) {
+    EXPECT_THROW(improc::AsyncRingBufferSink({},0)  ,improc::value_error);
+    EXPECT_THROW(improc::AsyncRingBufferSink({},100),improc::value_error);
+}
+
+TEST(AsyncRingBufferSink,TestWritesRecords) {
+    std::ostringstream log_stream {};
+    spdlog::logger logger {"ring_buffer_test",std::make_shared<spdlog::sinks::ostream_sink_mt>(log_stream)};
+    logger.set_pattern("%n %v");
+    logger.set_level(spdlog::level::trace);
+    std::shared_ptr<improc::AsyncRingBufferSink> ring_buffer_sink = improc::AsyncRingBufferSink::Install(logger,1024);
+    EXPECT_EQ(ring_buffer_sink->get_capacity(),1024);
+
+    std::vector<std::thread> threads {};
+    for (int thread_idx = 0; thread_idx < 4; ++thread_idx)
+    {
+        threads.emplace_back([&logger,thread_idx] () -> void
+                             {
+                                 for (int record_idx = 0; record_idx < 100; ++record_idx)
+                                 {
+                                     logger.trace("Record {} {}",thread_idx,record_idx);
+                                 }
+                             });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    logger.flush();
+
+    const std::string kLog = log_stream.str();
+    EXPECT_EQ(static_cast<size_t>(std::count(kLog.begin(),kLog.end(),'\n')) + ring_buffer_sink->get_dropped_records(),400);
+    EXPECT_NE(kLog.find("ring_buffer_test Record"),std::string::npos);
+}
+
+TEST(AsyncRingBufferSink,TestTruncatesLongRecords) {
+    std::ostringstream log_stream {};
+    spdlog::logger logger {"ring_buffer_test",std::make_shared<spdlog::sinks::ostream_sink_mt>(log_stream)};
+    logger.set_pattern("%v");
+    improc::AsyncRingBufferSink::Install(logger,2);
+    logger.info(std::string(2 * improc::AsyncRingBufferSink::kMaxRecordSize,'a'));
+    logger.flush();
+    EXPECT_LT(log_stream.str().size(),improc::AsyncRingBufferSink::kMaxRecordSize);
+    EXPECT_GT(log_stream.str().size(),0);
+}
+
+
+TEST(AsyncRingBufferSink,TestSetPatternWhileLogging) {
+    std::ostringstream log_stream {};
+    spdlog::logger logger {"ring_buffer_test",std::make_shared<spdlog::sinks::ostream_sink_mt>(log_stream)};
+    logger.set_pattern("%v");
+    improc::AsyncRingBufferSink::Install(logger,1024);
+    std::thread logging_thread {[&logger] () -> void
+                                {
+                                    for (int record_idx = 0; record_idx < 500; ++record_idx)
+                                    {
+                                        logger.info("Record {}",record_idx);
+                                    }
+                                }};
+    for (int pattern_idx = 0; pattern_idx < 50; ++pattern_idx)
+    {
+        logger.set_pattern(pattern_idx % 2 == 0 ? "%n %v" : "%v");
+    }
+    logging_thread.join();
+    logger.flush();
+    EXPECT_NE(log_stream.str().find("Record"),std::string::npos);
+}
\ No newline at end of file
@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+
+#include <improc/corecv/kernels/luminance_threshold.hpp>
+#include <improc_corecv_test_utils.hpp>
+
+#include <opencv2/imgproc.hpp>
+
+#include <cmath>
+
+namespace
+{
+    cv::Mat ConvertToGray(const cv::Mat& image, const improc::ColorSpace& color_space)
+    {
+        if (color_space == improc::ColorSpace::Value::kGray)
+        {
+            return image;
+        }
+        cv::Mat gray_image {};
+        cv::cvtColor(image,gray_image,color_space.GetColorConversionCode(improc::ColorSpace::Value::kGray));
+        return gray_image;
+    }
+
+    cv::Mat ComputeNaiveAdaptiveThreshold(const cv::Mat& gray_image, bool is_sauvola, double parameter, int window_size, uchar max_value)
+    {
+        cv::Mat threshold_image {gray_image.size(),CV_8UC1};
+        for (int row = 0; row < gray_image.rows; ++row)
+        {
+            for (int col = 0; col < gray_image.cols; ++col)
+            {
+                const int kTop    = std::max(0,row - window_size / 2);
+                const int kBottom = std::min(gray_image.rows,row + window_size / 2 + 1);
+                const int kLeft   = std::max(0,col - window_size / 2);
+                const int kRight  = std::min(gray_image.cols,col + window_size / 2 + 1);
+                uint64_t sum        = 0;
+                uint64_t square_sum = 0;
+                for (int window_row = kTop; window_row < kBottom; ++window_row)
+                {
+                    for (int window_col = kLeft; window_col < kRight; ++window_col)
+                    {
+                        sum        += gray_image.at<uchar>(window_row,window_col);
+                        square_sum += gray_image.at<uchar>(window_row,window_col) * gray_image.at<uchar>(window_row,window_col);
+                    }
+                }
+                const double kArea = (kBottom - kTop) * (kRight - kLeft);
+                const double kMean = sum / kArea;
+                double threshold = kMean - parameter;
+                if (is_sauvola == true)
+                {
+                    const double kVariance = std::max(0.0,square_sum / kArea - kMean * kMean);
+                    threshold = kMean * (1.0 + parameter * (std::sqrt(kVariance) / 128.0 - 1.0));
+                }
+                threshold_image.at<uchar>(row,col) = gray_image.at<uchar>(row,col) > threshold ? max_value : 0;
+            }
+        }
+        return threshold_image;
+    }
+}
+
+TEST(LuminanceThreshold,TestEmptyConstructor) {
+    improc::LuminanceThreshold threshold {};
+    EXPECT_EQ(threshold.get_threshold_type(),improc::ThresholdType::kOtsu);
+    EXPECT_DOUBLE_EQ(threshold.get_threshold(),0.0);
+    EXPECT_DOUBLE_EQ(threshold.get_max_value(),255.0);
+}
+
+TEST(LuminanceThreshold,TestConstructor) {
+    improc::LuminanceThreshold threshold {improc::ThresholdType(improc::ThresholdType::kBinary),100.0,1.0};
+    EXPECT_EQ(threshold.get_threshold_type(),improc::ThresholdType::kBinary);
+    EXPECT_DOUBLE_EQ(threshold.get_threshold(),100.0);
+    EXPECT_DOUBLE_EQ(threshold.get_max_value(),1.0);
+}
+
+TEST(LuminanceThreshold,TestAdaptiveConstructor) {
+    improc::LuminanceThreshold threshold {improc::ThresholdType(improc::ThresholdType::kSauvola),0.3,255.0,15};
+    EXPECT_EQ(threshold.get_threshold_type(),improc::ThresholdType::kSauvola);
+    EXPECT_DOUBLE_EQ(threshold.get_threshold(),0.3);
+    EXPECT_EQ(threshold.get_window_size(),15);
+}
+
+TEST(LuminanceThreshold,TestAdaptiveInvalidWindowSize) {
+    EXPECT_THROW(improc::LuminanceThreshold(improc::ThresholdType(improc::ThresholdType::kAdaptiveMean),0.0,255.0,0)  ,improc::value_error);
+    EXPECT_THROW(improc::LuminanceThreshold(improc::ThresholdType(improc::ThresholdType::kAdaptiveMean),0.0,255.0,1)  ,improc::value_error);
+    EXPECT_THROW(improc::LuminanceThreshold(improc::ThresholdType(improc::ThresholdType::kAdaptiveMean),0.0,255.0,4)  ,improc::value_error);
+    EXPECT_THROW(improc::LuminanceThreshold(improc::ThresholdType(improc::ThresholdType::kSauvola)    ,0.5,255.0,259),improc::value_error);
+    EXPECT_THROW(improc::LuminanceThreshold(improc::ThresholdType(improc::ThresholdType::kAdaptiveMean),0.0,255.0,4105),improc::value_error);
+    EXPECT_NO_THROW(improc::LuminanceThreshold(improc::ThresholdType(improc::ThresholdType::kAdaptiveMean),0.0,255.0,259));
+    EXPECT_NO_THROW(improc::LuminanceThreshold(improc::ThresholdType(improc::ThresholdType::kAdaptiveMean),0.0,255.0,4103));
+    EXPECT_NO_THROW(improc::LuminanceThreshold(improc::ThresholdType(improc::ThresholdType::kSauvola)    ,0.5,255.0,257));
+    EXPECT_NO_THROW(improc::LuminanceThreshold(improc::ThresholdType(improc::ThresholdType::kBinary)     ,0.0,255.0,0));
+}
+
+TEST(LuminanceThreshold,TestIsSupported) {
+    EXPECT_TRUE (improc::LuminanceThreshold::IsSupported(CV_8UC1));
+    EXPECT_TRUE (improc::LuminanceThreshold::IsSupported(CV_8UC4));
+    EXPECT_FALSE(improc::LuminanceThreshold::IsSupported(CV_32FC3));
+}
+
+TEST(LuminanceThreshold,TestApplyInvalidImage) {
+    improc::LuminanceThreshold threshold {};
+    cv::Mat threshold_image {};
+    EXPECT_THROW(threshold.Apply(cv::Mat(),improc::ColorSpace(improc::ColorSpace::kBGR),threshold_image),improc::value_error);
+    EXPECT_THROW(threshold.Apply(cv::Mat::zeros(10,10,CV_8UC3),improc::ColorSpace(improc::ColorSpace::kRGBA),threshold_image),improc::value_error);
+    EXPECT_THROW(threshold.Apply(cv::Mat::zeros(10,10,CV_16UC3),improc::ColorSpace(improc::ColorSpace::kBGR),threshold_image),improc::value_error);
+}
+
+TEST(LuminanceThreshold,TestHistogramMatchesGrayImage) {
+    for (const improc::ColorSpace& color_space : { improc::ColorSpace(improc::ColorSpace::kGray),improc::ColorSpace(improc::ColorSpace::kBGR)
+                                                 , improc::ColorSpace(improc::ColorSpace::kRGB) ,improc::ColorSpace(improc::ColorSpace::kBGRA)
+                                                 , improc::ColorSpace(improc::ColorSpace::kRGBA) })
+    {
+        const cv::Mat kImage     = improc::test::CreateRandomImage(cv::Size(53,29),CV_8UC(color_space.GetNumberChannels()));
+        const cv::Mat kGrayImage = ConvertToGray(kImage,color_space);
+        improc::LuminanceThreshold::Histogram expected_histogram {};
+        for (int row = 0; row < kGrayImage.rows; ++row)
+        {
+            for (int col = 0; col < kGrayImage.cols; ++col)
+            {
+                ++expected_histogram[kGrayImage.at<uchar>(row,col)];
+            }
+        }
+        EXPECT_EQ(improc::LuminanceThreshold::ComputeHistogram(kImage,color_space),expected_histogram);
+    }
+}
+
+TEST(LuminanceThreshold,TestOtsuThresholdOfEmptyHistogram) {
+    EXPECT_DOUBLE_EQ(improc::LuminanceThreshold::ComputeOtsuThreshold(improc::LuminanceThreshold::Histogram {}),0.0);
+}
+
+TEST(LuminanceThreshold,TestOtsuMatchesOpenCV) {
+    for (const improc::ColorSpace& color_space : { improc::ColorSpace(improc::ColorSpace::kGray),improc::ColorSpace(improc::ColorSpace::kBGR)
+                                                 , improc::ColorSpace(improc::ColorSpace::kRGBA) })
+    {
+        const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(97,61),CV_8UC(color_space.GetNumberChannels()));
+        cv::Mat expected_image {};
+        const double kExpectedThreshold = cv::threshold(ConvertToGray(kImage,color_space),expected_image,0,255,cv::THRESH_BINARY | cv::THRESH_OTSU);
+
+        cv::Mat threshold_image {};
+        const double kThreshold = improc::LuminanceThreshold(improc::ThresholdType(improc::ThresholdType::kOtsu)).Apply(kImage,color_space,threshold_image);
+        EXPECT_DOUBLE_EQ(kThreshold,kExpectedThreshold);
+        EXPECT_EQ(threshold_image.type(),CV_8UC1);
+        EXPECT_EQ(cv::norm(threshold_image,expected_image,cv::NORM_INF),0);
+    }
+}
+
+TEST(LuminanceThreshold,TestBinaryMatchesOpenCV) {
+    const improc::ColorSpace kColorSpace {improc::ColorSpace::kRGB};
+    const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(64,48),CV_8UC3);
+    cv::Mat expected_image {};
+    cv::threshold(ConvertToGray(kImage,kColorSpace),expected_image,127.5,200,cv::THRESH_BINARY);
+
+    cv::Mat threshold_image {};
+    const double kThreshold = improc::LuminanceThreshold(improc::ThresholdType(improc::ThresholdType::kBinary),127.5,200).Apply(kImage,kColorSpace,threshold_image);
+    EXPECT_DOUBLE_EQ(kThreshold,127.5);
+    EXPECT_EQ(cv::norm(threshold_image,expected_image,cv::NORM_INF),0);
+}
+
+TEST(LuminanceThreshold,TestAdaptiveMeanMatchesNaive) {
+    for (const improc::ColorSpace& color_space : { improc::ColorSpace(improc::ColorSpace::kGray),improc::ColorSpace(improc::ColorSpace::kBGR)
+                                                 , improc::ColorSpace(improc::ColorSpace::kRGBA) })
+    {
+        const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(97,61),CV_8UC(color_space.GetNumberChannels()));
+        const cv::Mat kExpectedImage = ComputeNaiveAdaptiveThreshold(ConvertToGray(kImage,color_space),false,5.0,11,255);
+
+        cv::Mat threshold_image {};
+        const double kThreshold = improc::LuminanceThreshold(improc::ThresholdType(improc::ThresholdType::kAdaptiveMean),5.0,255.0,11).Apply(kImage,color_space,threshold_image);
+        EXPECT_TRUE(std::isnan(kThreshold));
+        EXPECT_EQ(threshold_image.type(),CV_8UC1);
+        EXPECT_EQ(cv::norm(threshold_image,kExpectedImage,cv::NORM_INF),0);
+    }
+}
+
+TEST(LuminanceThreshold,TestSauvolaMatchesNaive) {
+    const improc::ColorSpace kColorSpace {improc::ColorSpace::kRGB};
+    const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(64,48),CV_8UC3);
+    const cv::Mat kExpectedImage = ComputeNaiveAdaptiveThreshold(ConvertToGray(kImage,kColorSpace),true,0.2,15,1);
+
+    cv::Mat threshold_image {};
+    improc::IntegralImage integral_image {};
+    improc::LuminanceThreshold(improc::ThresholdType(improc::ThresholdType::kSauvola),0.2,1.0,15).Apply(kImage,kColorSpace,threshold_image,&integral_image);
+    EXPECT_EQ(cv::norm(threshold_image,kExpectedImage,cv::NORM_INF),0);
+    EXPECT_EQ(integral_image.GetImageSize(),kImage.size());
+    EXPECT_TRUE(integral_image.HasSquareSum());
+}
+
+TEST(LuminanceThreshold,TestAdaptiveInPlace) {
+    const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(64,48),CV_8UC1);
+    const cv::Mat kExpectedImage = ComputeNaiveAdaptiveThreshold(kImage,false,0.0,7,255);
+
+    cv::Mat image = kImage.clone();
+    improc::LuminanceThreshold(improc::ThresholdType(improc::ThresholdType::kAdaptiveMean),0.0,255.0,7).Apply(image,improc::ColorSpace(improc::ColorSpace::kGray),image);
+    EXPECT_EQ(cv::norm(image,kExpectedImage,cv::NORM_INF),0);
+}
\ No newline at end of file
@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+
+#include <improc/corecv/metrics.hpp>
+#include <improc/corecv/parsers/binary_plan.hpp>
+#include <improc/corecv/parsers/json_parser.hpp>
+#include <improc/corecv/structures/rotation_type.hpp>
+#include <improc/services/resize_image.hpp>
+#include <improc_corecv_test_config.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    improc::Metrics::OperationSnapshot GetOperationSnapshot(const std::string& operation_name)
+    {
+        const std::vector<improc::Metrics::OperationSnapshot> kSnapshot = improc::Metrics::get().GetSnapshot();
+        std::vector<improc::Metrics::OperationSnapshot>::const_iterator operation_iter = std::find_if( kSnapshot.begin(),kSnapshot.end()
+                                                                                                     , [&operation_name] (const improc::Metrics::OperationSnapshot& operation) -> bool
+                                                                                                       {
+                                                                                                           return operation.name == operation_name;
+                                                                                                       } );
+        EXPECT_NE(operation_iter,kSnapshot.end());
+        return operation_iter == kSnapshot.end() ? improc::Metrics::OperationSnapshot {} : *operation_iter;
+    }
+}
+
+TEST(Metrics,TestRegisterOperation) {
+    const size_t kOperationId = improc::Metrics::get().RegisterOperation("TestRegisterOperation");
+    EXPECT_EQ(improc::Metrics::get().RegisterOperation("TestRegisterOperation"),kOperationId);
+    EXPECT_NE(improc::Metrics::get().RegisterOperation("TestRegisterOtherOperation"),kOperationId);
+    EXPECT_EQ(GetOperationSnapshot("TestRegisterOperation").calls,0);
+}
+
+TEST(Metrics,TestRecordInvalidOperation) {
+    EXPECT_THROW(improc::Metrics::get().Record(improc::Metrics::kMaxOperations,std::chrono::nanoseconds(1),0,0,0),improc::value_error);
+}
+
+TEST(Metrics,TestRecord) {
+    const size_t kOperationId = improc::Metrics::get().RegisterOperation("TestRecord");
+    for (int latency = 1; latency <= 100; ++latency)
+    {
+        improc::Metrics::get().Record(kOperationId,std::chrono::nanoseconds(latency * 1000),10,20,5);
+    }
+    const improc::Metrics::OperationSnapshot kOperation = GetOperationSnapshot("TestRecord");
+    EXPECT_EQ(kOperation.calls,100);
+    EXPECT_EQ(kOperation.bytes_in,1000);
+    EXPECT_EQ(kOperation.bytes_out,2000);
+    EXPECT_EQ(kOperation.pixels,500);
+    EXPECT_EQ(kOperation.total_latency.count(),5050000);
+    EXPECT_EQ(kOperation.max_latency.count(),100000);
+    EXPECT_GE(kOperation.p50_latency.count(),50000);
+    EXPECT_LE(kOperation.p50_latency.count(),50000 * 1.125);
+    EXPECT_GE(kOperation.p99_latency.count(),99000);
+    EXPECT_LE(kOperation.p99_latency.count(),100000);
+}
+
+TEST(Metrics,TestRecordFromThreads) {
+    const size_t kOperationId   = improc::Metrics::get().RegisterOperation("TestRecordFromThreads");
+    const int    kNumberThreads = 4;
+    const int    kNumberRecords = 1000;
+    std::vector<std::thread> threads {};
+    for (int thread_idx = 0; thread_idx < kNumberThreads; ++thread_idx)
+    {
+        threads.emplace_back( [kOperationId,kNumberRecords] () -> void
+                              {
+                                  for (int record_idx = 0; record_idx < kNumberRecords; ++record_idx)
+                                  {
+                                      improc::Metrics::get().Record(kOperationId,std::chrono::nanoseconds(100),1,1,1);
+                                  }
+                              } );
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    const improc::Metrics::OperationSnapshot kOperation = GetOperationSnapshot("TestRecordFromThreads");
+    EXPECT_EQ(kOperation.calls,kNumberThreads * kNumberRecords);
+    EXPECT_EQ(kOperation.pixels,kNumberThreads * kNumberRecords);
+    EXPECT_EQ(kOperation.max_latency.count(),100);
+}
+
+TEST(Metrics,TestScopedRecord) {
+    const size_t kOperationId = improc::Metrics::get().RegisterOperation("TestScopedRecord");
+    {
+        improc::Metrics::ScopedRecord record {kOperationId};
+        record.SetImages(cv::Mat::zeros(10,20,CV_8UC3),cv::Mat::zeros(10,20,CV_8UC1));
+    }
+    const improc::Metrics::OperationSnapshot kOperation = GetOperationSnapshot("TestScopedRecord");
+    EXPECT_EQ(kOperation.calls,1);
+    EXPECT_EQ(kOperation.bytes_in,600);
+    EXPECT_EQ(kOperation.bytes_out,200);
+    EXPECT_EQ(kOperation.pixels,200);
+}
+
+TEST(Metrics,TestToJson) {
+    const size_t kOperationId = improc::Metrics::get().RegisterOperation("TestToJson");
+    improc::Metrics::get().Record(kOperationId,std::chrono::nanoseconds(10),1,2,3);
+    const Json::Value kMetricsJson = improc::Metrics::get().ToJson();
+    ASSERT_TRUE(kMetricsJson.isMember("TestToJson"));
+    EXPECT_EQ(kMetricsJson["TestToJson"]["calls"].asUInt64(),1);
+    EXPECT_EQ(kMetricsJson["TestToJson"]["bytes_in"].asUInt64(),1);
+    EXPECT_EQ(kMetricsJson["TestToJson"]["bytes_out"].asUInt64(),2);
+    EXPECT_EQ(kMetricsJson["TestToJson"]["pixels"].asUInt64(),3);
+    EXPECT_EQ(kMetricsJson["TestToJson"]["p50_latency"].asUInt64(),10);
+    EXPECT_EQ(kMetricsJson["TestToJson"]["max_latency"].asUInt64(),10);
+}
+
+TEST(Metrics,TestReset) {
+    const size_t kOperationId = improc::Metrics::get().RegisterOperation("TestReset");
+    improc::Metrics::get().Record(kOperationId,std::chrono::nanoseconds(10),1,2,3);
+    improc::Metrics::get().Reset();
+    const improc::Metrics::OperationSnapshot kOperation = GetOperationSnapshot("TestReset");
+    EXPECT_EQ(kOperation.calls,0);
+    EXPECT_EQ(kOperation.max_latency.count(),0);
+}
+
+TEST(Metrics,TestLatencyBuckets) {
+    EXPECT_EQ(improc::Metrics::GetLatencyBucket(0),0);
+    EXPECT_EQ(improc::Metrics::GetLatencyBucket(15),15);
+    EXPECT_EQ(improc::Metrics::GetLatencyBucket(16),16);
+    EXPECT_EQ(improc::Metrics::GetLatencyBucket(std::numeric_limits<uint64_t>::max()),improc::Metrics::kNumberLatencyBuckets - 1);
+    for (uint64_t latency = 1; latency < 100000; latency = latency * 3 / 2 + 1)
+    {
+        const size_t kBucket = improc::Metrics::GetLatencyBucket(latency);
+        EXPECT_GE(improc::Metrics::GetLatencyBucketUpperBound(kBucket),latency);
+        EXPECT_LT(improc::Metrics::GetLatencyBucketUpperBound(kBucket - 1),latency);
+    }
+}
+
+#ifdef IMPROC_CORECV_WITH_METRICS
+TEST(Metrics,TestServiceMetrics) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_resize_with_size.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousResize resize {};
+    resize.Load(json_content);
+
+    improc::Metrics::get().RegisterOperation("Resize");
+    const uint64_t kNumberCalls = GetOperationSnapshot("Resize").calls;
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",cv::Mat(cv::Mat::ones(60,80,CV_8UC3)));
+    resize.Run(cntxt);
+
+    const improc::Metrics::OperationSnapshot kOperation = GetOperationSnapshot("Resize");
+    EXPECT_EQ(kOperation.calls,kNumberCalls + 1);
+    EXPECT_GE(kOperation.bytes_in,60 * 80 * 3);
+    EXPECT_GE(kOperation.pixels,60 * 80);
+}
+
+TEST(Metrics,TestRotationAndParserMetrics) {
+    improc::Metrics::get().RegisterOperation("RotationType::Apply");
+    improc::Metrics::get().RegisterOperation("json::Size");
+    improc::Metrics::get().RegisterOperation("PlanReader::Read");
+    const uint64_t kNumberRotationCalls = GetOperationSnapshot("RotationType::Apply").calls;
+    const uint64_t kNumberSizeCalls     = GetOperationSnapshot("json::Size").calls;
+    const uint64_t kNumberPlanCalls     = GetOperationSnapshot("PlanReader::Read").calls;
+
+    improc::RotationType(improc::RotationType::k90Deg).Apply(cv::Mat(cv::Mat::ones(60,80,CV_8UC3)));
+    Json::Value json_size {Json::objectValue};
+    json_size["width"]  = 80;
+    json_size["height"] = 60;
+    improc::Size<int> size {json_size};
+    improc::PlanWriter plan_writer {};
+    improc::PlanReader plan_reader {plan_writer.get_data()};
+
+    const improc::Metrics::OperationSnapshot kRotation = GetOperationSnapshot("RotationType::Apply");
+    EXPECT_EQ(kRotation.calls,kNumberRotationCalls + 1);
+    EXPECT_GE(kRotation.bytes_out,60 * 80 * 3);
+    EXPECT_EQ(GetOperationSnapshot("json::Size").calls,kNumberSizeCalls + 1);
+    EXPECT_EQ(GetOperationSnapshot("PlanReader::Read").calls,kNumberPlanCalls + 1);
+}
+#endif
\ No newline at end of file
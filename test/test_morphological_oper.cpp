@@ -30,6 +30,13 @@ TEST(MorphologicalOper,TestInvalidMorphOperConstructor) {
     EXPECT_THROW(improc::MorphologicalOper morph_oper {"invalid"},std::out_of_range);
 }
 
+TEST(MorphologicalOper,TestTryParse) {
+    static_assert(improc::MorphologicalOper::TryParse("Close").value() == improc::MorphologicalOper::Value::kClose);
+    EXPECT_EQ(improc::MorphologicalOper::TryParse(std::string("close")).value(),improc::MorphologicalOper::Value::kClose);
+    EXPECT_FALSE(improc::MorphologicalOper::TryParse("invalid").has_value());
+    EXPECT_FALSE(improc::MorphologicalOper::TryParse("").has_value());
+}
+
 TEST(MorphologicalOper,TestConstructorFromClass) {
     EXPECT_EQ(improc::MorphologicalOper::kDilate,improc::MorphologicalOper::Value::kDilate);
     EXPECT_EQ(improc::MorphologicalOper::kErode ,improc::MorphologicalOper::Value::kErode);
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <improc/services/morphology.hpp>
+#include <improc_corecv_test_config.hpp>
+
+TEST(Morphology,TestLoadWithoutType) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_morphology_without_type.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousMorphology morphology {};
+    EXPECT_THROW(morphology.Load(json_content),improc::json_error);
+}
+
+TEST(Morphology,TestLoadWithoutKernelSize) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_morphology_without_kernel_size.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousMorphology morphology {};
+    EXPECT_THROW(morphology.Load(json_content),improc::json_error);
+}
+
+TEST(Morphology,TestLoadInvalidIterations) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_morphology_invalid_iterations.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousMorphology morphology {};
+    EXPECT_THROW(morphology.Load(json_content),improc::json_error);
+}
+
+TEST(Morphology,TestRectangle) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/morphological_operation.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read()["morphological_operation"];
+    json_content["inputs"]  = "image";
+    json_content["outputs"] = "image";
+
+    improc::StringKeyHeterogeneousMorphology morphology {};
+    morphology.Load(json_content);
+
+    cv::Mat image_data {60,80,CV_8UC1};
+    cv::randu(image_data,cv::Scalar::all(0),cv::Scalar::all(255));
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",image_data);
+    morphology.Run(cntxt);
+
+    improc::Image image = std::any_cast<improc::Image>(cntxt["image"]);
+    cv::Mat expected_image_data {};
+    cv::morphologyEx(image_data,expected_image_data,cv::MORPH_CLOSE,cv::getStructuringElement(cv::MORPH_RECT,cv::Size(10,15)));
+    EXPECT_EQ(cv::norm(image.get_data(),expected_image_data,cv::NORM_INF),0);
+}
+
+TEST(Morphology,TestEllipse) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_morphology_ellipse.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousMorphology morphology {};
+    morphology.Load(json_content);
+
+    cv::Mat image_data {60,80,CV_8UC3};
+    cv::randu(image_data,cv::Scalar::all(0),cv::Scalar::all(255));
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",image_data);
+    morphology.Run(cntxt);
+
+    improc::Image image = std::any_cast<improc::Image>(cntxt["image"]);
+    cv::Mat expected_image_data {};
+    cv::morphologyEx( image_data,expected_image_data,cv::MORPH_DILATE,cv::getStructuringElement(cv::MORPH_ELLIPSE,cv::Size(7,5))
+                    , cv::Point(-1,-1),2 );
+    EXPECT_EQ(cv::norm(image.get_data(),expected_image_data,cv::NORM_INF),0);
+}
+
+TEST(Morphology,TestLoadFromPlan) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_morphology_ellipse.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousMorphology morphology {};
+    morphology.Load(json_content);
+    improc::PlanWriter plan_writer {};
+    morphology.Save(plan_writer);
+
+    improc::PlanReader plan_reader {plan_writer.get_data()};
+    improc::StringKeyHeterogeneousMorphology plan_morphology {};
+    plan_morphology.Load(plan_reader);
+
+    cv::Mat image_data {60,80,CV_8UC3};
+    cv::randu(image_data,cv::Scalar::all(0),cv::Scalar::all(255));
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",image_data);
+    improc::StringKeyHeterogeneousContext plan_cntxt {};
+    plan_cntxt.Add("image",image_data);
+    morphology.Run(cntxt);
+    plan_morphology.Run(plan_cntxt);
+    EXPECT_EQ(cv::norm(std::any_cast<improc::Image>(cntxt["image"]).get_data(),std::any_cast<improc::Image>(plan_cntxt["image"]).get_data(),cv::NORM_INF),0);
+}
+
+TEST(Morphology,TestLoadFromPlanOfOtherService) {
+    improc::PlanWriter plan_writer {};
+    plan_writer.WriteService("Resize");
+
+    improc::PlanReader plan_reader {plan_writer.get_data()};
+    improc::StringKeyHeterogeneousMorphology morphology {};
+    EXPECT_THROW(morphology.Load(plan_reader),improc::file_processing_error);
+}
\ No newline at end of file
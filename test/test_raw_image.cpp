@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+
+#include <improc/corecv/raw_image.hpp>
+#include <improc/corecv/parsers/image_header.hpp>
+#include <improc_corecv_test_config.hpp>
+
+#include <cstdio>
+#include <fstream>
+
+namespace
+{
+    std::string GetRawFilepath(const std::string& filename)
+    {
+        return std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/" + filename;
+    }
+
+    cv::Mat CreateImageData(int rows, int cols, int type)
+    {
+        cv::Mat image_data {rows,cols,type};
+        cv::randu(image_data,cv::Scalar::all(0),cv::Scalar::all(255));
+        return image_data;
+    }
+}
+
+TEST(RawImage,TestWriteAndRead) {
+    const std::string kFilepath = GetRawFilepath("raw_write_read.raw");
+    const cv::Mat kImageData = CreateImageData(37,45,CV_8UC3);
+    improc::RawImage::Write(kFilepath,kImageData);
+
+    const improc::RawImage::Header kHeader = improc::RawImage::ReadHeader(kFilepath);
+    EXPECT_EQ(kHeader.image_size,cv::Size(45,37));
+    EXPECT_EQ(kHeader.type,CV_8UC3);
+    EXPECT_FALSE(kHeader.color_space.has_value());
+    EXPECT_EQ(kHeader.row_step % improc::RawImage::kRowAlignment,0);
+    EXPECT_EQ(kHeader.data_offset,improc::RawImage::kDataAlignment);
+
+    const improc::Image kImage = improc::RawImage::Read(kFilepath);
+    EXPECT_EQ(kImage.get_data().size(),kImageData.size());
+    EXPECT_EQ(kImage.get_data().type(),kImageData.type());
+    EXPECT_EQ(kImage.get_data().step[0],kHeader.row_step);
+    EXPECT_EQ(cv::norm(kImage.get_data(),kImageData,cv::NORM_INF),0);
+    std::remove(kFilepath.c_str());
+}
+
+TEST(RawImage,TestReadWithoutCopy) {
+    const std::string kFilepath = GetRawFilepath("raw_without_copy.raw");
+    improc::RawImage::Write(kFilepath,cv::Mat::zeros(16,10,CV_8UC1));
+
+    cv::Mat image_data = improc::RawImage::ReadData(kFilepath);
+    ASSERT_NE(image_data.u,nullptr);
+    EXPECT_EQ(image_data.data,image_data.u->origdata + improc::RawImage::kDataAlignment);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(image_data.data) % improc::RawImage::kRowAlignment,0);
+
+    // Mapping is kept alive by the shared image data
+    cv::Mat image_data_copy = image_data;
+    image_data.release();
+    EXPECT_EQ(image_data_copy.rows,16);
+    EXPECT_NO_THROW(image_data_copy.setTo(cv::Scalar::all(7)));
+    EXPECT_EQ(image_data_copy.at<uchar>(15,9),7);
+
+    // Private mapping does not change the file
+    const improc::Image kImage = improc::RawImage::Read(kFilepath);
+    EXPECT_EQ(cv::countNonZero(kImage.get_data()),0);
+    std::remove(kFilepath.c_str());
+}
+
+TEST(RawImage,TestWriteAndReadColorSpaceImage) {
+    const std::string kFilepath = GetRawFilepath("raw_color_space.raw");
+    const improc::ColorSpaceImage kImage {CreateImageData(8,8,CV_8UC4),improc::ColorSpace(improc::ColorSpace::Value::kRGBA)};
+    improc::RawImage::Write(kFilepath,kImage);
+
+    const improc::ColorSpaceImage kReadImage = improc::RawImage::ReadColorSpaceImage(kFilepath);
+    EXPECT_EQ(kReadImage.get_color_space(),improc::ColorSpace::Value::kRGBA);
+    EXPECT_EQ(cv::norm(kReadImage.get_data(),kImage.get_data(),cv::NORM_INF),0);
+    std::remove(kFilepath.c_str());
+}
+
+TEST(RawImage,TestReadColorSpaceImageWithoutColorSpace) {
+    const std::string kFilepath = GetRawFilepath("raw_without_color_space.raw");
+    improc::RawImage::Write(kFilepath,CreateImageData(8,8,CV_8UC1));
+    EXPECT_THROW(improc::RawImage::ReadColorSpaceImage(kFilepath),improc::value_error);
+    std::remove(kFilepath.c_str());
+}
+
+TEST(RawImage,TestWriteEmptyImage) {
+    EXPECT_THROW(improc::RawImage::Write(GetRawFilepath("raw_empty.raw"),cv::Mat()),improc::value_error);
+}
+
+TEST(RawImage,TestWriteInvalidFilepath) {
+    EXPECT_THROW(improc::RawImage::Write(GetRawFilepath("missing_folder/raw.raw"),CreateImageData(8,8,CV_8UC1)),improc::file_processing_error);
+}
+
+TEST(RawImage,TestReadMissingFile) {
+    EXPECT_THROW(improc::RawImage::Read(GetRawFilepath("missing_folder/raw.raw")),improc::file_processing_error);
+}
+
+TEST(RawImage,TestReadInvalidFile) {
+    const std::string kFilepath = GetRawFilepath("raw_invalid.raw");
+    {
+        std::ofstream raw_file {kFilepath,std::ios::binary};
+        raw_file << std::string(improc::RawImage::kHeaderSize,'x');
+    }
+    EXPECT_THROW(improc::RawImage::Read(kFilepath),improc::value_error);
+    std::remove(kFilepath.c_str());
+}
+
+TEST(RawImage,TestReadTruncatedFile) {
+    const std::string kFilepath = GetRawFilepath("raw_truncated.raw");
+    improc::RawImage::Write(kFilepath,CreateImageData(64,64,CV_8UC3));
+    std::string raw_data {};
+    {
+        std::ifstream raw_file {kFilepath,std::ios::binary};
+        raw_data.assign(std::istreambuf_iterator<char>(raw_file),std::istreambuf_iterator<char>());
+    }
+    {
+        std::ofstream raw_file {kFilepath,std::ios::binary | std::ios::trunc};
+        raw_file.write(raw_data.data(),static_cast<std::streamsize>(raw_data.size() / 2));
+    }
+    EXPECT_THROW(improc::RawImage::Read(kFilepath),improc::value_error);
+    std::remove(kFilepath.c_str());
+}
+
+TEST(RawImage,TestImageHeader) {
+    const std::string kFilepath = GetRawFilepath("raw_image_header.raw");
+    improc::RawImage::Write(kFilepath,CreateImageData(30,40,CV_8UC1));
+    std::vector<uchar> raw_data(improc::RawImage::kHeaderSize);
+    {
+        std::ifstream raw_file {kFilepath,std::ios::binary};
+        raw_file.read(reinterpret_cast<char*>(raw_data.data()),static_cast<std::streamsize>(raw_data.size()));
+    }
+    std::optional<improc::ImageHeader> image_header = improc::ImageHeader::Read(raw_data.data(),raw_data.size());
+    ASSERT_TRUE(image_header.has_value());
+    EXPECT_EQ(image_header.value().image_format,improc::ImageFormat::Value::kRaw);
+    EXPECT_EQ(image_header.value().image_size,cv::Size(40,30));
+    std::remove(kFilepath.c_str());
+}
+
+TEST(RawImage,TestReadOverflowingLayout) {
+    // Row step of 2^62 wraps the file size check when multiplied by 4 rows
+    const std::string kFilepath = GetRawFilepath("raw_overflow.raw");
+    improc::RawImage::Write(kFilepath,CreateImageData(4,64,CV_8UC1));
+    {
+        std::fstream raw_file {kFilepath,std::ios::binary | std::ios::in | std::ios::out};
+        const uchar kRowStep[8] = {0,0,0,0,0,0,0,0x40};
+        raw_file.seekp(32);
+        raw_file.write(reinterpret_cast<const char*>(kRowStep),sizeof(kRowStep));
+    }
+    EXPECT_THROW(improc::RawImage::Read(kFilepath),improc::value_error);
+    std::remove(kFilepath.c_str());
+}
+
+TEST(RawImage,TestReadInvalidRowStep) {
+    // Rows of 10 pixels with three 16-bit channels need a row step of at least 60 bytes in steps of 2 bytes
+    const std::string kFilepath = GetRawFilepath("raw_invalid_row_step.raw");
+    for (const uchar row_step : {58,61})
+    {
+        improc::RawImage::Write(kFilepath,CreateImageData(4,10,CV_16UC3));
+        {
+            std::fstream raw_file {kFilepath,std::ios::binary | std::ios::in | std::ios::out};
+            const uchar kRowStep[8] = {row_step,0,0,0,0,0,0,0};
+            raw_file.seekp(32);
+            raw_file.write(reinterpret_cast<const char*>(kRowStep),sizeof(kRowStep));
+        }
+        EXPECT_THROW(improc::RawImage::ReadHeader(kFilepath),improc::value_error);
+        EXPECT_THROW(improc::RawImage::Read(kFilepath),improc::value_error);
+    }
+    std::remove(kFilepath.c_str());
+}
+
+TEST(RawImage,TestReadInvalidColorSpace) {
+    const std::string kFilepath = GetRawFilepath("raw_invalid_color_space.raw");
+    improc::RawImage::Write(kFilepath,improc::ColorSpaceImage(CreateImageData(30,40,CV_8UC1),improc::ColorSpace::kGray));
+    std::vector<uchar> raw_data(improc::RawImage::kHeaderSize);
+    {
+        std::fstream raw_file {kFilepath,std::ios::binary | std::ios::in | std::ios::out};
+        const uchar kColorSpace[4] = {0x2a,0,0,0};
+        raw_file.seekp(24);
+        raw_file.write(reinterpret_cast<const char*>(kColorSpace),sizeof(kColorSpace));
+        raw_file.seekg(0);
+        raw_file.read(reinterpret_cast<char*>(raw_data.data()),static_cast<std::streamsize>(raw_data.size()));
+    }
+    EXPECT_THROW(improc::RawImage::ReadHeader(kFilepath),improc::value_error);
+    EXPECT_THROW(improc::RawImage::ReadColorSpaceImage(kFilepath),improc::value_error);
+    EXPECT_FALSE(improc::ImageHeader::Read(raw_data.data(),raw_data.size()).has_value());
+    std::remove(kFilepath.c_str());
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <improc/corecv/kernels/rectangle_morphology.hpp>
+#include <improc_corecv_test_utils.hpp>
+
+#include <opencv2/imgproc.hpp>
+
+TEST(RectangleMorphology,TestEmptyConstructor) {
+    improc::RectangleMorphology morphology {};
+    EXPECT_EQ(morphology.get_oper(),improc::MorphologicalOper::kDilate);
+    EXPECT_EQ(morphology.get_kernel_size(),cv::Size(1,1));
+    EXPECT_EQ(morphology.get_anchor(),cv::Point(0,0));
+}
+
+TEST(RectangleMorphology,TestConstructor) {
+    improc::RectangleMorphology morphology {improc::MorphologicalOper(improc::MorphologicalOper::kClose),cv::Size(10,15)};
+    EXPECT_EQ(morphology.get_oper(),improc::MorphologicalOper::kClose);
+    EXPECT_EQ(morphology.get_kernel_size(),cv::Size(10,15));
+    EXPECT_EQ(morphology.get_anchor(),cv::Point(5,7));
+}
+
+TEST(RectangleMorphology,TestConstructorFoldsIterations) {
+    improc::RectangleMorphology morphology {improc::MorphologicalOper(improc::MorphologicalOper::kErode),cv::Size(4,3),3};
+    EXPECT_EQ(morphology.get_kernel_size(),cv::Size(10,7));
+    EXPECT_EQ(morphology.get_anchor(),cv::Point(6,3));
+}
+
+TEST(RectangleMorphology,TestInvalidConstructor) {
+    EXPECT_THROW(improc::RectangleMorphology(improc::MorphologicalOper(improc::MorphologicalOper::kErode),cv::Size(0,3)),improc::value_error);
+    EXPECT_THROW(improc::RectangleMorphology(improc::MorphologicalOper(improc::MorphologicalOper::kErode),cv::Size(3,3),0),improc::value_error);
+}
+
+TEST(RectangleMorphology,TestIsSupported) {
+    EXPECT_TRUE (improc::RectangleMorphology::IsSupported(CV_8UC1));
+    EXPECT_TRUE (improc::RectangleMorphology::IsSupported(CV_8UC3));
+    EXPECT_FALSE(improc::RectangleMorphology::IsSupported(CV_16UC1));
+    EXPECT_FALSE(improc::RectangleMorphology::IsSupported(CV_32FC1));
+}
+
+TEST(RectangleMorphology,TestApplyInvalidImage) {
+    improc::RectangleMorphology morphology {improc::MorphologicalOper(improc::MorphologicalOper::kErode),cv::Size(3,3)};
+    cv::Mat morphology_image {};
+    EXPECT_THROW(morphology.Apply(cv::Mat(),morphology_image),improc::value_error);
+    EXPECT_THROW(morphology.Apply(cv::Mat::zeros(10,10,CV_32FC1),morphology_image),improc::value_error);
+}
+
+TEST(RectangleMorphology,TestMatchesOpenCV) {
+    const std::vector<improc::MorphologicalOper> kOpers = { improc::MorphologicalOper(improc::MorphologicalOper::kDilate)
+                                                          , improc::MorphologicalOper(improc::MorphologicalOper::kErode)
+                                                          , improc::MorphologicalOper(improc::MorphologicalOper::kOpen)
+                                                          , improc::MorphologicalOper(improc::MorphologicalOper::kClose) };
+    const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(67,41),CV_8UC1);
+    for (const improc::MorphologicalOper& oper : kOpers)
+    {
+        for (const cv::Size& kernel_size : {cv::Size(1,1),cv::Size(3,3),cv::Size(10,15),cv::Size(4,1),cv::Size(1,6),cv::Size(80,50)})
+        {
+            cv::Mat expected_image {};
+            cv::morphologyEx(kImage,expected_image,oper.ToOpenCV(),cv::getStructuringElement(cv::MORPH_RECT,kernel_size));
+
+            cv::Mat morphology_image {};
+            improc::RectangleMorphology(oper,kernel_size).Apply(kImage,morphology_image);
+            EXPECT_EQ(cv::norm(morphology_image,expected_image,cv::NORM_INF),0);
+        }
+    }
+}
+
+TEST(RectangleMorphology,TestMatchesOpenCVWithChannels) {
+    for (int image_type : {CV_8UC3,CV_8UC4})
+    {
+        const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(300,23),image_type);
+        cv::Mat expected_image {};
+        cv::morphologyEx(kImage,expected_image,cv::MORPH_CLOSE,cv::getStructuringElement(cv::MORPH_RECT,cv::Size(31,31)));
+
+        cv::Mat morphology_image {};
+        improc::RectangleMorphology(improc::MorphologicalOper(improc::MorphologicalOper::kClose),cv::Size(31,31)).Apply(kImage,morphology_image);
+        EXPECT_EQ(morphology_image.type(),image_type);
+        EXPECT_EQ(cv::norm(morphology_image,expected_image,cv::NORM_INF),0);
+    }
+}
+
+TEST(RectangleMorphology,TestMatchesOpenCVWithIterations) {
+    const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(45,38),CV_8UC1);
+    for (const improc::MorphologicalOper& oper : { improc::MorphologicalOper(improc::MorphologicalOper::kErode)
+                                                 , improc::MorphologicalOper(improc::MorphologicalOper::kOpen) })
+    {
+        for (const cv::Size& kernel_size : {cv::Size(3,3),cv::Size(4,5)})
+        {
+            cv::Mat expected_image {};
+            cv::morphologyEx(kImage,expected_image,oper.ToOpenCV(),cv::getStructuringElement(cv::MORPH_RECT,kernel_size),cv::Point(-1,-1),3);
+
+            cv::Mat morphology_image {};
+            improc::RectangleMorphology(oper,kernel_size,3).Apply(kImage,morphology_image);
+            EXPECT_EQ(cv::norm(morphology_image,expected_image,cv::NORM_INF),0);
+        }
+    }
+}
+
+TEST(RectangleMorphology,TestApplyInPlace) {
+    const cv::Mat kImage = improc::test::CreateRandomImage(cv::Size(40,30),CV_8UC1);
+    cv::Mat expected_image {};
+    cv::morphologyEx(kImage,expected_image,cv::MORPH_CLOSE,cv::getStructuringElement(cv::MORPH_RECT,cv::Size(5,7)));
+
+    cv::Mat morphology_image = kImage.clone();
+    improc::RectangleMorphology(improc::MorphologicalOper(improc::MorphologicalOper::kClose),cv::Size(5,7)).Apply(morphology_image,morphology_image);
+    EXPECT_EQ(cv::norm(morphology_image,expected_image,cv::NORM_INF),0);
+}
\ No newline at end of file
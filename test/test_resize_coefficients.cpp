@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <improc/corecv/structures/resize_coefficients.hpp>
+
+TEST(ResizeCoefficients,TestEmptyConstructor) {
+    improc::ResizeCoefficients coefficients {};
+    EXPECT_TRUE(coefficients.get_from_image_size().empty());
+    EXPECT_TRUE(coefficients.get_to_image_size().empty());
+    EXPECT_EQ(coefficients.get_interpolation(),improc::InterpolationType::kLinear);
+}
+
+TEST(ResizeCoefficients,TestConstructor) {
+    improc::ResizeCoefficients coefficients {cv::Size(20,10),cv::Size(7,5),improc::InterpolationType(improc::InterpolationType::kNearest)};
+    EXPECT_EQ(coefficients.get_from_image_size(),cv::Size(20,10));
+    EXPECT_EQ(coefficients.get_to_image_size(),cv::Size(7,5));
+    EXPECT_EQ(coefficients.get_interpolation(),improc::InterpolationType::kNearest);
+}
+
+TEST(ResizeCoefficients,TestInvalidConstructor) {
+    EXPECT_THROW(improc::ResizeCoefficients(cv::Size(0,10),cv::Size(7,5),improc::InterpolationType(improc::InterpolationType::kLinear)),improc::value_error);
+    EXPECT_THROW(improc::ResizeCoefficients(cv::Size(20,10),cv::Size(7,5),improc::InterpolationType(improc::InterpolationType::kCubic)),improc::value_error);
+}
+
+TEST(ResizeCoefficients,TestIsSupported) {
+    EXPECT_TRUE (improc::ResizeCoefficients::IsSupported(improc::InterpolationType(improc::InterpolationType::kLinear) ,CV_8UC3));
+    EXPECT_TRUE (improc::ResizeCoefficients::IsSupported(improc::InterpolationType(improc::InterpolationType::kNearest),CV_8UC1));
+    EXPECT_FALSE(improc::ResizeCoefficients::IsSupported(improc::InterpolationType(improc::InterpolationType::kCubic)  ,CV_8UC3));
+    EXPECT_FALSE(improc::ResizeCoefficients::IsSupported(improc::InterpolationType(improc::InterpolationType::kLinear) ,CV_32FC1));
+}
+
+TEST(ResizeCoefficients,TestApplyInvalidImageSize) {
+    improc::ResizeCoefficients coefficients {cv::Size(20,10),cv::Size(7,5),improc::InterpolationType(improc::InterpolationType::kLinear)};
+    cv::Mat image {11,20,CV_8UC3};
+    cv::Mat resized_image {};
+    EXPECT_THROW(coefficients.Apply(image,resized_image),improc::value_error);
+}
+
+TEST(ResizeCoefficients,TestNearestMatchesOpenCV) {
+    for (const cv::Size& to_image_size : {cv::Size(31,17),cv::Size(160,90),cv::Size(64,48)})
+    {
+        improc::ResizeCoefficients coefficients {cv::Size(64,48),to_image_size,improc::InterpolationType(improc::InterpolationType::kNearest)};
+        for (int type : {CV_8UC1,CV_8UC3,CV_8UC4})
+        {
+            cv::Mat image {48,64,type};
+            cv::randu(image,cv::Scalar::all(0),cv::Scalar::all(255));
+            cv::Mat expected_image {};
+            cv::resize(image,expected_image,to_image_size,0,0,cv::INTER_NEAREST);
+            cv::Mat resized_image {};
+            coefficients.Apply(image,resized_image);
+            EXPECT_EQ(resized_image.size(),to_image_size);
+            EXPECT_EQ(cv::norm(resized_image,expected_image,cv::NORM_INF),0);
+        }
+    }
+}
+
+TEST(ResizeCoefficients,TestLinearMatchesOpenCV) {
+    for (const cv::Size& to_image_size : {cv::Size(31,17),cv::Size(160,90),cv::Size(32,24)})
+    {
+        improc::ResizeCoefficients coefficients {cv::Size(64,48),to_image_size,improc::InterpolationType(improc::InterpolationType::kLinear)};
+        for (int type : {CV_8UC1,CV_8UC3,CV_8UC4})
+        {
+            cv::Mat image {48,64,type};
+            cv::randu(image,cv::Scalar::all(0),cv::Scalar::all(255));
+            cv::Mat expected_image {};
+            cv::resize(image,expected_image,to_image_size,0,0,cv::INTER_LINEAR);
+            cv::Mat resized_image {};
+            coefficients.Apply(image,resized_image);
+            EXPECT_EQ(resized_image.size(),to_image_size);
+            // Intermediate sums are kept with full precision while cv::resize reduces it, so pixels may differ by one
+            EXPECT_LE(cv::norm(resized_image,expected_image,cv::NORM_INF),1);
+        }
+    }
+}
+
+TEST(ResizeCoefficients,TestApplyToDestination) {
+    improc::ResizeCoefficients coefficients {cv::Size(64,48),cv::Size(32,24),improc::InterpolationType(improc::InterpolationType::kLinear)};
+    cv::Mat image {48,64,CV_8UC3};
+    cv::randu(image,cv::Scalar::all(0),cv::Scalar::all(255));
+    cv::Mat resized_image {24,32,CV_8UC3};
+    const uchar* resized_data = resized_image.data;
+    coefficients.Apply(image,resized_image);
+    EXPECT_EQ(resized_image.data,resized_data);
+}
+
+TEST(ResizeCoefficients,TestGetSourceRegion) {
+    improc::ResizeCoefficients linear_coefficients  {cv::Size(64,48),cv::Size(32,24),improc::InterpolationType(improc::InterpolationType::kLinear)};
+    improc::ResizeCoefficients nearest_coefficients {cv::Size(64,48),cv::Size(32,24),improc::InterpolationType(improc::InterpolationType::kNearest)};
+    EXPECT_EQ(linear_coefficients.GetSourceRegion(cv::Rect(0,0,32,24)) ,cv::Rect(0,0,64,48));
+    EXPECT_EQ(linear_coefficients.GetSourceRegion(cv::Rect(4,2,8,6))   ,cv::Rect(8,4,16,12));
+    EXPECT_EQ(nearest_coefficients.GetSourceRegion(cv::Rect(4,2,8,6))  ,cv::Rect(8,4,15,11));
+    EXPECT_THROW(linear_coefficients.GetSourceRegion(cv::Rect(30,0,4,4)),improc::value_error);
+    EXPECT_THROW(linear_coefficients.GetSourceRegion(cv::Rect(0,0,0,4)) ,improc::value_error);
+}
+
+TEST(ResizeCoefficients,TestApplyToRegionMatchesApply) {
+    for (const cv::Size& to_image_size : {cv::Size(31,17),cv::Size(160,90)})
+    {
+        for (const improc::InterpolationType::Value interpolation : {improc::InterpolationType::kLinear,improc::InterpolationType::kNearest})
+        {
+            improc::ResizeCoefficients coefficients {cv::Size(64,48),to_image_size,improc::InterpolationType(interpolation)};
+            cv::Mat image {48,64,CV_8UC3};
+            cv::randu(image,cv::Scalar::all(0),cv::Scalar::all(255));
+            cv::Mat expected_image {};
+            coefficients.Apply(image,expected_image);
+
+            const cv::Rect kToRegion {to_image_size.width / 3,to_image_size.height / 2,to_image_size.width / 2,to_image_size.height / 2};
+            cv::Mat resized_region {};
+            coefficients.ApplyToRegion(image(coefficients.GetSourceRegion(kToRegion)),kToRegion,resized_region);
+            EXPECT_EQ(resized_region.size(),kToRegion.size());
+            EXPECT_EQ(cv::norm(resized_region,expected_image(kToRegion),cv::NORM_INF),0);
+            EXPECT_THROW(coefficients.ApplyToRegion(image,kToRegion,resized_region),improc::value_error);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,291 @@
+#include <gtest/gtest.h>
+
+#include <improc/services/resize_image.hpp>
+#include <improc_corecv_test_config.hpp>
+
+TEST(Resize,TestLoadWithoutSize) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_resize_without_size.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousResize resize {};
+    EXPECT_THROW(resize.Load(json_content),improc::json_error);
+}
+
+TEST(Resize,TestLoadWithSizeAndScale) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_resize_with_size_and_scale.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousResize resize {};
+    EXPECT_THROW(resize.Load(json_content),improc::json_error);
+}
+
+TEST(Resize,TestWithSize) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_resize_with_size.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousResize resize {};
+    resize.Load(json_content);
+
+    for (const cv::Size& image_size : {cv::Size(80,60),cv::Size(20,15),cv::Size(80,60)})
+    {
+        cv::Mat image_data {image_size,CV_8UC3};
+        cv::randu(image_data,cv::Scalar::all(0),cv::Scalar::all(255));
+        improc::StringKeyHeterogeneousContext cntxt {};
+        cntxt.Add("image",image_data);
+        resize.Run(cntxt);
+
+        improc::Image image = std::any_cast<improc::Image>(cntxt["image"]);
+        cv::Mat expected_image_data {};
+        cv::resize(image_data,expected_image_data,cv::Size(40,30),0,0,cv::INTER_LINEAR);
+        EXPECT_EQ(image.get_data().size(),cv::Size(40,30));
+        EXPECT_LE(cv::norm(image.get_data(),expected_image_data,cv::NORM_INF),1);
+    }
+}
+
+TEST(Resize,TestWithSizeWithoutCoefficients) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_resize_with_size_cubic.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousResize resize {};
+    resize.Load(json_content);
+
+    cv::Mat image_data = cv::Mat::ones(60,80,CV_8UC1);
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",image_data);
+    resize.Run(cntxt);
+
+    improc::Image image = std::any_cast<improc::Image>(cntxt["image"]);
+    EXPECT_EQ(image.get_data().size(),cv::Size(40,30));
+}
+
+TEST(Resize,TestWithScale) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_resize_with_scale.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousResize resize {};
+    resize.Load(json_content);
+
+    cv::Mat image_data = cv::Mat::ones(60,80,CV_8UC3);
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",image_data);
+    resize.Run(cntxt);
+
+    improc::Image image = std::any_cast<improc::Image>(cntxt["image"]);
+    EXPECT_EQ(image.get_data().size(),cv::Size(40,120));
+}
+
+TEST(Resize,TestWithColorSpaceImage) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_resize_with_scale.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousResize resize {};
+    resize.Load(json_content);
+
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",improc::ColorSpaceImage(cv::Mat::ones(60,80,CV_8UC4),improc::ColorSpace::kBGRA));
+    resize.Run(cntxt);
+
+    improc::ColorSpaceImage image = std::any_cast<improc::ColorSpaceImage>(cntxt["image"]);
+    EXPECT_EQ(image.get_color_space(),improc::ColorSpace::kBGRA);
+    EXPECT_EQ(image.get_data().size(),cv::Size(40,120));
+}
+
+TEST(Resize,TestWithDestination) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_resize_with_destination.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousResize resize {};
+    resize.Load(json_content);
+
+    cv::Mat image_data = cv::Mat::ones(60,80,CV_8UC3);
+    cv::Mat resized_buffer {30,40,CV_8UC3};
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",image_data);
+    cntxt.Add("resized_buffer",resized_buffer);
+    resize.Run(cntxt);
+
+    improc::Image image = std::any_cast<improc::Image>(cntxt["resized_image"]);
+    EXPECT_EQ(image.get_data().data,resized_buffer.data);
+    EXPECT_EQ(cv::norm(resized_buffer,cv::Mat::ones(30,40,CV_8UC3),cv::NORM_INF),0);
+}
+
+TEST(Resize,TestWithScaleAndDestination) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_resize_with_scale_and_destination.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousResize resize {};
+    resize.Load(json_content);
+
+    cv::Mat image_data = cv::Mat::ones(60,80,CV_8UC3);
+    cv::Mat resized_buffer {30,40,CV_8UC3};
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",image_data);
+    cntxt.Add("resized_buffer",resized_buffer);
+    resize.Run(cntxt);
+
+    improc::Image image = std::any_cast<improc::Image>(cntxt["resized_image"]);
+    EXPECT_EQ(image.get_data().data,resized_buffer.data);
+    EXPECT_EQ(cv::norm(resized_buffer,cv::Mat::ones(30,40,CV_8UC3),cv::NORM_INF),0);
+}
+
+TEST(Resize,TestScaleMatchesSize) {
+    improc::StringKeyHeterogeneousResize resize_with_size {};
+    resize_with_size.Load(improc::JsonFile(std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_resize_with_size.json").Read());
+    improc::StringKeyHeterogeneousResize resize_with_scale {};
+    resize_with_scale.Load(improc::JsonFile(std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_resize_with_half_scale.json").Read());
+
+    cv::Mat image_data {60,80,CV_8UC3};
+    cv::randu(image_data,cv::Scalar::all(0),cv::Scalar::all(256));
+    improc::StringKeyHeterogeneousContext size_cntxt {};
+    size_cntxt.Add("image",image_data);
+    resize_with_size.Run(size_cntxt);
+    improc::StringKeyHeterogeneousContext scale_cntxt {};
+    scale_cntxt.Add("image",image_data);
+    resize_with_scale.Run(scale_cntxt);
+
+    const cv::Mat kSizeImageData  = std::any_cast<improc::Image>(size_cntxt["image"]).get_data();
+    const cv::Mat kScaleImageData = std::any_cast<improc::Image>(scale_cntxt["image"]).get_data();
+    ASSERT_EQ(kScaleImageData.size(),cv::Size(40,30));
+    EXPECT_EQ(cv::norm(kSizeImageData,kScaleImageData,cv::NORM_INF),0);
+}
+
+TEST(Resize,TestReloadWithScale) {
+    improc::StringKeyHeterogeneousResize resize {};
+    resize.Load(improc::JsonFile(std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_resize_with_size_cubic.json").Read());
+    EXPECT_NO_THROW(resize.Load(improc::JsonFile(std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_resize_with_scale.json").Read()));
+
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",cv::Mat(cv::Mat::ones(60,80,CV_8UC3)));
+    resize.Run(cntxt);
+    EXPECT_EQ(std::any_cast<improc::Image>(cntxt["image"]).get_data().size(),cv::Size(40,120));
+}
+
+TEST(Resize,TestRunWithoutLoad) {
+    improc::StringKeyHeterogeneousResize resize {};
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",cv::Mat(cv::Mat::ones(60,80,CV_8UC3)));
+    EXPECT_THROW(resize.Run(cntxt),improc::processing_flow_error);
+}
+
+TEST(Resize,TestLoadToYUVColorSpace) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_resize_to_yuv.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousResize resize {};
+    EXPECT_THROW(resize.Load(json_content),improc::json_error);
+}
+
+TEST(Resize,TestYUVImageData) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_resize_nv12_to_bgr.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousResize resize {};
+    resize.Load(json_content);
+
+    cv::Mat image_data {120,80,CV_8UC1};
+    cv::randu(image_data,cv::Scalar::all(0),cv::Scalar::all(255));
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",image_data);
+    resize.Run(cntxt);
+
+    improc::ColorSpaceImage image = std::any_cast<improc::ColorSpaceImage>(cntxt["image"]);
+    cv::Mat converted_image_data {};
+    cv::Mat expected_image_data {};
+    cv::cvtColor(image_data,converted_image_data,cv::COLOR_YUV2BGR_NV12);
+    cv::resize(converted_image_data,expected_image_data,cv::Size(40,30),0,0,cv::INTER_NEAREST);
+    EXPECT_EQ(image.get_color_space(),improc::ColorSpace::kBGR);
+    EXPECT_EQ(image.get_data().size(),cv::Size(40,30));
+    EXPECT_EQ(cv::norm(image.get_data(),expected_image_data,cv::NORM_INF),0);
+
+    // Fused resizes are cached for each image size
+    cv::Mat other_image_data {60,60,CV_8UC1};
+    cv::randu(other_image_data,cv::Scalar::all(0),cv::Scalar::all(255));
+    for (const cv::Mat& input_data : {image_data,other_image_data,image_data})
+    {
+        cntxt["image"] = input_data;
+        resize.Run(cntxt);
+        cv::cvtColor(input_data,converted_image_data,cv::COLOR_YUV2BGR_NV12);
+        cv::resize(converted_image_data,expected_image_data,cv::Size(40,30),0,0,cv::INTER_NEAREST);
+        EXPECT_EQ(cv::norm(std::any_cast<improc::ColorSpaceImage>(cntxt["image"]).get_data(),expected_image_data,cv::NORM_INF),0);
+    }
+}
+
+TEST(Resize,TestYUVImageWithoutTargetColorSpace) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_resize_with_size.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousResize resize {};
+    resize.Load(json_content);
+
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",improc::ColorSpaceImage(cv::Mat::zeros(60,80,CV_8UC2),improc::ColorSpace::kYUYV));
+    EXPECT_THROW(resize.Run(cntxt),improc::value_error);
+}
+
+TEST(Resize,TestWithTargetColorSpace) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_resize_to_gray.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousResize resize {};
+    resize.Load(json_content);
+
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",improc::ColorSpaceImage(cv::Mat::ones(60,80,CV_8UC3),improc::ColorSpace::kBGR));
+    resize.Run(cntxt);
+    improc::ColorSpaceImage image = std::any_cast<improc::ColorSpaceImage>(cntxt["image"]);
+    EXPECT_EQ(image.get_color_space(),improc::ColorSpace::kGray);
+    EXPECT_EQ(image.get_data().size(),cv::Size(40,30));
+    EXPECT_EQ(image.get_data().channels(),1);
+
+    improc::StringKeyHeterogeneousContext cntxt_without_color_space {};
+    cntxt_without_color_space.Add("image",cv::Mat(cv::Mat::ones(60,80,CV_8UC3)));
+    EXPECT_THROW(resize.Run(cntxt_without_color_space),improc::value_error);
+}
+
+TEST(Resize,TestLoadFromPlan) {
+    improc::PlanWriter plan_writer {};
+    for (const std::string& json_filename : {"test_resize_with_size.json","test_resize_with_scale.json","test_resize_nv12_to_bgr.json"})
+    {
+        std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/" + json_filename;
+        improc::JsonFile json_file {filepath};
+        Json::Value json_content = json_file.Read();
+
+        improc::StringKeyHeterogeneousResize resize {};
+        resize.Load(json_content);
+        resize.Save(plan_writer);
+    }
+
+    improc::PlanReader plan_reader {plan_writer.get_data()};
+    improc::StringKeyHeterogeneousResize resize_with_size {};
+    improc::StringKeyHeterogeneousResize resize_with_scale {};
+    improc::StringKeyHeterogeneousResize resize_nv12_to_bgr {};
+    resize_with_size.Load(plan_reader);
+    resize_with_scale.Load(plan_reader);
+    resize_nv12_to_bgr.Load(plan_reader);
+    EXPECT_TRUE(plan_reader.IsEnd());
+
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",cv::Mat(cv::Mat::ones(60,80,CV_8UC3)));
+    resize_with_size.Run(cntxt);
+    EXPECT_EQ(std::any_cast<improc::Image>(cntxt["image"]).get_data().size(),cv::Size(40,30));
+    resize_with_scale.Run(cntxt);
+    EXPECT_EQ(std::any_cast<improc::Image>(cntxt["image"]).get_data().size(),cv::Size(20,60));
+
+    improc::StringKeyHeterogeneousContext cntxt_nv12 {};
+    cntxt_nv12.Add("image",cv::Mat(cv::Mat::zeros(90,80,CV_8UC1)));
+    resize_nv12_to_bgr.Run(cntxt_nv12);
+    EXPECT_EQ(std::any_cast<improc::ColorSpaceImage>(cntxt_nv12["image"]).get_color_space(),improc::ColorSpace::kBGR);
+    EXPECT_EQ(std::any_cast<improc::ColorSpaceImage>(cntxt_nv12["image"]).get_data().size(),cv::Size(40,30));
+}
\ No newline at end of file
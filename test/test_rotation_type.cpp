@@ -30,6 +30,13 @@ TEST(RotationType,TestInvalidRotationConstructor) {
     EXPECT_THROW(improc::RotationType rotation {"invalid"},std::out_of_range);
 }
 
+TEST(RotationType,TestTryParse) {
+    static_assert(improc::RotationType::TryParse("90-DEG").value() == improc::RotationType::Value::k90Deg);
+    EXPECT_EQ(improc::RotationType::TryParse(std::string("90-deg")).value(),improc::RotationType::Value::k90Deg);
+    EXPECT_FALSE(improc::RotationType::TryParse("invalid").has_value());
+    EXPECT_FALSE(improc::RotationType::TryParse("").has_value());
+}
+
 TEST(RotationType,TestConstructorFromClass) {
     EXPECT_EQ(improc::RotationType::k0Deg  ,improc::RotationType::Value::k0Deg);
     EXPECT_EQ(improc::RotationType::k90Deg ,improc::RotationType::Value::k90Deg);
@@ -70,4 +77,46 @@ TEST(RotationType,TestApplyRotation) {
     EXPECT_EQ(rotated.cols,original.rows);
     EXPECT_EQ(rotated.rows,original.cols);
     EXPECT_EQ(cv::norm(rotation_270deg.ApplyInverse(rotated),original,cv::NORM_L1),0);
+}
+
+TEST(RotationType,TestApplyRotationMatchesTransposeAndFlip) {
+    improc::RotationType rotation_90deg  {"90-deg"};
+    improc::RotationType rotation_270deg {"270-deg"};
+    for (int type : {CV_8UC1,CV_8UC3,CV_8UC4,CV_16UC1})
+    {
+        cv::Mat original {67,131,type};
+        cv::randu(original,cv::Scalar::all(0),cv::Scalar::all(255));
+        cv::Mat expected_90deg  {};
+        cv::Mat expected_270deg {};
+        cv::transpose(original,expected_90deg);
+        cv::flip(expected_90deg,expected_90deg,+1);
+        cv::transpose(original,expected_270deg);
+        cv::flip(expected_270deg,expected_270deg,0);
+        EXPECT_EQ(cv::norm(rotation_90deg.Apply(original) ,expected_90deg ,cv::NORM_L1),0);
+        EXPECT_EQ(cv::norm(rotation_270deg.Apply(original),expected_270deg,cv::NORM_L1),0);
+        EXPECT_EQ(cv::norm(rotation_90deg.ApplyInverse(expected_90deg)  ,original,cv::NORM_L1),0);
+        EXPECT_EQ(cv::norm(rotation_270deg.ApplyInverse(expected_270deg),original,cv::NORM_L1),0);
+    }
+}
+
+TEST(RotationType,TestApplyRotationToDestination) {
+    improc::RotationType rotation_0deg   {"0-deg"};
+    improc::RotationType rotation_90deg  {"90-deg"};
+    improc::RotationType rotation_180deg {"180-deg"};
+    cv::Mat original {10,20,CV_8UC3};
+    cv::randu(original,cv::Scalar::all(0),cv::Scalar::all(255));
+    cv::Mat rotated {20,10,CV_8UC3};
+    const uchar* rotated_data = rotated.data;
+    rotation_90deg.Apply(original,rotated);
+    EXPECT_EQ(rotated.data,rotated_data);
+    EXPECT_EQ(cv::norm(rotation_90deg.Apply(original),rotated,cv::NORM_L1),0);
+    cv::Mat restored {};
+    rotation_90deg.ApplyInverse(rotated,restored);
+    EXPECT_EQ(cv::norm(restored,original,cv::NORM_L1),0);
+    rotation_0deg.Apply(original,rotated);
+    EXPECT_NE(rotated.data,original.data);
+    EXPECT_EQ(cv::norm(rotated,original,cv::NORM_L1),0);
+    cv::Mat in_place = original.clone();
+    rotation_180deg.Apply(in_place,in_place);
+    EXPECT_EQ(cv::norm(in_place,rotation_180deg.Apply(original),cv::NORM_L1),0);
 }
\ No newline at end of file
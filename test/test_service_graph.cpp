@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <improc/services/service_graph.hpp>
+#include <improc/services/convert_color_space.hpp>
+#include <improc/services/resize_image.hpp>
+#include <improc_corecv_test_config.hpp>
+
+namespace
+{
+    Json::Value CreateConvertJson(const std::string& input, const std::string& output, const std::string& to_color_space)
+    {
+        Json::Value convert_json {};
+        convert_json["inputs"]           = input;
+        convert_json["outputs"]          = output;
+        convert_json["from_color_space"] = "bgr";
+        convert_json["to_color_space"]   = to_color_space;
+        return convert_json;
+    }
+
+    Json::Value CreateResizeJson(const std::string& input, const std::string& output)
+    {
+        Json::Value to_image_size {};
+        to_image_size["width"]  = 40;
+        to_image_size["height"] = 30;
+
+        Json::Value resize_json {};
+        resize_json["inputs"]        = input;
+        resize_json["outputs"]       = output;
+        resize_json["interpolation"] = "linear";
+        resize_json["to_image_size"] = to_image_size;
+        return resize_json;
+    }
+}
+
+TEST(ServiceGraph,TestDependencies) {
+    improc::StringKeyHeterogeneousConvertColorSpace to_gray {};
+    to_gray.Load(CreateConvertJson("image","gray","gray"));
+    improc::StringKeyHeterogeneousResize resize {};
+    resize.Load(CreateResizeJson("image","resized"));
+    improc::StringKeyHeterogeneousResize resize_gray {};
+    resize_gray.Load(CreateResizeJson("gray","resized_gray"));
+    improc::StringKeyHeterogeneousConvertColorSpace to_rgb {};
+    to_rgb.Load(CreateConvertJson("image","image","rgb"));
+    improc::StringKeyHeterogeneousResize resize_rgb {};
+    resize_rgb.Load(CreateResizeJson("image","resized"));
+
+    improc::StringKeyHeterogeneousServiceGraph graph {};
+    graph.AddService(to_gray).AddService(resize).AddService(resize_gray).AddService(to_rgb).AddService(resize_rgb);
+    EXPECT_EQ(graph.Size(),5);
+    EXPECT_TRUE(graph.GetDependencies(0).empty());
+    EXPECT_TRUE(graph.GetDependencies(1).empty());
+    EXPECT_EQ(graph.GetDependencies(2),std::vector<size_t>({0}));
+    EXPECT_EQ(graph.GetDependencies(3),std::vector<size_t>({0,1}));
+    EXPECT_EQ(graph.GetDependencies(4),std::vector<size_t>({1,3}));
+    EXPECT_THROW(graph.GetDependencies(5),improc::value_error);
+}
+
+TEST(ServiceGraph,TestSameResultAsSequential) {
+    improc::StringKeyHeterogeneousConvertColorSpace to_gray {};
+    to_gray.Load(CreateConvertJson("image","gray","gray"));
+    improc::StringKeyHeterogeneousResize resize_gray {};
+    resize_gray.Load(CreateResizeJson("gray","resized_gray"));
+    improc::StringKeyHeterogeneousConvertColorSpace to_rgb {};
+    to_rgb.Load(CreateConvertJson("image","rgb","rgb"));
+    improc::StringKeyHeterogeneousResize resize_rgb {};
+    resize_rgb.Load(CreateResizeJson("rgb","resized_rgb"));
+    improc::StringKeyHeterogeneousResize resize_image {};
+    resize_image.Load(CreateResizeJson("image","image"));
+
+    improc::StringKeyHeterogeneousServiceGraph graph {std::make_shared<improc::WorkStealingPool>(4)};
+    graph.AddService(to_gray).AddService(resize_gray).AddService(to_rgb).AddService(resize_rgb).AddService(resize_image);
+
+    for (size_t run_idx = 0; run_idx < 16; ++run_idx)
+    {
+        cv::Mat image_data (60,80,CV_8UC3);
+        cv::randu(image_data,0,256);
+        improc::StringKeyHeterogeneousContext cntxt {};
+        cntxt.Add("image",image_data);
+        improc::StringKeyHeterogeneousContext sequential_cntxt {};
+        sequential_cntxt.Add("image",image_data.clone());
+
+        graph.Run(cntxt);
+        for (const improc::BaseService<std::string,std::any>* service : std::vector<const improc::BaseService<std::string,std::any>*>({&to_gray,&resize_gray,&to_rgb,&resize_rgb,&resize_image}))
+        {
+            service->Run(sequential_cntxt);
+        }
+
+        for (const char* key : {"gray","resized_gray","rgb","resized_rgb","image"})
+        {
+            const cv::Mat& kData           = improc::ContextImage::GetData(cntxt.Get(key));
+            const cv::Mat& kSequentialData = improc::ContextImage::GetData(sequential_cntxt.Get(key));
+            ASSERT_EQ(kData.size(),kSequentialData.size());
+            EXPECT_EQ(cv::norm(kData,kSequentialData,cv::NORM_INF),0);
+        }
+    }
+}
+
+TEST(ServiceGraph,TestRethrowServiceError) {
+    improc::StringKeyHeterogeneousConvertColorSpace to_gray {};
+    to_gray.Load(CreateConvertJson("image","gray","gray"));
+    improc::StringKeyHeterogeneousResize resize_missing {};
+    resize_missing.Load(CreateResizeJson("missing","resized_missing"));
+    improc::StringKeyHeterogeneousResize resize_resized {};
+    resize_resized.Load(CreateResizeJson("resized_missing","resized_twice"));
+
+    improc::StringKeyHeterogeneousServiceGraph graph {std::make_shared<improc::WorkStealingPool>(2)};
+    graph.AddService(to_gray).AddService(resize_missing).AddService(resize_resized);
+
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",cv::Mat(cv::Mat::ones(60,80,CV_8UC3)));
+    EXPECT_THROW(graph.Run(cntxt),improc::key_error);
+
+    // Inputs are returned and outputs of failed or skipped services are not added
+    EXPECT_EQ(std::any_cast<const cv::Mat&>(cntxt.Get("image")).size(),cv::Size(80,60));
+    EXPECT_THROW(cntxt.Get("resized_missing"),improc::key_error);
+    EXPECT_THROW(cntxt.Get("resized_twice")  ,improc::key_error);
+}
+
+TEST(ServiceGraph,TestEmptyGraph) {
+    improc::StringKeyHeterogeneousServiceGraph graph {std::make_shared<improc::WorkStealingPool>(1)};
+    improc::StringKeyHeterogeneousContext cntxt {};
+    EXPECT_NO_THROW(graph.Run(cntxt));
+}
\ No newline at end of file
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <improc/services/stream_pipeline.hpp>
+#include <improc/services/convert_color_space.hpp>
+#include <improc/services/resize_image.hpp>
+#include <improc_corecv_test_config.hpp>
+
+#include <algorithm>
+
+namespace
+{
+    Json::Value ReadJson(const std::string& json_filename)
+    {
+        std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/" + json_filename;
+        improc::JsonFile json_file {filepath};
+        return json_file.Read();
+    }
+}
+
+TEST(StreamPipeline,TestInvalidQueueCapacity) {
+    EXPECT_THROW(improc::StringKeyHeterogeneousStreamPipeline (3),improc::value_error);
+}
+
+TEST(StreamPipeline,TestStartWithoutStages) {
+    improc::StringKeyHeterogeneousStreamPipeline pipeline {};
+    EXPECT_THROW(pipeline.Start(),improc::processing_flow_error);
+    EXPECT_THROW(pipeline.Push(improc::StringKeyHeterogeneousContext()),improc::processing_flow_error);
+}
+
+TEST(StreamPipeline,TestAddStageAfterStart) {
+    improc::StringKeyHeterogeneousResize resize {};
+    resize.Load(ReadJson("test_resize_with_size.json"));
+
+    improc::StringKeyHeterogeneousStreamPipeline pipeline {};
+    EXPECT_THROW(pipeline.AddStage(resize,0),improc::value_error);
+    pipeline.AddStage(resize).Start();
+    EXPECT_THROW(pipeline.AddStage(resize),improc::processing_flow_error);
+    EXPECT_THROW(pipeline.Start(),improc::processing_flow_error);
+}
+
+TEST(StreamPipeline,TestSameResultAndOrderAsSequential) {
+    improc::StringKeyHeterogeneousConvertColorSpace convert {};
+    convert.Load(ReadJson("test_sequence_color_conversion_with_from.json"));
+    improc::StringKeyHeterogeneousResize resize {};
+    resize.Load(ReadJson("test_resize_with_scale.json"));
+
+    improc::StringKeyHeterogeneousStreamPipeline pipeline {4};
+    pipeline.AddStage(convert,3).AddStage(resize,2).Start();
+
+    constexpr size_t kNumberFrames = 64;
+    std::thread producer {[&pipeline] () -> void
+                          {
+                              for (size_t frame_idx = 0; frame_idx < kNumberFrames; ++frame_idx)
+                              {
+                                  cv::Mat image_data (8 + static_cast<int>(frame_idx),6,CV_8UC3);
+                                  cv::randu(image_data,0,256);
+                                  improc::StringKeyHeterogeneousContext cntxt {};
+                                  cntxt.Add("image",image_data);
+                                  cntxt.Add("frame",frame_idx);
+                                  pipeline.Push(std::move(cntxt));
+                              }
+                              pipeline.Close();
+                          }};
+
+    size_t number_frames = 0;
+    for (std::optional<improc::StringKeyHeterogeneousContext> cntxt = pipeline.Pop(); cntxt.has_value() == true; cntxt = pipeline.Pop())
+    {
+        EXPECT_EQ(std::any_cast<size_t>(cntxt->Get("frame")),number_frames);
+        improc::ColorSpaceImage image = std::any_cast<improc::ColorSpaceImage>(cntxt->Get("image"));
+        EXPECT_EQ(image.get_color_space(),improc::ColorSpace::kGray);
+        EXPECT_EQ(image.get_data().size(),cv::Size(3,2 * (8 + static_cast<int>(number_frames))));
+        ++number_frames;
+    }
+    producer.join();
+    EXPECT_EQ(number_frames,kNumberFrames);
+
+    const std::vector<improc::StringKeyHeterogeneousStreamPipeline::StageStatistics> kStatistics = pipeline.GetStatistics();
+    ASSERT_EQ(kStatistics.size(),2);
+    EXPECT_EQ(kStatistics[0].number_workers,3);
+    EXPECT_EQ(kStatistics[0].processed,kNumberFrames);
+    EXPECT_EQ(kStatistics[1].processed,kNumberFrames);
+    EXPECT_EQ(kStatistics[1].queue.pushed,kNumberFrames);
+    EXPECT_LE(kStatistics[1].queue.max_occupancy,4);
+    EXPECT_EQ(pipeline.GetOutputStatistics().popped,kNumberFrames);
+}
+
+TEST(StreamPipeline,TestDropOldest) {
+    improc::StringKeyHeterogeneousResize resize {};
+    resize.Load(ReadJson("test_resize_with_size.json"));
+
+    improc::StringKeyHeterogeneousStreamPipeline pipeline {2,improc::BackpressurePolicy::kDropOldest};
+    pipeline.AddStage(resize).Start();
+    for (size_t frame_idx = 0; frame_idx < 32; ++frame_idx)
+    {
+        improc::StringKeyHeterogeneousContext cntxt {};
+        cntxt.Add("image",cv::Mat(cv::Mat::zeros(60,80,CV_8UC1)));
+        cntxt.Add("frame",frame_idx);
+        EXPECT_TRUE(pipeline.Push(std::move(cntxt)));
+    }
+    pipeline.Close();
+
+    std::vector<size_t> frames {};
+    for (std::optional<improc::StringKeyHeterogeneousContext> cntxt = pipeline.Pop(); cntxt.has_value() == true; cntxt = pipeline.Pop())
+    {
+        frames.push_back(std::any_cast<size_t>(cntxt->Get("frame")));
+    }
+    // Frames kept are at most the ones in both queues and the one being resized
+    ASSERT_FALSE(frames.empty());
+    EXPECT_LE(frames.size(),5);
+    EXPECT_EQ(frames.back(),31);
+    EXPECT_TRUE(std::is_sorted(frames.begin(),frames.end()));
+
+    const size_t kDropped = pipeline.GetStatistics()[0].queue.dropped + pipeline.GetOutputStatistics().dropped;
+    EXPECT_EQ(kDropped + frames.size(),32);
+}
+
+TEST(StreamPipeline,TestRethrowServiceErrorAtEndOfStream) {
+    improc::StringKeyHeterogeneousConvertColorSpace convert {};
+    convert.Load(ReadJson("test_color_conversion_without_from.json"));
+
+    improc::StringKeyHeterogeneousStreamPipeline pipeline {};
+    pipeline.AddStage(convert,2).Start();
+    for (size_t frame_idx = 0; frame_idx < 4; ++frame_idx)
+    {
+        improc::StringKeyHeterogeneousContext cntxt {};
+        cntxt.Add("image",cv::Mat(cv::Mat::ones(10,5,CV_8UC3)));
+        if (frame_idx != 2)
+        {
+            cntxt.Add("from_color_space",improc::ColorSpace(improc::ColorSpace::kRGB));
+        }
+        pipeline.Push(std::move(cntxt));
+    }
+    pipeline.Close();
+
+    size_t number_frames = 0;
+    EXPECT_THROW(while (pipeline.Pop().has_value() == true) {++number_frames;},improc::key_error);
+    EXPECT_EQ(number_frames,3);
+    EXPECT_EQ(pipeline.GetStatistics()[0].failed,1);
+    EXPECT_FALSE(pipeline.Pop().has_value());
+}
+
+TEST(StreamPipeline,TestDestroyWithoutConsumer) {
+    improc::StringKeyHeterogeneousResize resize {};
+    resize.Load(ReadJson("test_resize_with_size.json"));
+
+    improc::StringKeyHeterogeneousStreamPipeline pipeline {2};
+    pipeline.AddStage(resize).Start();
+    for (size_t frame_idx = 0; frame_idx < 4; ++frame_idx)
+    {
+        improc::StringKeyHeterogeneousContext cntxt {};
+        cntxt.Add("image",cv::Mat(cv::Mat::zeros(60,80,CV_8UC1)));
+        pipeline.Push(std::move(cntxt));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+
+#include <improc/services/threshold.hpp>
+#include <improc_corecv_test_config.hpp>
+
+#include <opencv2/imgproc.hpp>
+
+#include <cmath>
+
+TEST(Threshold,TestLoadWithoutType) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_threshold_without_type.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousThreshold threshold {};
+    EXPECT_THROW(threshold.Load(json_content),improc::json_error);
+}
+
+TEST(Threshold,TestLoadBinaryWithoutThreshold) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_threshold_binary_without_threshold.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousThreshold threshold {};
+    EXPECT_THROW(threshold.Load(json_content),improc::json_error);
+}
+
+TEST(Threshold,TestBinary) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_threshold_binary.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousThreshold threshold {};
+    threshold.Load(json_content);
+
+    cv::Mat image_data {60,80,CV_8UC3};
+    cv::randu(image_data,cv::Scalar::all(0),cv::Scalar::all(255));
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",image_data);
+    threshold.Run(cntxt);
+
+    improc::ColorSpaceImage image = std::any_cast<improc::ColorSpaceImage>(cntxt["image"]);
+    cv::Mat gray_image_data {};
+    cv::Mat expected_image_data {};
+    cv::cvtColor(image_data,gray_image_data,cv::COLOR_BGR2GRAY);
+    cv::threshold(gray_image_data,expected_image_data,100,1,cv::THRESH_BINARY);
+    EXPECT_EQ(image.get_color_space(),improc::ColorSpace::kGray);
+    EXPECT_EQ(cv::norm(image.get_data(),expected_image_data,cv::NORM_INF),0);
+}
+
+TEST(Threshold,TestOtsuWithColorSpaceInput) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_threshold_otsu.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousThreshold threshold {};
+    threshold.Load(json_content);
+
+    cv::Mat image_data {60,80,CV_8UC4};
+    cv::randu(image_data,cv::Scalar::all(0),cv::Scalar::all(255));
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",image_data);
+    cntxt.Add("color_space",improc::ColorSpace(improc::ColorSpace::kRGBA));
+    threshold.Run(cntxt);
+
+    improc::ColorSpaceImage image = std::any_cast<improc::ColorSpaceImage>(cntxt["image"]);
+    cv::Mat gray_image_data {};
+    cv::Mat expected_image_data {};
+    cv::cvtColor(image_data,gray_image_data,cv::COLOR_RGBA2GRAY);
+    const double kExpectedThreshold = cv::threshold(gray_image_data,expected_image_data,0,255,cv::THRESH_BINARY | cv::THRESH_OTSU);
+    EXPECT_DOUBLE_EQ(std::any_cast<double>(cntxt["threshold"]),kExpectedThreshold);
+    EXPECT_EQ(cv::norm(image.get_data(),expected_image_data,cv::NORM_INF),0);
+}
+
+TEST(Threshold,TestOtsuWithColorSpaceImage) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_threshold_otsu.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousThreshold threshold {};
+    threshold.Load(json_content);
+
+    cv::Mat image_data {60,80,CV_8UC3};
+    cv::randu(image_data,cv::Scalar::all(0),cv::Scalar::all(255));
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",improc::ColorSpaceImage(image_data,improc::ColorSpace::Value::kRGB));
+    threshold.Run(cntxt);
+
+    improc::ColorSpaceImage image = std::any_cast<improc::ColorSpaceImage>(cntxt["image"]);
+    cv::Mat gray_image_data {};
+    cv::Mat expected_image_data {};
+    cv::cvtColor(image_data,gray_image_data,cv::COLOR_RGB2GRAY);
+    cv::threshold(gray_image_data,expected_image_data,0,255,cv::THRESH_BINARY | cv::THRESH_OTSU);
+    EXPECT_EQ(cv::norm(image.get_data(),expected_image_data,cv::NORM_INF),0);
+}
+
+TEST(Threshold,TestLoadFromPlan) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_threshold_binary.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousThreshold threshold {};
+    threshold.Load(json_content);
+    improc::PlanWriter plan_writer {};
+    threshold.Save(plan_writer);
+
+    improc::PlanReader plan_reader {plan_writer.get_data()};
+    improc::StringKeyHeterogeneousThreshold plan_threshold {};
+    plan_threshold.Load(plan_reader);
+
+    cv::Mat image_data {60,80,CV_8UC3};
+    cv::randu(image_data,cv::Scalar::all(0),cv::Scalar::all(255));
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",image_data);
+    plan_threshold.Run(cntxt);
+
+    improc::ColorSpaceImage image = std::any_cast<improc::ColorSpaceImage>(cntxt["image"]);
+    cv::Mat gray_image_data {};
+    cv::Mat expected_image_data {};
+    cv::cvtColor(image_data,gray_image_data,cv::COLOR_BGR2GRAY);
+    cv::threshold(gray_image_data,expected_image_data,100,1,cv::THRESH_BINARY);
+    EXPECT_EQ(cv::norm(image.get_data(),expected_image_data,cv::NORM_INF),0);
+}
+TEST(Threshold,TestLoadAdaptiveWithoutWindowSize) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_threshold_adaptive_mean_without_window_size.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousThreshold threshold {};
+    EXPECT_THROW(threshold.Load(json_content),improc::json_error);
+}
+
+TEST(Threshold,TestSauvolaWithIntegralOutput) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_threshold_sauvola.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousThreshold threshold {};
+    threshold.Load(json_content);
+
+    cv::Mat image_data {60,80,CV_8UC3};
+    cv::randu(image_data,cv::Scalar::all(0),cv::Scalar::all(255));
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",image_data);
+    threshold.Run(cntxt);
+
+    cv::Mat expected_image_data {};
+    improc::LuminanceThreshold(improc::ThresholdType(improc::ThresholdType::kSauvola),0.5,255.0,15).Apply(image_data,improc::ColorSpace(improc::ColorSpace::kBGR),expected_image_data);
+    improc::ColorSpaceImage image = std::any_cast<improc::ColorSpaceImage>(cntxt["image"]);
+    EXPECT_EQ(image.get_color_space(),improc::ColorSpace::kGray);
+    EXPECT_EQ(cv::norm(image.get_data(),expected_image_data,cv::NORM_INF),0);
+    EXPECT_TRUE(std::isnan(std::any_cast<double>(cntxt["threshold"])));
+
+    const improc::IntegralImage kIntegralImage = std::any_cast<improc::IntegralImage>(cntxt["integral_image"]);
+    cv::Mat gray_image_data {};
+    cv::Mat expected_sum {};
+    cv::cvtColor(image_data,gray_image_data,cv::COLOR_BGR2GRAY);
+    cv::integral(gray_image_data,expected_sum,CV_32S);
+    EXPECT_TRUE(kIntegralImage.HasSquareSum());
+    EXPECT_EQ(cv::norm(kIntegralImage.get_sum(),expected_sum,cv::NORM_INF),0);
+}
+
+TEST(Threshold,TestLoadAdaptiveFromPlan) {
+    std::string filepath = std::string(IMPROC_CORECV_TEST_FOLDER) + "/test/data/test_threshold_sauvola.json";
+    improc::JsonFile json_file {filepath};
+    Json::Value json_content = json_file.Read();
+
+    improc::StringKeyHeterogeneousThreshold threshold {};
+    threshold.Load(json_content);
+    improc::PlanWriter plan_writer {};
+    threshold.Save(plan_writer);
+
+    improc::PlanReader plan_reader {plan_writer.get_data()};
+    improc::StringKeyHeterogeneousThreshold plan_threshold {};
+    plan_threshold.Load(plan_reader);
+
+    cv::Mat image_data {60,80,CV_8UC3};
+    cv::randu(image_data,cv::Scalar::all(0),cv::Scalar::all(255));
+    improc::StringKeyHeterogeneousContext cntxt {};
+    cntxt.Add("image",image_data.clone());
+    threshold.Run(cntxt);
+    improc::StringKeyHeterogeneousContext plan_cntxt {};
+    plan_cntxt.Add("image",image_data.clone());
+    plan_threshold.Run(plan_cntxt);
+
+    EXPECT_EQ(cv::norm( std::any_cast<improc::ColorSpaceImage>(cntxt["image"]).get_data()
+                      , std::any_cast<improc::ColorSpaceImage>(plan_cntxt["image"]).get_data(),cv::NORM_INF),0);
+}
\ No newline at end of file
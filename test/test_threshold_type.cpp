@@ -30,6 +30,13 @@ TEST(ThresholdType,TestInvalidThresholdConstructor) {
     EXPECT_THROW(improc::ThresholdType threshold {"invalid"},std::out_of_range);
 }
 
+TEST(ThresholdType,TestTryParse) {
+    static_assert(improc::ThresholdType::TryParse("Otsu").value() == improc::ThresholdType::Value::kOtsu);
+    EXPECT_EQ(improc::ThresholdType::TryParse(std::string("otsu")).value(),improc::ThresholdType::Value::kOtsu);
+    EXPECT_FALSE(improc::ThresholdType::TryParse("invalid").has_value());
+    EXPECT_FALSE(improc::ThresholdType::TryParse("").has_value());
+}
+
 TEST(ThresholdType,TestConstructorFromClass) {
     EXPECT_EQ(improc::ThresholdType::kOtsu  ,improc::ThresholdType::Value::kOtsu);
     EXPECT_EQ(improc::ThresholdType::kBinary,improc::ThresholdType::Value::kBinary);
@@ -48,3 +55,16 @@ TEST(ThresholdType,TestToOpenCV) {
     EXPECT_EQ(threshold_otsu.ToOpenCV()  ,cv::THRESH_OTSU);
     EXPECT_EQ(threshold_binary.ToOpenCV(),cv::THRESH_BINARY);
 }
+
+TEST(ThresholdType,TestAdaptive) {
+    improc::ThresholdType threshold_mean    {"adaptive_mean"};
+    improc::ThresholdType threshold_sauvola {"SAUVOLA"};
+    EXPECT_EQ(threshold_mean   ,improc::ThresholdType::Value::kAdaptiveMean);
+    EXPECT_EQ(threshold_sauvola,improc::ThresholdType::Value::kSauvola);
+    EXPECT_EQ(threshold_mean.ToString()   ,"AdaptiveMean");
+    EXPECT_EQ(threshold_sauvola.ToString(),"Sauvola");
+    EXPECT_TRUE (threshold_mean.IsAdaptive());
+    EXPECT_TRUE (threshold_sauvola.IsAdaptive());
+    EXPECT_FALSE(improc::ThresholdType(improc::ThresholdType::Value::kOtsu).IsAdaptive());
+    EXPECT_THROW(threshold_sauvola.ToOpenCV(),improc::key_error);
+}
\ No newline at end of file
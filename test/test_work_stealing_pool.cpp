@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+
+#include <improc/corecv/work_stealing_pool.hpp>
+
+#include <atomic>
+#include <stdexcept>
+
+TEST(WorkStealingPool,TestInvalidNumberThreads) {
+    EXPECT_THROW(improc::WorkStealingPool (0),improc::value_error);
+}
+
+TEST(WorkStealingPool,TestRunSubmittedTasks) {
+    std::atomic<size_t> number_tasks {0};
+    {
+        improc::WorkStealingPool pool {4};
+        EXPECT_EQ(pool.get_number_threads(),4);
+        for (size_t task_idx = 0; task_idx < 1000; ++task_idx)
+        {
+            pool.Submit([&number_tasks] () -> void {++number_tasks;});
+        }
+    }
+    EXPECT_EQ(number_tasks.load(),1000);
+}
+
+TEST(WorkStealingPool,TestRunTasksSubmittedFromTasks) {
+    std::atomic<size_t> number_tasks {0};
+    {
+        improc::WorkStealingPool pool {4};
+        for (size_t task_idx = 0; task_idx < 16; ++task_idx)
+        {
+            pool.Submit([&pool,&number_tasks] () -> void
+                        {
+                            for (size_t subtask_idx = 0; subtask_idx < 64; ++subtask_idx)
+                            {
+                                pool.Submit([&number_tasks] () -> void {++number_tasks;});
+                            }
+                        });
+        }
+    }
+    EXPECT_EQ(number_tasks.load(),16 * 64);
+}
+
+TEST(WorkStealingPool,TestFailedTask) {
+    std::atomic<size_t> number_tasks {0};
+    {
+        improc::WorkStealingPool pool {2};
+        pool.Submit([] () -> void {throw std::runtime_error("Task failed");});
+        pool.Submit([&number_tasks] () -> void {++number_tasks;});
+    }
+    EXPECT_EQ(number_tasks.load(),1);
+}
\ No newline at end of file
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include <improc/corecv/kernels/yuv_resize.hpp>
+#include <improc_corecv_test_utils.hpp>
+
+#include <opencv2/imgproc.hpp>
+
+namespace
+{
+    cv::Mat CreateRandomImageData(const improc::ColorSpace& color_space, const cv::Size& image_size)
+    {
+        return improc::test::CreateRandomImage(color_space.GetDataSize(image_size),CV_8UC(static_cast<int>(color_space.GetNumberChannels())));
+    }
+
+    cv::Mat ConvertAndResize( const cv::Mat& image_data, const improc::ColorSpace& from_color_space, const improc::ColorSpace& to_color_space
+                            , const cv::Size& to_image_size, int interpolation )
+    {
+        cv::Mat converted_image {};
+        cv::Mat resized_image {};
+        cv::cvtColor(image_data,converted_image,from_color_space.GetColorConversionCode(to_color_space));
+        cv::resize(converted_image,resized_image,to_image_size,0,0,interpolation);
+        return resized_image;
+    }
+}
+
+TEST(YUVResize,TestEmptyConstructor) {
+    improc::YUVResize yuv_resize {};
+    EXPECT_EQ(yuv_resize.get_from_color_space(),improc::ColorSpace::kNV12);
+    EXPECT_EQ(yuv_resize.get_to_color_space()  ,improc::ColorSpace::kBGR);
+    EXPECT_TRUE(yuv_resize.get_from_image_size().empty());
+}
+
+TEST(YUVResize,TestConstructor) {
+    improc::YUVResize yuv_resize { improc::ColorSpace(improc::ColorSpace::kI420),improc::ColorSpace(improc::ColorSpace::kRGBA)
+                                 , cv::Size(64,48),cv::Size(20,10),improc::InterpolationType(improc::InterpolationType::kNearest) };
+    EXPECT_EQ(yuv_resize.get_from_color_space(),improc::ColorSpace::kI420);
+    EXPECT_EQ(yuv_resize.get_to_color_space()  ,improc::ColorSpace::kRGBA);
+    EXPECT_EQ(yuv_resize.get_from_image_size() ,cv::Size(64,48));
+    EXPECT_EQ(yuv_resize.get_to_image_size()   ,cv::Size(20,10));
+    EXPECT_EQ(yuv_resize.get_interpolation()   ,improc::InterpolationType::kNearest);
+}
+
+TEST(YUVResize,TestIsSupported) {
+    const improc::InterpolationType kLinear {improc::InterpolationType::kLinear};
+    EXPECT_TRUE (improc::YUVResize::IsSupported(improc::ColorSpace(improc::ColorSpace::kNV12),improc::ColorSpace(improc::ColorSpace::kBGR) ,kLinear));
+    EXPECT_TRUE (improc::YUVResize::IsSupported(improc::ColorSpace(improc::ColorSpace::kYUYV),improc::ColorSpace(improc::ColorSpace::kGray),kLinear));
+    EXPECT_FALSE(improc::YUVResize::IsSupported(improc::ColorSpace(improc::ColorSpace::kBGR) ,improc::ColorSpace(improc::ColorSpace::kRGB) ,kLinear));
+    EXPECT_FALSE(improc::YUVResize::IsSupported(improc::ColorSpace(improc::ColorSpace::kNV12),improc::ColorSpace(improc::ColorSpace::kI420),kLinear));
+    EXPECT_FALSE(improc::YUVResize::IsSupported( improc::ColorSpace(improc::ColorSpace::kNV12),improc::ColorSpace(improc::ColorSpace::kBGR)
+                                               , improc::InterpolationType(improc::InterpolationType::kCubic) ));
+}
+
+TEST(YUVResize,TestInvalidConstructor) {
+    const improc::InterpolationType kLinear {improc::InterpolationType::kLinear};
+    EXPECT_THROW(improc::YUVResize(improc::ColorSpace(improc::ColorSpace::kBGR),improc::ColorSpace(improc::ColorSpace::kRGB),cv::Size(64,48),cv::Size(20,10),kLinear),improc::value_error);
+    EXPECT_THROW(improc::YUVResize(improc::ColorSpace(improc::ColorSpace::kNV12),improc::ColorSpace(improc::ColorSpace::kBGR),cv::Size(63,48),cv::Size(20,10),kLinear),improc::value_error);
+    EXPECT_THROW(improc::YUVResize(improc::ColorSpace(improc::ColorSpace::kI420),improc::ColorSpace(improc::ColorSpace::kBGR),cv::Size(64,47),cv::Size(20,10),kLinear),improc::value_error);
+    EXPECT_NO_THROW(improc::YUVResize(improc::ColorSpace(improc::ColorSpace::kYUYV),improc::ColorSpace(improc::ColorSpace::kBGR),cv::Size(64,47),cv::Size(20,10),kLinear));
+}
+
+TEST(YUVResize,TestApplyInvalidImage) {
+    improc::YUVResize yuv_resize { improc::ColorSpace(improc::ColorSpace::kNV12),improc::ColorSpace(improc::ColorSpace::kBGR)
+                                 , cv::Size(64,48),cv::Size(20,10),improc::InterpolationType(improc::InterpolationType::kLinear) };
+    cv::Mat resized_image {};
+    EXPECT_THROW(yuv_resize.Apply(cv::Mat::zeros(48,64,CV_8UC1),resized_image),improc::value_error);
+    EXPECT_THROW(yuv_resize.Apply(cv::Mat::zeros(72,64,CV_8UC2),resized_image),improc::value_error);
+    EXPECT_NO_THROW(yuv_resize.Apply(cv::Mat::zeros(72,64,CV_8UC1),resized_image));
+}
+
+TEST(YUVResize,TestNearestMatchesOpenCV) {
+    const cv::Size kFromImageSize {64,48};
+    for (const improc::ColorSpace::Value& from_color_space : {improc::ColorSpace::kNV12,improc::ColorSpace::kI420,improc::ColorSpace::kYUYV})
+    {
+        const cv::Mat kImageData = CreateRandomImageData(improc::ColorSpace(from_color_space),kFromImageSize);
+        for (const improc::ColorSpace::Value& to_color_space : {improc::ColorSpace::kBGR,improc::ColorSpace::kRGBA,improc::ColorSpace::kGray})
+        {
+            for (const cv::Size& to_image_size : {cv::Size(31,17),cv::Size(160,90)})
+            {
+                improc::YUVResize yuv_resize { improc::ColorSpace(from_color_space),improc::ColorSpace(to_color_space)
+                                             , kFromImageSize,to_image_size,improc::InterpolationType(improc::InterpolationType::kNearest) };
+                cv::Mat resized_image {};
+                yuv_resize.Apply(kImageData,resized_image);
+                const cv::Mat kExpectedImage = ConvertAndResize( kImageData,improc::ColorSpace(from_color_space),improc::ColorSpace(to_color_space)
+                                                               , to_image_size,cv::INTER_NEAREST );
+                EXPECT_EQ(resized_image.type(),kExpectedImage.type());
+                EXPECT_EQ(resized_image.size(),to_image_size);
+                EXPECT_EQ(cv::norm(resized_image,kExpectedImage,cv::NORM_INF),0);
+            }
+        }
+    }
+}
+
+TEST(YUVResize,TestLinearGrayMatchesResizeCoefficients) {
+    const cv::Size kFromImageSize {64,48};
+    const cv::Size kToImageSize   {37,21};
+    const improc::InterpolationType kLinear {improc::InterpolationType::kLinear};
+    const cv::Mat kImageData = CreateRandomImageData(improc::ColorSpace(improc::ColorSpace::kNV12),kFromImageSize);
+    improc::YUVResize yuv_resize {improc::ColorSpace(improc::ColorSpace::kNV12),improc::ColorSpace(improc::ColorSpace::kGray),kFromImageSize,kToImageSize,kLinear};
+    cv::Mat resized_image {};
+    yuv_resize.Apply(kImageData,resized_image);
+
+    cv::Mat expected_image {};
+    improc::ResizeCoefficients(kFromImageSize,kToImageSize,kLinear).Apply(kImageData(cv::Rect(cv::Point(0,0),kFromImageSize)),expected_image);
+    EXPECT_EQ(cv::norm(resized_image,expected_image,cv::NORM_INF),0);
+}
+
+TEST(YUVResize,TestLinearCloseToOpenCV) {
+    // Smooth images, so that interpolating chroma before conversion is close to interpolating converted pixels
+    const cv::Size kFromImageSize {64,48};
+    const cv::Size kToImageSize   {40,30};
+    for (const improc::ColorSpace::Value& from_color_space : {improc::ColorSpace::kNV12,improc::ColorSpace::kI420,improc::ColorSpace::kYUYV})
+    {
+        cv::Mat image_data {improc::ColorSpace(from_color_space).GetDataSize(kFromImageSize),CV_8UC(static_cast<int>(improc::ColorSpace(from_color_space).GetNumberChannels()))};
+        for (int row = 0; row < image_data.rows; ++row)
+        {
+            for (int col = 0; col < image_data.cols * image_data.channels(); ++col)
+            {
+                image_data.ptr<uchar>(row)[col] = static_cast<uchar>(64 + row + col / 4);
+            }
+        }
+        improc::YUVResize yuv_resize { improc::ColorSpace(from_color_space),improc::ColorSpace(improc::ColorSpace::kBGR)
+                                     , kFromImageSize,kToImageSize,improc::InterpolationType(improc::InterpolationType::kLinear) };
+        cv::Mat resized_image {};
+        yuv_resize.Apply(image_data,resized_image);
+        const cv::Mat kExpectedImage = ConvertAndResize( image_data,improc::ColorSpace(from_color_space),improc::ColorSpace(improc::ColorSpace::kBGR)
+                                                       , kToImageSize,cv::INTER_LINEAR );
+        EXPECT_EQ(resized_image.size(),kToImageSize);
+        EXPECT_LE(cv::norm(resized_image,kExpectedImage,cv::NORM_INF),8);
+    }
+}
\ No newline at end of file